@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <geode/Serializer.hpp>
+
+#include "DataInputInternal.hpp"
+#include "DataOutputInternal.hpp"
+
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::DataOutputInternal;
+using apache::geode::client::serializer::readArrayObject;
+using apache::geode::client::serializer::writeArrayObject;
+using apache::geode::client::serializer::writeObject;
+
+template <class T>
+std::vector<T> makeArray(int64_t length) {
+  std::vector<T> array(static_cast<size_t>(length));
+  for (size_t i = 0; i < array.size(); i++) {
+    array[i] = static_cast<T>(i * 31);
+  }
+  return array;
+}
+
+template <class T>
+void ArrayWriteElementsBM(benchmark::State& state) {
+  const auto array = makeArray<T>(state.range(0));
+
+  for (auto _ : state) {
+    DataOutputInternal output;
+    output.writeArrayLen(static_cast<int32_t>(array.size()));
+    for (const auto& value : array) {
+      writeObject(output, value);
+    }
+    benchmark::DoNotOptimize(output.getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <class T>
+void ArrayWriteBulkBM(benchmark::State& state) {
+  const auto array = makeArray<T>(state.range(0));
+
+  for (auto _ : state) {
+    DataOutputInternal output;
+    writeArrayObject(output, array);
+    benchmark::DoNotOptimize(output.getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <class T>
+void ArrayReadBulkBM(benchmark::State& state) {
+  DataOutputInternal output;
+  writeArrayObject(output, makeArray<T>(state.range(0)));
+
+  for (auto _ : state) {
+    DataInputInternal input(output.getBuffer(), output.getBufferLength());
+    benchmark::DoNotOptimize(readArrayObject<T>(input));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(ArrayWriteElementsBM, int32_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteBulkBM, int32_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayReadBulkBM, int32_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteElementsBM, int64_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteBulkBM, int64_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayReadBulkBM, int64_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteElementsBM, double)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteBulkBM, double)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayReadBulkBM, double)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteElementsBM, char16_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayWriteBulkBM, char16_t)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(ArrayReadBulkBM, char16_t)->Range(8, 8 << 12);
@@ -0,0 +1,268 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/PoolManager.hpp>
+#include <geode/QueryService.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "FakeLocator.hpp"
+#include "FakeServer.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::FakeLocator;
+using apache::geode::client::FakeServer;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+namespace {
+
+const int kServerCount = 2;
+const int32_t kEntryCount = 1024;
+const int32_t kBulkSize = 100;
+
+/**
+ * A client cache whose pool reaches fake servers on localhost through a
+ * fake locator, so that the whole client stack can be measured without a
+ * cluster.
+ */
+class ClientStack {
+ public:
+  explicit ClientStack(int maxConnections) {
+    // the servers share their regions so that every server the pool picks
+    // sees every put, as with replicated regions
+    auto store = std::make_shared<FakeServer::Store>();
+    std::vector<uint16_t> serverPorts;
+    for (int i = 0; i < kServerCount; i++) {
+      m_servers.emplace_back(new FakeServer(store));
+      m_servers.back()->start();
+      serverPorts.push_back(m_servers.back()->getPort());
+    }
+    m_locator.reset(new FakeLocator(serverPorts));
+    m_locator->start();
+
+    m_cache.reset(new Cache(CacheFactory()
+                                .set("log-level", "none")
+                                .set("statistic-sampling-enabled", "false")
+                                .create()));
+    m_cache->getPoolManager()
+        .createFactory()
+        .addLocator("localhost", m_locator->getPort())
+        .setMaxConnections(maxConnections)
+        .create("pool");
+    m_region = m_cache->createRegionFactory(RegionShortcut::PROXY)
+                   .setPoolName("pool")
+                   .create("region");
+  }
+
+  ~ClientStack() {
+    m_region = nullptr;
+    m_cache->close();
+    m_cache = nullptr;
+  }
+
+  inline Region& region() { return *m_region; }
+
+  inline Cache& cache() { return *m_cache; }
+
+ private:
+  std::vector<std::unique_ptr<FakeServer>> m_servers;
+  std::unique_ptr<FakeLocator> m_locator;
+  std::unique_ptr<Cache> m_cache;
+  std::shared_ptr<Region> m_region;
+};
+
+// created by the first thread of a run before the threads start together,
+// and destroyed by it after they stop together
+std::unique_ptr<ClientStack> clientStack;
+
+/**
+ * Times the operations of one benchmark thread and reports the percentiles
+ * of their latencies, averaged over the threads.
+ */
+class LatencyRecorder {
+ public:
+  LatencyRecorder() { m_latencies.reserve(1 << 16); }
+
+  template <typename Operation>
+  inline void time(Operation operation) {
+    const auto start = std::chrono::steady_clock::now();
+    operation();
+    m_latencies.push_back(std::chrono::steady_clock::now() - start);
+  }
+
+  void report(benchmark::State& state) {
+    if (m_latencies.empty()) {
+      return;
+    }
+    std::sort(m_latencies.begin(), m_latencies.end());
+    state.counters["p50_us"] = percentile(0.50);
+    state.counters["p90_us"] = percentile(0.90);
+    state.counters["p99_us"] = percentile(0.99);
+  }
+
+ private:
+  benchmark::Counter percentile(double fraction) const {
+    const auto index = static_cast<size_t>(
+        fraction * static_cast<double>(m_latencies.size() - 1));
+    const std::chrono::duration<double, std::micro> latency =
+        m_latencies[index];
+    return benchmark::Counter(latency.count(),
+                              benchmark::Counter::kAvgThreads);
+  }
+
+  std::vector<std::chrono::steady_clock::duration> m_latencies;
+};
+
+std::vector<std::shared_ptr<CacheableKey>> makeKeys(const std::string& prefix,
+                                                    int32_t count) {
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  keys.reserve(static_cast<size_t>(count));
+  for (int32_t i = 0; i < count; i++) {
+    keys.push_back(CacheableString::create(prefix + std::to_string(i)));
+  }
+  return keys;
+}
+
+std::shared_ptr<CacheableString> makeValue() {
+  return CacheableString::create(std::string(64, 'v'));
+}
+
+void populate(const std::vector<std::shared_ptr<CacheableKey>>& keys) {
+  HashMapOfCacheable entries;
+  for (const auto& key : keys) {
+    entries.emplace(key, makeValue());
+  }
+  clientStack->region().putAll(entries);
+}
+
+}  // namespace
+
+void ClientStackPutBM(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    clientStack.reset(new ClientStack(static_cast<int>(state.range(0))));
+  }
+  const auto keys =
+      makeKeys("key-" + std::to_string(state.thread_index) + "-", kEntryCount);
+  const auto value = makeValue();
+  LatencyRecorder recorder;
+
+  size_t next = 0;
+  for (auto _ : state) {
+    const auto& key = keys[next++ % keys.size()];
+    recorder.time([&]() { clientStack->region().put(key, value); });
+  }
+  state.SetItemsProcessed(state.iterations());
+  recorder.report(state);
+
+  if (state.thread_index == 0) {
+    clientStack.reset();
+  }
+}
+
+void ClientStackGetBM(benchmark::State& state) {
+  const auto keys = makeKeys("key-", kEntryCount);
+  if (state.thread_index == 0) {
+    clientStack.reset(new ClientStack(static_cast<int>(state.range(0))));
+    populate(keys);
+  }
+  LatencyRecorder recorder;
+
+  size_t next = static_cast<size_t>(state.thread_index);
+  for (auto _ : state) {
+    const auto& key = keys[next++ % keys.size()];
+    recorder.time([&]() {
+      benchmark::DoNotOptimize(clientStack->region().get(key));
+    });
+  }
+  state.SetItemsProcessed(state.iterations());
+  recorder.report(state);
+
+  if (state.thread_index == 0) {
+    clientStack.reset();
+  }
+}
+
+void ClientStackPutAllBM(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    clientStack.reset(new ClientStack(static_cast<int>(state.range(0))));
+  }
+  HashMapOfCacheable entries;
+  for (const auto& key : makeKeys(
+           "key-" + std::to_string(state.thread_index) + "-", kBulkSize)) {
+    entries.emplace(key, makeValue());
+  }
+  LatencyRecorder recorder;
+
+  for (auto _ : state) {
+    recorder.time([&]() { clientStack->region().putAll(entries); });
+  }
+  state.SetItemsProcessed(state.iterations() * kBulkSize);
+  recorder.report(state);
+
+  if (state.thread_index == 0) {
+    clientStack.reset();
+  }
+}
+
+void ClientStackQueryBM(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    clientStack.reset(new ClientStack(static_cast<int>(state.range(0))));
+    populate(makeKeys("key-", kBulkSize));
+  }
+  LatencyRecorder recorder;
+
+  for (auto _ : state) {
+    recorder.time([&]() {
+      auto query = clientStack->cache()
+                       .getQueryService("pool")
+                       ->newQuery("select * from /region");
+      benchmark::DoNotOptimize(query->execute());
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * kBulkSize);
+  recorder.report(state);
+
+  if (state.thread_index == 0) {
+    clientStack.reset();
+  }
+}
+
+// pool sizes by thread counts
+void ClientStackArguments(benchmark::internal::Benchmark* bm) {
+  bm->Arg(1)->Arg(4)->Arg(16)->ThreadRange(1, 16)->UseRealTime();
+}
+
+BENCHMARK(ClientStackPutBM)->Apply(ClientStackArguments);
+BENCHMARK(ClientStackGetBM)->Apply(ClientStackArguments);
+BENCHMARK(ClientStackPutAllBM)->Apply(ClientStackArguments);
+BENCHMARK(ClientStackQueryBM)->Apply(ClientStackArguments);
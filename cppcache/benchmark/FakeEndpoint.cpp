@@ -0,0 +1,126 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FakeEndpoint.hpp"
+
+#include <string>
+
+#include <ace/INET_Addr.h>
+#include <ace/Init_ACE.h>
+#include <ace/OS.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+FakeEndpoint::FakeEndpoint() : m_port(0), m_running(false) { ACE::init(); }
+
+FakeEndpoint::~FakeEndpoint() noexcept { stop(); }
+
+void FakeEndpoint::start() {
+  ACE_INET_Addr address(static_cast<u_short>(0), "localhost");
+  if (m_acceptor.open(address, 1) == -1) {
+    throw GeodeIOException(
+        std::string("FakeEndpoint::start: failed to listen on localhost: ") +
+        ACE_OS::strerror(ACE_OS::last_error()));
+  }
+  m_acceptor.get_local_addr(address);
+  m_port = address.get_port_number();
+
+  m_running = true;
+  m_acceptThread = std::thread(&FakeEndpoint::accept, this);
+}
+
+void FakeEndpoint::stop() {
+  if (!m_running.exchange(false)) {
+    return;
+  }
+  m_acceptThread.join();
+  m_acceptor.close();
+
+  std::vector<std::unique_ptr<Connection>> connections;
+  {
+    std::lock_guard<std::mutex> guard(m_connectionsMutex);
+    // wakes up threads blocked reading the next request
+    for (const auto& connection : m_connections) {
+      if (!connection->closed) {
+        connection->stream.close_reader();
+      }
+    }
+    connections.swap(m_connections);
+  }
+  for (const auto& connection : connections) {
+    connection->thread.join();
+  }
+}
+
+void FakeEndpoint::accept() {
+  while (m_running) {
+    std::unique_ptr<Connection> connection(new Connection());
+    // wakes up regularly to notice stop()
+    ACE_Time_Value timeout(0, 100 * 1000);
+    if (m_acceptor.accept(connection->stream, nullptr, &timeout) == -1) {
+      continue;
+    }
+
+    int32_t noDelay = 1;
+    ACE_OS::setsockopt(connection->stream.get_handle(), IPPROTO_TCP,
+                       TCP_NODELAY, reinterpret_cast<const char*>(&noDelay),
+                       sizeof(noDelay));
+
+    std::lock_guard<std::mutex> guard(m_connectionsMutex);
+    for (auto i = m_connections.begin(); i != m_connections.end();) {
+      if ((*i)->closed) {
+        (*i)->thread.join();
+        i = m_connections.erase(i);
+      } else {
+        ++i;
+      }
+    }
+
+    auto accepted = connection.get();
+    accepted->thread = std::thread([this, accepted]() {
+      serve(accepted->stream);
+      closeConnection(*accepted);
+    });
+    m_connections.push_back(std::move(connection));
+  }
+}
+
+void FakeEndpoint::closeConnection(Connection& connection) {
+  std::lock_guard<std::mutex> guard(m_connectionsMutex);
+  connection.stream.close();
+  connection.closed = true;
+}
+
+bool FakeEndpoint::receive(ACE_SOCK_Stream& stream, void* buffer,
+                           size_t length) {
+  return length == 0 ||
+         stream.recv_n(buffer, length) == static_cast<ssize_t>(length);
+}
+
+bool FakeEndpoint::send(ACE_SOCK_Stream& stream, const DataOutput& output) {
+  const auto length = output.getBufferLength();
+  return stream.send_n(output.getBuffer(), length) ==
+         static_cast<ssize_t>(length);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_FAKEENDPOINT_H_
+#define GEODE_FAKEENDPOINT_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ace/SOCK_Acceptor.h>
+#include <ace/SOCK_Stream.h>
+
+#include <geode/DataOutput.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A TCP listener on localhost serving every accepted connection on a thread
+ * of its own, the base of the in-process stand-ins for a locator and a cache
+ * server that let benchmarks run the client stack without a cluster.
+ *
+ * Subclasses must call stop() in their destructor, before the state serve()
+ * uses goes away.
+ */
+class FakeEndpoint {
+ public:
+  virtual ~FakeEndpoint() noexcept;
+
+  FakeEndpoint(const FakeEndpoint&) = delete;
+  FakeEndpoint& operator=(const FakeEndpoint&) = delete;
+
+  /**
+   * Starts listening on an ephemeral port of localhost. Throws
+   * GeodeIOException if the port cannot be opened.
+   */
+  void start();
+
+  /** Disconnects every client and waits for their threads to finish. */
+  void stop();
+
+  /** The port listened on; 0 until started. */
+  inline uint16_t getPort() const { return m_port; }
+
+ protected:
+  FakeEndpoint();
+
+  /** Serves a connection until it is to be closed. */
+  virtual void serve(ACE_SOCK_Stream& stream) = 0;
+
+  /** Returns false if the connection closed before length bytes arrived. */
+  static bool receive(ACE_SOCK_Stream& stream, void* buffer, size_t length);
+
+  /** Returns false if the connection failed before everything was sent. */
+  static bool send(ACE_SOCK_Stream& stream, const DataOutput& output);
+
+ private:
+  struct Connection {
+    ACE_SOCK_Stream stream;
+    std::thread thread;
+    bool closed = false;
+  };
+
+  void accept();
+
+  void closeConnection(Connection& connection);
+
+  ACE_SOCK_Acceptor m_acceptor;
+  uint16_t m_port;
+  std::atomic<bool> m_running;
+  std::thread m_acceptThread;
+  std::mutex m_connectionsMutex;
+  std::vector<std::unique_ptr<Connection>> m_connections;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_FAKEENDPOINT_H_
@@ -0,0 +1,100 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FakeLocator.hpp"
+
+#include <utility>
+
+#include <geode/internal/DSCode.hpp>
+#include <geode/internal/DSFixedId.hpp>
+
+#include "DataOutputInternal.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using internal::DSCode;
+using internal::DSFid;
+
+namespace {
+
+void writeServerLocation(DataOutput& output, uint16_t port) {
+  output.writeString("localhost");
+  output.writeInt(static_cast<int32_t>(port));
+}
+
+}  // namespace
+
+FakeLocator::FakeLocator(std::vector<uint16_t> serverPorts)
+    : m_serverPorts(std::move(serverPorts)), m_nextServer(0) {}
+
+FakeLocator::~FakeLocator() noexcept { stop(); }
+
+void FakeLocator::serve(ACE_SOCK_Stream& stream) {
+  // the gossip version and the fixed id header of the request; the rest of
+  // it does not change the answer
+  uint8_t header[6];
+  if (!receive(stream, header, sizeof(header)) ||
+      static_cast<DSCode>(header[4]) != DSCode::FixedIDByte) {
+    return;
+  }
+
+  DataOutputInternal response;
+  response.write(static_cast<int8_t>(DSCode::FixedIDByte));
+  switch (static_cast<DSFid>(static_cast<int8_t>(header[5]))) {
+    case DSFid::ClientConnectionRequest:
+    case DSFid::ClientReplacementRequest:
+      response.write(static_cast<int8_t>(DSFid::ClientConnectionResponse));
+      response.writeBoolean(!m_serverPorts.empty());
+      if (!m_serverPorts.empty()) {
+        writeServerLocation(
+            response, m_serverPorts[m_nextServer++ % m_serverPorts.size()]);
+      }
+      break;
+    case DSFid::LocatorListRequest:
+      response.write(static_cast<int8_t>(DSFid::LocatorListResponse));
+      response.writeInt(static_cast<int32_t>(1));
+      writeServerLocation(response, getPort());
+      response.writeBoolean(false);  // not balanced
+      break;
+    case DSFid::GetAllServersRequest:
+      response.write(static_cast<int8_t>(DSFid::GetAllServersResponse));
+      response.writeInt(static_cast<int32_t>(m_serverPorts.size()));
+      for (const auto port : m_serverPorts) {
+        writeServerLocation(response, port);
+      }
+      break;
+    default:
+      return;
+  }
+  if (!send(stream, response)) {
+    return;
+  }
+
+  // the client reads until the connection closes, but closing it with the
+  // rest of the request unread could reset it before the response is read,
+  // so only the sending side is shut until the client is done
+  stream.close_writer();
+  char drain[1024];
+  while (stream.recv(drain, sizeof(drain)) > 0) {
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,56 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_FAKELOCATOR_H_
+#define GEODE_FAKELOCATOR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "FakeEndpoint.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Answers the locator requests of a pool with servers listening on
+ * localhost, handing them out to new connections in turn. Queue connection
+ * requests, made for subscriptions, are not answered.
+ */
+class FakeLocator : public FakeEndpoint {
+ public:
+  explicit FakeLocator(std::vector<uint16_t> serverPorts);
+
+  ~FakeLocator() noexcept override;
+
+ protected:
+  void serve(ACE_SOCK_Stream& stream) override;
+
+ private:
+  const std::vector<uint16_t> m_serverPorts;
+  std::atomic<size_t> m_nextServer;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_FAKELOCATOR_H_
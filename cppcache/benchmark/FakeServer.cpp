@@ -0,0 +1,466 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FakeServer.hpp"
+
+#include <chrono>
+#include <regex>
+
+#include <ace/INET_Addr.h>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/internal/DSCode.hpp>
+#include <geode/internal/DSFixedId.hpp>
+
+#include "DataInputInternal.hpp"
+#include "DataOutputInternal.hpp"
+#include "TcrConnection.hpp"
+#include "TcrMessage.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using internal::DSCode;
+using internal::DSFid;
+
+namespace {
+
+const size_t kHeaderLength = 17;
+
+// values stored as raw bytes are byte arrays to the client
+void writeAsObject(DataOutput& output, int8_t isObject,
+                   const std::string& bytes) {
+  if (isObject != 1) {
+    output.write(static_cast<int8_t>(DSCode::CacheableBytes));
+    output.writeArrayLen(static_cast<int32_t>(bytes.length()));
+  }
+  output.writeBytesOnly(reinterpret_cast<const uint8_t*>(bytes.data()),
+                        bytes.length());
+}
+
+// the membership id of a server as ClientProxyMembershipID::fromData reads
+// it, which is not the form the client writes for itself
+void writeMemberId(DataOutput& output, uint16_t port) {
+  output.write(static_cast<int8_t>(DSCode::FixedIDByte));
+  output.write(static_cast<int8_t>(DSCode::InternalDistributedMember));
+  output.writeArrayLen(4);
+  output.writeInt(static_cast<int32_t>(
+      ACE_INET_Addr(port, "localhost").get_ip_address()));
+  output.writeInt(static_cast<int32_t>(port));
+  output.writeString("localhost");
+  output.write(static_cast<int8_t>(0));         // flags, no version follows
+  output.writeInt(static_cast<int32_t>(port));  // direct channel port
+  output.writeInt(static_cast<int32_t>(0));     // process id
+  // a loner, so that the unique tag need not be a view id
+  output.write(static_cast<int8_t>(13));
+  output.writeArrayLen(0);  // roles
+  output.writeString("FakeServer");
+  output.writeString("FakeServer" + std::to_string(port));
+  // durable client id and timeout
+  output.writeString("");
+  output.writeInt(static_cast<int32_t>(0));
+  // the UUID and weight, which the client skips
+  output.writeInt(static_cast<int64_t>(0));
+  output.writeInt(static_cast<int64_t>(0));
+  output.write(static_cast<int8_t>(0));
+}
+
+void writeVersionedObjectPartListHeader(DataOutput& output, int8_t flags) {
+  output.write(static_cast<int8_t>(DSCode::FixedIDByte));
+  output.write(static_cast<int8_t>(DSFid::VersionedObjectPartList));
+  output.write(flags);
+}
+
+}  // namespace
+
+/**
+ * Collects the parts of a reply, then sends them as a message or as the
+ * single chunk of a chunked message.
+ */
+class FakeServer::Reply {
+ public:
+  Reply() : m_count(0) {}
+
+  void addPart(int8_t isObject, const uint8_t* bytes, size_t length) {
+    m_parts.writeInt(static_cast<int32_t>(length));
+    m_parts.write(isObject);
+    if (length > 0) {
+      m_parts.writeBytesOnly(bytes, length);
+    }
+    ++m_count;
+  }
+
+  void addPart(int8_t isObject, const std::string& bytes) {
+    addPart(isObject, reinterpret_cast<const uint8_t*>(bytes.data()),
+            bytes.length());
+  }
+
+  void addPart(int8_t isObject, const DataOutput& output) {
+    addPart(isObject, output.getBuffer(), output.getBufferLength());
+  }
+
+  void addBytePart(int8_t value) {
+    m_parts.writeInt(static_cast<int32_t>(1));
+    m_parts.write(static_cast<int8_t>(0));
+    m_parts.write(value);
+    ++m_count;
+  }
+
+  void addIntPart(int32_t value) {
+    m_parts.writeInt(static_cast<int32_t>(4));
+    m_parts.write(static_cast<int8_t>(0));
+    m_parts.writeInt(value);
+    ++m_count;
+  }
+
+  bool send(ACE_SOCK_Stream& stream, int32_t type,
+            int32_t transactionId) const {
+    DataOutputInternal message;
+    message.writeInt(type);
+    message.writeInt(static_cast<int32_t>(m_parts.getBufferLength()));
+    message.writeInt(m_count);
+    message.writeInt(transactionId);
+    message.write(static_cast<int8_t>(0));
+    message.writeBytesOnly(m_parts.getBuffer(), m_parts.getBufferLength());
+    return FakeEndpoint::send(stream, message);
+  }
+
+  bool sendChunked(ACE_SOCK_Stream& stream, int32_t type,
+                   int32_t transactionId) const {
+    DataOutputInternal message;
+    message.writeInt(type);
+    message.writeInt(m_count);
+    message.writeInt(transactionId);
+    message.writeInt(static_cast<int32_t>(m_parts.getBufferLength()));
+    message.write(static_cast<int8_t>(0x01));  // last chunk
+    message.writeBytesOnly(m_parts.getBuffer(), m_parts.getBufferLength());
+    return FakeEndpoint::send(stream, message);
+  }
+
+ private:
+  DataOutputInternal m_parts;
+  int32_t m_count;
+};
+
+FakeServer::FakeServer() : FakeServer(std::make_shared<Store>()) {}
+
+FakeServer::FakeServer(std::shared_ptr<Store> store)
+    : m_store(std::move(store)) {}
+
+FakeServer::~FakeServer() noexcept { stop(); }
+
+size_t FakeServer::size(const std::string& path) { return m_store->size(path); }
+
+size_t FakeServer::Store::size(const std::string& path) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  const auto found = m_regions.find(path);
+  if (found == m_regions.end()) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> regionGuard(found->second->mutex);
+  return found->second->entries.size();
+}
+
+void FakeServer::serve(ACE_SOCK_Stream& stream) {
+  if (!handshake(stream)) {
+    return;
+  }
+
+  Message request;
+  bool served = true;
+  while (served && readMessage(stream, request)) {
+    try {
+      switch (request.type) {
+        case TcrMessage::PING: {
+          Reply reply;
+          reply.addBytePart(0);
+          served = reply.send(stream, TcrMessage::REPLY, request.transactionId);
+          break;
+        }
+        case TcrMessage::PUT:
+          served = put(stream, request);
+          break;
+        case TcrMessage::REQUEST:
+          served = get(stream, request);
+          break;
+        case TcrMessage::PUTALL:
+        case TcrMessage::PUT_ALL_WITH_CALLBACK:
+          served = putAll(stream, request);
+          break;
+        case TcrMessage::QUERY:
+          served = query(stream, request);
+          break;
+        case TcrMessage::GET_CLIENT_PARTITION_ATTRIBUTES: {
+          // a bucket count of -1 tells the client the region is not
+          // partitioned
+          DataOutputInternal bucketCount;
+          bucketCount.write(static_cast<int8_t>(DSCode::CacheableInt32));
+          bucketCount.writeInt(static_cast<int32_t>(-1));
+          Reply reply;
+          reply.addPart(1, bucketCount);
+          reply.addPart(0, nullptr, 0);  // not colocated
+          served = reply.send(stream,
+                              TcrMessage::RESPONSE_CLIENT_PARTITION_ATTRIBUTES,
+                              request.transactionId);
+          break;
+        }
+        case TcrMessage::GET_CLIENT_PR_METADATA:
+          served = Reply().send(stream, TcrMessage::RESPONSE_CLIENT_PR_METADATA,
+                                request.transactionId);
+          break;
+        default:
+          // including CLOSE_CONNECTION
+          served = false;
+          break;
+      }
+    } catch (const Exception&) {
+      // a request the fake cannot decode
+      served = false;
+    }
+  }
+}
+
+bool FakeServer::handshake(ACE_SOCK_Stream& stream) {
+  // connection type, version ordinal, REPLY_OK, read timeout and the fixed
+  // id header of the client's membership id
+  uint8_t header[9];
+  if (!receive(stream, header, sizeof(header)) ||
+      header[0] != CLIENT_TO_SERVER) {
+    return false;
+  }
+
+  uint8_t lengthCode;
+  if (!receive(stream, &lengthCode, 1)) {
+    return false;
+  }
+  int32_t idLength = lengthCode;
+  if (lengthCode == 0xFE || lengthCode == 0xFD) {
+    uint8_t length[4];
+    const size_t size = lengthCode == 0xFE ? 2 : 4;
+    if (!receive(stream, length, size)) {
+      return false;
+    }
+    DataInputInternal input(length, size);
+    idLength = size == 2 ? static_cast<uint16_t>(input.readInt16())
+                         : input.readInt32();
+  } else if (lengthCode == 0xFF) {
+    idLength = 0;
+  }
+
+  // the membership id, a constant 1, the overrides and the security mode
+  std::vector<uint8_t> rest(static_cast<size_t>(idLength) + 6);
+  if (idLength < 0 || !receive(stream, rest.data(), rest.size())) {
+    return false;
+  }
+  const bool secure = rest.back() != SECURITY_CREDENTIALS_NONE;
+  std::string message;
+  if (secure) {
+    // the client prints the message as a C string
+    message = "FakeServer does not support security";
+    message.push_back('\0');
+  }
+
+  DataOutputInternal reply;
+  reply.write(static_cast<int8_t>(secure ? REPLY_REFUSED : REPLY_OK));
+  reply.write(static_cast<int8_t>(0));  // no subscription queue
+  reply.writeInt(static_cast<int32_t>(0));
+  DataOutputInternal member;
+  writeMemberId(member, getPort());
+  reply.writeBytes(member.getBuffer(),
+                   static_cast<int32_t>(member.getBufferLength()));
+  reply.writeInt(static_cast<int16_t>(message.length()));
+  reply.writeBytesOnly(reinterpret_cast<const uint8_t*>(message.data()),
+                       message.length());
+  reply.write(static_cast<int8_t>(0));  // deltas and compression disabled
+  return send(stream, reply) && !secure;
+}
+
+bool FakeServer::readMessage(ACE_SOCK_Stream& stream, Message& message) {
+  uint8_t header[kHeaderLength];
+  if (!receive(stream, header, sizeof(header))) {
+    return false;
+  }
+  DataInputInternal input(header, sizeof(header));
+  message.type = input.readInt32();
+  const auto length = input.readInt32();
+  const auto count = input.readInt32();
+  message.transactionId = input.readInt32();
+  if (length < 0 || count < 0) {
+    return false;
+  }
+
+  message.payload.resize(static_cast<size_t>(length));
+  if (!receive(stream, message.payload.data(), message.payload.size())) {
+    return false;
+  }
+
+  message.parts.clear();
+  DataInputInternal parts(message.payload.data(), message.payload.size());
+  for (int32_t i = 0; i < count; i++) {
+    if (parts.getBytesRemaining() < 5) {
+      return false;
+    }
+    Part part;
+    part.length = parts.readInt32();
+    part.isObject = parts.read();
+    part.bytes = parts.currentBufferPosition();
+    if (part.length < 0 ||
+        static_cast<size_t>(part.length) > parts.getBytesRemaining()) {
+      return false;
+    }
+    parts.advanceCursor(part.length);
+    message.parts.push_back(part);
+  }
+  return true;
+}
+
+FakeServer::Region& FakeServer::getRegion(const std::string& path) {
+  return m_store->getRegion(path);
+}
+
+FakeServer::Region& FakeServer::Store::getRegion(const std::string& path) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  auto& region = m_regions[path];
+  if (!region) {
+    region.reset(new Region());
+  }
+  return *region;
+}
+
+bool FakeServer::put(ACE_SOCK_Stream& stream, const Message& request) {
+  // region, operation, flags, key, is delta, value, event id[, callback]
+  if (request.parts.size() < 6) {
+    return false;
+  }
+  const auto& value = request.parts[5];
+  auto& region = getRegion(request.parts[0].toString());
+  {
+    std::lock_guard<std::mutex> guard(region.mutex);
+    region.entries[request.parts[3].toString()] =
+        Value{value.isObject, value.toString()};
+  }
+
+  Reply reply;
+  reply.addBytePart(0);  // no metadata refresh
+  reply.addIntPart(0);   // no old value or version tag
+  return reply.send(stream, TcrMessage::REPLY, request.transactionId);
+}
+
+bool FakeServer::get(ACE_SOCK_Stream& stream, const Message& request) {
+  // region, key[, callback]
+  if (request.parts.size() < 2) {
+    return false;
+  }
+  auto& region = getRegion(request.parts[0].toString());
+
+  Reply reply;
+  {
+    std::lock_guard<std::mutex> guard(region.mutex);
+    const auto found = region.entries.find(request.parts[1].toString());
+    if (found == region.entries.end()) {
+      reply.addPart(0, nullptr, 0);
+    } else {
+      reply.addPart(found->second.isObject, found->second.bytes);
+    }
+  }
+  reply.addIntPart(0);  // no callback argument or version tag
+  return reply.send(stream, TcrMessage::RESPONSE, request.transactionId);
+}
+
+bool FakeServer::putAll(ACE_SOCK_Stream& stream, const Message& request) {
+  // region, event id, 0, flags, count[, callback], keys and values[, timeout]
+  const size_t first =
+      request.type == TcrMessage::PUT_ALL_WITH_CALLBACK ? 6 : 5;
+  if (request.parts.size() < first) {
+    return false;
+  }
+  const auto& countPart = request.parts[4];
+  const auto count =
+      DataInputInternal(countPart.bytes, countPart.length).readInt32();
+  if (count < 0 ||
+      request.parts.size() < first + 2 * static_cast<size_t>(count)) {
+    return false;
+  }
+
+  auto& region = getRegion(request.parts[0].toString());
+  {
+    std::lock_guard<std::mutex> guard(region.mutex);
+    for (size_t i = first; i < first + 2 * static_cast<size_t>(count);
+         i += 2) {
+      const auto& value = request.parts[i + 1];
+      region.entries[request.parts[i].toString()] =
+          Value{value.isObject, value.toString()};
+    }
+  }
+
+  // no version tags to report
+  DataOutputInternal list;
+  writeVersionedObjectPartListHeader(list, 0);
+  Reply reply;
+  reply.addPart(1, list);
+  return reply.sendChunked(stream, TcrMessage::RESPONSE,
+                           request.transactionId);
+}
+
+bool FakeServer::query(ACE_SOCK_Stream& stream, const Message& request) {
+  // query, event id[, timeout]
+  static const std::regex from("\\bfrom\\s+/?(\\S+)", std::regex::icase);
+  if (request.parts.empty()) {
+    return false;
+  }
+  const auto queryString = request.parts[0].toString();
+  std::smatch match;
+  if (!std::regex_search(queryString, match, from)) {
+    return false;
+  }
+  auto& region = getRegion("/" + match[1].str());
+
+  // a collection of java.lang.Object, making the results a ResultSet
+  DataOutputInternal type;
+  type.write(static_cast<int8_t>(DSCode::FixedIDByte));
+  type.write(static_cast<int8_t>(DSFid::CollectionTypeImpl));
+  type.write(static_cast<int8_t>(DSCode::Class));
+  type.writeString(
+      "org.apache.geode.cache.query.internal.types.CollectionTypeImpl");
+  type.write(static_cast<int8_t>(DSCode::FixedIDByte));
+  type.write(static_cast<int8_t>(DSCode::DataSerializable));
+  type.write(static_cast<int8_t>(DSCode::Class));
+  type.writeString("java.lang.Object");
+
+  DataOutputInternal results;
+  results.write(static_cast<int8_t>(DSCode::CacheableObjectArray));
+  {
+    std::lock_guard<std::mutex> guard(region.mutex);
+    results.writeArrayLen(static_cast<int32_t>(region.entries.size()));
+    results.write(static_cast<int8_t>(DSCode::Class));
+    results.writeString("java.lang.Object");
+    for (const auto& entry : region.entries) {
+      writeAsObject(results, entry.second.isObject, entry.second.bytes);
+    }
+  }
+
+  Reply reply;
+  reply.addPart(1, type);
+  reply.addPart(1, results);
+  return reply.sendChunked(stream, TcrMessage::RESPONSE,
+                           request.transactionId);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
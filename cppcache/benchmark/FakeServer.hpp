@@ -0,0 +1,141 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_FAKESERVER_H_
+#define GEODE_FAKESERVER_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "FakeEndpoint.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Speaks just enough of the cache server protocol for a pool to connect
+ * and run region operations against replicated regions: the handshake, PUT,
+ * REQUEST (get), PUT_ALL, QUERY, PING and the partition metadata requests
+ * sent when a region is created.
+ *
+ * Every region path names a region, created empty on first use. Servers
+ * built on the same Store see the same regions, like the members of one
+ * cluster replicating every region. Keys and
+ * values are kept exactly as the client serialized them, so any type can be
+ * stored, but key equality is byte equality. A query returns every value of
+ * the region named after FROM; the rest of the query is ignored.
+ * Subscriptions, security, transactions and deltas are not supported, and
+ * any other request closes the connection.
+ */
+class FakeServer : public FakeEndpoint {
+ public:
+  class Store;
+
+  /** Creates a server with regions of its own. */
+  FakeServer();
+
+  /** Creates a server sharing the regions in store. */
+  explicit FakeServer(std::shared_ptr<Store> store);
+
+  ~FakeServer() noexcept override;
+
+  /** Returns the number of entries stored in the region at path. */
+  size_t size(const std::string& path);
+
+ protected:
+  void serve(ACE_SOCK_Stream& stream) override;
+
+ private:
+  struct Part {
+    int8_t isObject;
+    const uint8_t* bytes;
+    int32_t length;
+
+    inline std::string toString() const {
+      return std::string(reinterpret_cast<const char*>(bytes), length);
+    }
+  };
+
+  struct Message {
+    int32_t type;
+    int32_t transactionId;
+    std::vector<uint8_t> payload;
+    std::vector<Part> parts;
+  };
+
+  struct Value {
+    int8_t isObject;
+    std::string bytes;
+  };
+
+  struct Region {
+    std::mutex mutex;
+    std::unordered_map<std::string, Value> entries;
+  };
+
+  class Reply;
+
+  bool handshake(ACE_SOCK_Stream& stream);
+
+  static bool readMessage(ACE_SOCK_Stream& stream, Message& message);
+
+  Region& getRegion(const std::string& path);
+
+  bool put(ACE_SOCK_Stream& stream, const Message& request);
+
+  bool get(ACE_SOCK_Stream& stream, const Message& request);
+
+  bool putAll(ACE_SOCK_Stream& stream, const Message& request);
+
+  bool query(ACE_SOCK_Stream& stream, const Message& request);
+
+  std::shared_ptr<Store> m_store;
+};
+
+/**
+ * The regions of one or more fake servers.
+ */
+class FakeServer::Store {
+ public:
+  Store() = default;
+
+  Store(const Store&) = delete;
+  Store& operator=(const Store&) = delete;
+
+ private:
+  Region& getRegion(const std::string& path);
+
+  size_t size(const std::string& path);
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, std::unique_ptr<Region>> m_regions;
+
+  friend class FakeServer;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_FAKESERVER_H_
@@ -19,11 +19,13 @@
 
 #include <geode/CacheableString.hpp>
 
+#include "util/JavaModifiedUtf8.hpp"
 #include "util/string.hpp"
 
 using apache::geode::client::to_utf16;
 using apache::geode::client::to_utf8;
 using apache::geode::client::internal::geode_hash;
+using apache::geode::client::internal::JavaModifiedUtf8;
 
 template <class ToString, class FromString>
 ToString convert(const FromString& from);
@@ -49,6 +51,30 @@ void GeodeHashBM(benchmark::State& state) {
   }
 }
 
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8EncodeBM(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const std::string string = convert<std::string>(u32String);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::fromString(string));
+  }
+  state.SetBytesProcessed(state.iterations() * string.length());
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8DecodeBM(benchmark::State& state) {
+  const std::u32string u32String(state.range(0), UnicodeChar);
+  const auto encoded =
+      JavaModifiedUtf8::fromString(convert<std::string>(u32String));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        JavaModifiedUtf8::decodeToUtf8(encoded.data(), encoded.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+
 constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
 constexpr char32_t INVERTED_EXCLAMATION_MARK = U'\U000000A1';
 constexpr char32_t SAMARITAN_PUNCTUATION_ZIQAA = U'\U00000838';
@@ -70,3 +96,16 @@ BENCHMARK_TEMPLATE(GeodeHashBM, std::string, LINEAR_B_SYLLABLE_B008_A)
     ->Range(8, 8 << 10);
 BENCHMARK_TEMPLATE(GeodeHashBM, std::u16string, LINEAR_B_SYLLABLE_B008_A)
     ->Range(8, 8 << 10);
+
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeBM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, LINEAR_B_SYLLABLE_B008_A)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeBM, LINEAR_B_SYLLABLE_B008_A)
+    ->Range(8, 8 << 10);
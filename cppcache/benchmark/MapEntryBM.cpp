@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "LRUMapEntry.hpp"
+#include "MapEntryPool.hpp"
+#include "MapEntryT.hpp"
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::MapEntryImpl;
+using apache::geode::client::MapEntryPool;
+using apache::geode::client::MapEntryT;
+using apache::geode::client::VersionedLRUMapEntry;
+using apache::geode::client::VersionedMapEntryImpl;
+
+std::vector<std::shared_ptr<CacheableKey>> makeKeys(int64_t count) {
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  keys.reserve(static_cast<size_t>(count));
+  for (int32_t i = 0; i < count; i++) {
+    keys.push_back(CacheableInt32::create(i));
+  }
+  return keys;
+}
+
+template <class TBase>
+void MapEntryHeapBM(benchmark::State& state) {
+  const auto keys = makeKeys(state.range(0));
+  std::vector<std::shared_ptr<MapEntryImpl>> entries;
+  entries.reserve(keys.size());
+
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      entries.push_back(MapEntryT<TBase, 0, 0>::create(key));
+    }
+    entries.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class TBase>
+void MapEntryPooledBM(benchmark::State& state) {
+  const auto keys = makeKeys(state.range(0));
+  std::vector<std::shared_ptr<MapEntryImpl>> entries;
+  entries.reserve(keys.size());
+  auto pool = new MapEntryPool();
+
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      entries.push_back(MapEntryT<TBase, 0, 0>::create(pool, key));
+    }
+    entries.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+
+  pool->close();
+}
+
+BENCHMARK_TEMPLATE(MapEntryHeapBM, VersionedMapEntryImpl)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(MapEntryPooledBM, VersionedMapEntryImpl)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(MapEntryHeapBM, VersionedLRUMapEntry)->Range(8, 8 << 12);
+BENCHMARK_TEMPLATE(MapEntryPooledBM, VersionedLRUMapEntry)->Range(8, 8 << 12);
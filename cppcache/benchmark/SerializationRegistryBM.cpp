@@ -0,0 +1,117 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableDate.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/CacheableUndefined.hpp>
+
+#include "DataInputInternal.hpp"
+#include "DataOutputInternal.hpp"
+#include "SerializationRegistry.hpp"
+
+using apache::geode::client::CacheableBoolean;
+using apache::geode::client::CacheableBytes;
+using apache::geode::client::CacheableDate;
+using apache::geode::client::CacheableDouble;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableInt64;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheableUndefined;
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::DataOutputInternal;
+using apache::geode::client::Serializable;
+using apache::geode::client::SerializationRegistry;
+
+std::vector<std::shared_ptr<Serializable>> makeMixedValues(int64_t count) {
+  std::vector<std::shared_ptr<Serializable>> values;
+  values.reserve(static_cast<size_t>(count));
+  for (int32_t i = 0; i < count; i++) {
+    switch (i % 7) {
+      case 0:
+        values.push_back(CacheableInt32::create(i));
+        break;
+      case 1:
+        values.push_back(CacheableInt64::create(i * 1000003LL));
+        break;
+      case 2:
+        values.push_back(CacheableDouble::create(i / 3.0));
+        break;
+      case 3:
+        values.push_back(CacheableString::create("value " + std::to_string(i)));
+        break;
+      case 4:
+        values.push_back(CacheableBoolean::create(i % 2 == 0));
+        break;
+      case 5:
+        values.push_back(CacheableDate::create(static_cast<time_t>(i)));
+        break;
+      default:
+        values.push_back(i % 2 == 0 ? std::shared_ptr<Serializable>(
+                                          CacheableUndefined::create())
+                                    : CacheableBytes::create(
+                                          std::vector<int8_t>(16, 1)));
+        break;
+    }
+  }
+  return values;
+}
+
+void SerializationRegistryDeserializeMixedBM(benchmark::State& state) {
+  SerializationRegistry serializationRegistry;
+  DataOutputInternal output;
+  for (const auto& value : makeMixedValues(state.range(0))) {
+    serializationRegistry.serialize(value, output);
+  }
+
+  for (auto _ : state) {
+    DataInputInternal input(output.getBuffer(), output.getBufferLength());
+    for (int64_t i = 0; i < state.range(0); i++) {
+      benchmark::DoNotOptimize(serializationRegistry.deserialize(input));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * output.getBufferLength());
+}
+
+void SerializationRegistryDeserializeMixedContendedBM(
+    benchmark::State& state) {
+  static SerializationRegistry serializationRegistry;
+  DataOutputInternal output;
+  for (const auto& value : makeMixedValues(state.range(0))) {
+    serializationRegistry.serialize(value, output);
+  }
+
+  for (auto _ : state) {
+    DataInputInternal input(output.getBuffer(), output.getBufferLength());
+    for (int64_t i = 0; i < state.range(0); i++) {
+      benchmark::DoNotOptimize(serializationRegistry.deserialize(input));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(SerializationRegistryDeserializeMixedBM)->Range(8, 8 << 10);
+BENCHMARK(SerializationRegistryDeserializeMixedContendedBM)
+    ->Arg(1024)
+    ->ThreadRange(1, 8);
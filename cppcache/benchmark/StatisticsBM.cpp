@@ -0,0 +1,69 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "statistics/AtomicStatisticsImpl.hpp"
+#include "statistics/StatisticDescriptorImpl.hpp"
+#include "statistics/StatisticsTypeImpl.hpp"
+
+using apache::geode::statistics::AtomicStatisticsImpl;
+using apache::geode::statistics::StatisticDescriptor;
+using apache::geode::statistics::StatisticDescriptorImpl;
+using apache::geode::statistics::StatisticsTypeImpl;
+
+// Laid out like CachePerfStats: adjacent counters bumped by every thread.
+AtomicStatisticsImpl& statistics() {
+  static auto stats = [] {
+    auto descriptors = new StatisticDescriptor*[4];
+    descriptors[0] =
+        StatisticDescriptorImpl::createIntCounter("puts", "", "", true);
+    descriptors[1] =
+        StatisticDescriptorImpl::createIntCounter("gets", "", "", true);
+    descriptors[2] =
+        StatisticDescriptorImpl::createStripedIntCounter("stripedPuts", "",
+                                                         "", true);
+    descriptors[3] =
+        StatisticDescriptorImpl::createStripedIntCounter("stripedGets", "",
+                                                         "", true);
+    auto type = new StatisticsTypeImpl("BenchStats", "", descriptors, 4);
+    return new AtomicStatisticsImpl(type, "bench", 1, 1, nullptr);
+  }();
+  return *stats;
+}
+
+void StatisticsIncrementBM(benchmark::State& state, const char* first,
+                           const char* second) {
+  auto& stats = statistics();
+  const auto firstId = stats.nameToId(first);
+  const auto secondId = stats.nameToId(second);
+  // alternate threads update neighbouring counters, as gets and puts do
+  const auto id = state.thread_index % 2 == 0 ? firstId : secondId;
+
+  for (auto _ : state) {
+    stats.incInt(id, 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(StatisticsIncrementBM, atomic, "puts", "gets")
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(StatisticsIncrementBM, striped, "stripedPuts",
+                  "stripedGets")
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <geode/CacheableString.hpp>
+
+#include "SerializationRegistry.hpp"
+#include "TcrMessage.hpp"
+#include "util/string.hpp"
+
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::DataOutput;
+using apache::geode::client::Region;
+using apache::geode::client::Serializable;
+using apache::geode::client::SerializationRegistry;
+using apache::geode::client::TcrMessagePut;
+using apache::geode::client::TcrMessageRequest;
+using apache::geode::client::ThinClientBaseDM;
+using apache::geode::client::to_utf8;
+
+class BenchmarkDataOutput : public DataOutput {
+ public:
+  explicit BenchmarkDataOutput(const SerializationRegistry& registry)
+      : DataOutput(nullptr, nullptr), m_serializationRegistry(registry) {}
+  ~BenchmarkDataOutput() noexcept override = default;
+
+ protected:
+  const SerializationRegistry& getSerializationRegistry() const override {
+    return m_serializationRegistry;
+  }
+
+ private:
+  const SerializationRegistry& m_serializationRegistry;
+};
+
+template <char32_t KeyChar>
+std::shared_ptr<CacheableKey> makeKey(int64_t length) {
+  return CacheableString::create(
+      to_utf8(std::u32string(static_cast<size_t>(length), KeyChar)));
+}
+
+template <char32_t KeyChar>
+void TcrMessagePutBM(benchmark::State& state) {
+  SerializationRegistry registry;
+  const auto key = makeKey<KeyChar>(state.range(0));
+  const std::shared_ptr<Serializable> value =
+      CacheableString::create("value");
+
+  for (auto _ : state) {
+    TcrMessagePut message(
+        new BenchmarkDataOutput(registry), static_cast<const Region*>(nullptr),
+        key, value, nullptr, false, static_cast<ThinClientBaseDM*>(nullptr),
+        false, false, "region");
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+template <char32_t KeyChar>
+void TcrMessageRequestBM(benchmark::State& state) {
+  SerializationRegistry registry;
+  const auto key = makeKey<KeyChar>(state.range(0));
+
+  for (auto _ : state) {
+    TcrMessageRequest message(new BenchmarkDataOutput(registry),
+                              static_cast<const Region*>(nullptr), key,
+                              nullptr, static_cast<ThinClientBaseDM*>(nullptr));
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+}
+
+constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
+constexpr char32_t INVERTED_EXCLAMATION_MARK = U'\U000000A1';
+
+BENCHMARK_TEMPLATE(TcrMessagePutBM, LATIN_CAPITAL_LETTER_C)->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(TcrMessagePutBM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(TcrMessageRequestBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(TcrMessageRequestBM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
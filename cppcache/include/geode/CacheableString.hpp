@@ -20,6 +20,9 @@
 #ifndef GEODE_CACHEABLESTRING_H_
 #define GEODE_CACHEABLESTRING_H_
 
+#include <atomic>
+#include <vector>
+
 #include "CacheableKey.hpp"
 #include "internal/DSCode.hpp"
 #include "internal/DataSerializablePrimitive.hpp"
@@ -45,16 +48,17 @@ class APACHE_GEODE_EXPORT CacheableString
   std::string m_str;
   DSCode m_type;
   mutable int m_hashcode;
+  mutable std::atomic<const std::vector<int8_t>*> m_serialized;
 
  public:
   inline explicit CacheableString(DSCode type = DSCode::CacheableASCIIString)
-      : m_str(), m_type(type), m_hashcode(0) {}
+      : m_str(), m_type(type), m_hashcode(0), m_serialized(nullptr) {}
 
   inline explicit CacheableString(const std::string& value)
       : CacheableString(std::string(value)) {}
 
   inline explicit CacheableString(std::string&& value)
-      : m_str(std::move(value)), m_hashcode(0) {
+      : m_str(std::move(value)), m_hashcode(0), m_serialized(nullptr) {
     bool ascii = isAscii(m_str);
 
     m_type =
@@ -64,7 +68,7 @@ class APACHE_GEODE_EXPORT CacheableString
             : ascii ? DSCode::CacheableASCIIString : DSCode::CacheableString;
   }
 
-  ~CacheableString() noexcept override = default;
+  ~CacheableString() noexcept override;
 
   void operator=(const CacheableString& other) = delete;
   CacheableString(const CacheableString& other) = delete;
@@ -93,6 +97,14 @@ class APACHE_GEODE_EXPORT CacheableString
   /** return the hashcode for this key. */
   virtual int32_t hashcode() const override;
 
+  /**
+   * Returns the bytes written for this string by DataOutput::writeObject,
+   * including the leading type code. Since the string is immutable these are
+   * computed once, on first use, and shared by all threads thereafter, so a
+   * key sent to the server many times is only encoded once.
+   */
+  const std::vector<int8_t>& serializedForm() const;
+
   inline static std::shared_ptr<CacheableString> create(
       const std::string& value) {
     return std::make_shared<CacheableString>(value);
@@ -114,6 +114,64 @@ class APACHE_GEODE_EXPORT DataInput {
     }
   }
 
+  /**
+   * Read the given number of signed bytes from the <code>DataInput</code>.
+   * Equivalent to <code>readBytesOnly</code>.
+   *
+   * @param values array to hold the elements read from stream
+   * @param len number of elements to be read
+   */
+  inline void readArrayOnly(int8_t* values, size_t len) {
+    readBytesOnly(values, len);
+  }
+
+  /**
+   * Read the given number of 16-bit signed integers from the
+   * <code>DataInput</code>.
+   * @remarks This method is complimentary to
+   *   <code>DataOutput::writeArrayOnly</code> and does not expect the length
+   *   of array in the stream. The buffer size is checked only once and the
+   *   byte order of the whole array is converted in bulk.
+   *
+   * @param values array to hold the elements read from stream
+   * @param len number of elements to be read
+   */
+  void readArrayOnly(int16_t* values, size_t len);
+
+  /**
+   * Read the given number of 32-bit signed integers from the
+   * <code>DataInput</code>.
+   * @see readArrayOnly(int16_t*, size_t)
+   */
+  void readArrayOnly(int32_t* values, size_t len);
+
+  /**
+   * Read the given number of 64-bit signed integers from the
+   * <code>DataInput</code>.
+   * @see readArrayOnly(int16_t*, size_t)
+   */
+  void readArrayOnly(int64_t* values, size_t len);
+
+  /**
+   * Read the given number of floats from the <code>DataInput</code>.
+   * @see readArrayOnly(int16_t*, size_t)
+   */
+  void readArrayOnly(float* values, size_t len);
+
+  /**
+   * Read the given number of double precision numbers from the
+   * <code>DataInput</code>.
+   * @see readArrayOnly(int16_t*, size_t)
+   */
+  void readArrayOnly(double* values, size_t len);
+
+  /**
+   * Read the given number of 16-bit characters from the
+   * <code>DataInput</code>.
+   * @see readArrayOnly(int16_t*, size_t)
+   */
+  void readArrayOnly(char16_t* values, size_t len);
+
   /**
    * Read an array of unsigned bytes from the <code>DataInput</code>
    * expecting to find the length of array in the stream at the start.
@@ -368,7 +426,18 @@ class APACHE_GEODE_EXPORT DataInput {
 
   inline std::vector<char16_t> readCharArray() { return readArray<char16_t>(); }
 
-  inline std::vector<bool> readBooleanArray() { return readArray<bool>(); }
+  inline std::vector<bool> readBooleanArray() {
+    auto arrayLen = readArrayLength();
+    std::vector<bool> objArray;
+    if (arrayLen > 0) {
+      _GEODE_CHECK_BUFFER_SIZE(arrayLen);
+      objArray.reserve(arrayLen);
+      for (int i = 0; i < arrayLen; i++) {
+        objArray.push_back(*(m_buf++) == 1);
+      }
+    }
+    return objArray;
+  }
 
   inline std::vector<int8_t> readByteArray() { return readArray<int8_t>(); }
 
@@ -515,18 +584,17 @@ class APACHE_GEODE_EXPORT DataInput {
   std::vector<T> readArray() {
     auto arrayLen = readArrayLength();
     std::vector<T> objArray;
-    if (arrayLen >= 0) {
-      objArray.reserve(arrayLen);
-      int i = 0;
-      for (i = 0; i < arrayLen; i++) {
-        T tmp = 0;
-        readObject(&tmp);
-        objArray.push_back(tmp);
-      }
+    if (arrayLen > 0) {
+      _GEODE_CHECK_BUFFER_SIZE(arrayLen * sizeof(T));
+      objArray.resize(arrayLen);
+      readArrayOnly(objArray.data(), arrayLen);
     }
     return objArray;
   }
 
+  template <typename T>
+  void readArrayOnlySwapped(T* values, size_t len);
+
   inline char readPdxChar() { return static_cast<char>(readInt16()); }
 
   inline void _checkBufferSize(size_t size, int32_t line) {
@@ -132,6 +132,64 @@ class APACHE_GEODE_EXPORT DataOutput {
     writeBytesOnly(reinterpret_cast<const uint8_t*>(bytes), len);
   }
 
+  /**
+   * Write an array of signed bytes without its length to the
+   * <code>DataOutput</code>. Equivalent to <code>writeBytesOnly</code>.
+   *
+   * @param values the array of signed bytes to be written
+   * @param len the number of elements from the start of array to be written
+   */
+  inline void writeArrayOnly(const int8_t* values, size_t len) {
+    writeBytesOnly(values, len);
+  }
+
+  /**
+   * Write an array of 16-bit signed integers without its length to the
+   * <code>DataOutput</code>.
+   * @remarks The elements are written as if by calling <code>writeInt</code>
+   *   for each one, but the buffer capacity is checked only once and the
+   *   byte order of the whole array is converted in bulk.
+   *
+   * @param values the array of 16-bit signed integers to be written
+   * @param len the number of elements from the start of array to be written
+   */
+  void writeArrayOnly(const int16_t* values, size_t len);
+
+  /**
+   * Write an array of 32-bit signed integers without its length to the
+   * <code>DataOutput</code>.
+   * @see writeArrayOnly(const int16_t*, size_t)
+   */
+  void writeArrayOnly(const int32_t* values, size_t len);
+
+  /**
+   * Write an array of 64-bit signed integers without its length to the
+   * <code>DataOutput</code>.
+   * @see writeArrayOnly(const int16_t*, size_t)
+   */
+  void writeArrayOnly(const int64_t* values, size_t len);
+
+  /**
+   * Write an array of floats without its length to the
+   * <code>DataOutput</code>.
+   * @see writeArrayOnly(const int16_t*, size_t)
+   */
+  void writeArrayOnly(const float* values, size_t len);
+
+  /**
+   * Write an array of double precision real numbers without its length to
+   * the <code>DataOutput</code>.
+   * @see writeArrayOnly(const int16_t*, size_t)
+   */
+  void writeArrayOnly(const double* values, size_t len);
+
+  /**
+   * Write an array of 16-bit characters without its length to the
+   * <code>DataOutput</code>.
+   * @see writeArrayOnly(const int16_t*, size_t)
+   */
+  void writeArrayOnly(const char16_t* values, size_t len);
+
   /**
    * Write a 16-bit unsigned integer value to the <code>DataOutput</code>.
    *
@@ -497,6 +555,9 @@ class APACHE_GEODE_EXPORT DataOutput {
   static void acquireLock();
   static void releaseLock();
 
+  template <class T>
+  void writeArrayOnlySwapped(const T* values, size_t len);
+
   // memory m_buffer to encode to.
   std::unique_ptr<uint8_t[]> m_bytes;
   // cursor.
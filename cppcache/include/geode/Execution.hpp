@@ -26,6 +26,7 @@
 
 #include "CacheableBuiltins.hpp"
 #include "ResultCollector.hpp"
+#include "ResultStream.hpp"
 #include "internal/geode_globals.hpp"
 
 /**
@@ -116,6 +117,17 @@ class APACHE_GEODE_EXPORT Execution {
       const std::shared_ptr<ResultCollector>& rs, const std::string& func,
       std::chrono::milliseconds timeout);
 
+  /**
+   * Executes the function in the background and returns a stream handing
+   * out its results as they arrive, in place of a ResultCollector. Reading
+   * the response pauses while maxBufferedResults results are waiting to be
+   * taken.
+   */
+  std::shared_ptr<ResultStream> stream(
+      const std::string& func,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t maxBufferedResults = ResultStream::DEFAULT_MAX_BUFFERED_RESULTS);
+
  private:
   std::unique_ptr<ExecutionImpl> impl_;
 
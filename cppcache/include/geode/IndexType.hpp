@@ -0,0 +1,48 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_INDEXTYPE_H_
+#define GEODE_INDEXTYPE_H_
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The kinds of index that can be created over the locally cached values of a
+ * region with {@link Region::createIndex}.
+ */
+enum class IndexType {
+  /**
+   * A HASH index answers equality comparisons on the indexed attribute.
+   */
+  HASH,
+
+  /**
+   * A RANGE index keeps the indexed attribute in order and answers equality
+   * as well as &lt;, &lt;=, &gt; and &gt;= comparisons.
+   */
+  RANGE
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_INDEXTYPE_H_
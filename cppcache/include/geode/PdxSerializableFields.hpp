@@ -0,0 +1,256 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXSERIALIZABLEFIELDS_H_
+#define GEODE_PDXSERIALIZABLEFIELDS_H_
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "CacheableDate.hpp"
+#include "DataOutput.hpp"
+#include "PdxReader.hpp"
+#include "PdxSerializable.hpp"
+#include "PdxWriter.hpp"
+#include "Serializer.hpp"
+#include "internal/PdxFieldLayout.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace internal {
+
+/**
+ * How a field of type TValue is written and read: through a PdxWriter and
+ * PdxReader by name, and straight to a DataOutput with the bytes the
+ * PdxWriter would write.
+ */
+template <class TValue>
+struct PdxFieldTraits {
+  static_assert(!std::is_same<TValue, TValue>::value,
+                "unsupported PDX field type");
+};
+
+#define GEODE_PDX_FIELD_TRAITS(TVALUE, PDX_TYPE, VARIABLE_LENGTH, WRITE_DATA) \
+  template <>                                                                 \
+  struct PdxFieldTraits<TVALUE> {                                             \
+    static constexpr bool variableLength = VARIABLE_LENGTH;                   \
+    static void write(PdxWriter& writer, const std::string& name,             \
+                      const TVALUE& value) {                                  \
+      writer.write##PDX_TYPE(name, value);                                    \
+    }                                                                         \
+    static TVALUE read(PdxReader& reader, const std::string& name) {          \
+      return reader.read##PDX_TYPE(name);                                     \
+    }                                                                         \
+    static void write(DataOutput& output, const TVALUE& value) {              \
+      WRITE_DATA;                                                             \
+    }                                                                         \
+  }
+
+GEODE_PDX_FIELD_TRAITS(char16_t, Char, false, output.writeChar(value));
+GEODE_PDX_FIELD_TRAITS(bool, Boolean, false, output.writeBoolean(value));
+GEODE_PDX_FIELD_TRAITS(int8_t, Byte, false, output.write(value));
+GEODE_PDX_FIELD_TRAITS(int16_t, Short, false, output.writeInt(value));
+GEODE_PDX_FIELD_TRAITS(int32_t, Int, false, output.writeInt(value));
+GEODE_PDX_FIELD_TRAITS(int64_t, Long, false, output.writeInt(value));
+GEODE_PDX_FIELD_TRAITS(float, Float, false, output.writeFloat(value));
+GEODE_PDX_FIELD_TRAITS(double, Double, false, output.writeDouble(value));
+GEODE_PDX_FIELD_TRAITS(std::string, String, true, output.writeString(value));
+GEODE_PDX_FIELD_TRAITS(std::vector<bool>, BooleanArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<char16_t>, CharArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<int8_t>, ByteArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<int16_t>, ShortArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<int32_t>, IntArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<int64_t>, LongArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<float>, FloatArray, true,
+                       serializer::writeArrayObject(output, value));
+GEODE_PDX_FIELD_TRAITS(std::vector<double>, DoubleArray, true,
+                       serializer::writeArrayObject(output, value));
+
+#undef GEODE_PDX_FIELD_TRAITS
+
+template <>
+struct PdxFieldTraits<std::shared_ptr<CacheableDate>> {
+  static constexpr bool variableLength = false;
+  static void write(PdxWriter& writer, const std::string& name,
+                    const std::shared_ptr<CacheableDate>& value) {
+    writer.writeDate(name, value);
+  }
+  static std::shared_ptr<CacheableDate> read(PdxReader& reader,
+                                             const std::string& name) {
+    return reader.readDate(name);
+  }
+  static void write(DataOutput& output,
+                    const std::shared_ptr<CacheableDate>& value) {
+    if (value != nullptr) {
+      value->toData(output);
+    } else {
+      output.writeInt(static_cast<uint64_t>(-1L));
+    }
+  }
+};
+
+template <>
+struct PdxFieldTraits<std::vector<std::string>> {
+  static constexpr bool variableLength = true;
+  static void write(PdxWriter& writer, const std::string& name,
+                    const std::vector<std::string>& value) {
+    writer.writeStringArray(name, value);
+  }
+  static std::vector<std::string> read(PdxReader& reader,
+                                       const std::string& name) {
+    return reader.readStringArray(name);
+  }
+  static void write(DataOutput& output, const std::vector<std::string>& value) {
+    output.writeArrayLen(static_cast<int32_t>(value.size()));
+    for (const auto& entry : value) {
+      output.writeString(entry);
+    }
+  }
+};
+
+/** Writes each field of an object through a PdxWriter. */
+template <class TObject>
+class PdxFieldWriter {
+ public:
+  PdxFieldWriter(PdxWriter& writer, const TObject& object)
+      : m_writer(writer), m_object(object) {}
+
+  template <class TValue>
+  void operator()(const char* name, TValue TObject::*field) {
+    PdxFieldTraits<TValue>::write(m_writer, name, m_object.*field);
+  }
+
+ private:
+  PdxWriter& m_writer;
+  const TObject& m_object;
+};
+
+/** Reads each field of an object through a PdxReader. */
+template <class TObject>
+class PdxFieldReader {
+ public:
+  PdxFieldReader(PdxReader& reader, TObject& object)
+      : m_reader(reader), m_object(object) {}
+
+  template <class TValue>
+  void operator()(const char* name, TValue TObject::*field) {
+    m_object.*field = PdxFieldTraits<TValue>::read(m_reader, name);
+  }
+
+ private:
+  PdxReader& m_reader;
+  TObject& m_object;
+};
+
+/** Writes each field of an object straight to a DataOutput. */
+template <class TObject>
+class PdxFieldDataWriter {
+ public:
+  PdxFieldDataWriter(DataOutput& output, size_t fieldsStart,
+                     std::vector<int32_t>& varLenOffsets,
+                     const TObject& object)
+      : m_output(output),
+        m_fieldsStart(fieldsStart),
+        m_varLenOffsets(varLenOffsets),
+        m_object(object) {}
+
+  template <class TValue>
+  void operator()(const char*, TValue TObject::*field) {
+    if (PdxFieldTraits<TValue>::variableLength) {
+      m_varLenOffsets.push_back(
+          static_cast<int32_t>(m_output.getBufferLength() - m_fieldsStart));
+    }
+    PdxFieldTraits<TValue>::write(m_output, m_object.*field);
+  }
+
+ private:
+  DataOutput& m_output;
+  size_t m_fieldsStart;
+  std::vector<int32_t>& m_varLenOffsets;
+  const TObject& m_object;
+};
+
+}  // namespace internal
+
+/**
+ * A PdxSerializable whose fields are listed once, at compile time, by a
+ * public static member function template of TObject that passes the name
+ * and member pointer of each field, in order, to its argument:
+ *
+ * @code
+ * class Order : public PdxSerializableFields<Order> {
+ *  public:
+ *   template <class TFields>
+ *   static void pdxFields(TFields& fields) {
+ *     fields("id", &Order::id_);
+ *     fields("name", &Order::name_);
+ *   }
+ *   ...
+ * };
+ * @endcode
+ *
+ * toData and fromData are generated from the list. Once the PdxType of
+ * TObject is known, serialization copies the fields straight to the output
+ * in the same layout, without looking up any field by name.
+ *
+ * Fields may be char16_t, bool, the fixed width integers, float, double,
+ * std::string, std::shared_ptr<CacheableDate> and std::vector of any of
+ * those except dates.
+ */
+template <class TObject>
+class PdxSerializableFields : public PdxSerializable,
+                              public internal::PdxFieldLayout {
+ public:
+  ~PdxSerializableFields() noexcept override = default;
+
+  void toData(PdxWriter& writer) const override {
+    internal::PdxFieldWriter<TObject> fields(
+        writer, static_cast<const TObject&>(*this));
+    TObject::pdxFields(fields);
+  }
+
+  void fromData(PdxReader& reader) override {
+    internal::PdxFieldReader<TObject> fields(reader,
+                                             static_cast<TObject&>(*this));
+    TObject::pdxFields(fields);
+  }
+
+  void writePdxFields(DataOutput& output, size_t fieldsStart,
+                      std::vector<int32_t>& varLenOffsets) const override {
+    internal::PdxFieldDataWriter<TObject> fields(
+        output, fieldsStart, varLenOffsets, static_cast<const TObject&>(*this));
+    TObject::pdxFields(fields);
+  }
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXSERIALIZABLEFIELDS_H_
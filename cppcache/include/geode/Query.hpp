@@ -22,6 +22,7 @@
 
 #include <chrono>
 
+#include "ResultStream.hpp"
 #include "SelectResults.hpp"
 #include "internal/geode_globals.hpp"
 
@@ -90,6 +91,27 @@ class APACHE_GEODE_EXPORT Query {
   virtual std::shared_ptr<SelectResults> execute(
       std::shared_ptr<CacheableVector> paramList,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query on the cache server in the background and returns
+   * a stream handing out the results as they arrive. Reading the response
+   * pauses while maxBufferedResults results are waiting to be taken.
+   *
+   * @param paramList The query parameters list, optional.
+   * @param timeout The time to wait for the server to respond, optional.
+   * @param maxBufferedResults The number of results, or of structs, to buffer
+   * before waiting for the consumer, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms.
+   * @returns A stream of ResultSets or StructSets; errors of the execution
+   * are thrown by ResultStream::next.
+   */
+  virtual std::shared_ptr<ResultStream> stream(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t maxBufferedResults =
+          ResultStream::DEFAULT_MAX_BUFFERED_RESULTS) = 0;
+
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
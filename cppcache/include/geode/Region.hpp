@@ -33,6 +33,7 @@
 #include "CacheableKey.hpp"
 #include "CacheableString.hpp"
 #include "ExceptionTypes.hpp"
+#include "IndexType.hpp"
 #include "PartitionResolver.hpp"
 #include "Query.hpp"
 #include "RegionAttributes.hpp"
@@ -1376,6 +1377,14 @@ class APACHE_GEODE_EXPORT Region : public std::enable_shared_from_this<Region> {
    *
    * @returns A smart pointer to the SelectResults which can either be a
    * ResultSet or a StructSet.
+   *
+   * A query of the form <code>SELECT ... FROM /region WHERE ...</code> over
+   * a region whose cached values are known to be complete, because caching
+   * is enabled without eviction or entry expiration and all keys are
+   * registered for interest with initial values, is evaluated against the
+   * local cache when it uses only comparisons of PDX fields and builtin
+   * values; indexes created with {@link #createIndex} speed these up.
+   * Other queries are sent to the server.
    */
   virtual std::shared_ptr<SelectResults> query(
       const std::string& predicate,
@@ -1431,6 +1440,32 @@ class APACHE_GEODE_EXPORT Region : public std::enable_shared_from_this<Region> {
       const std::string& predicate,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
 
+  /**
+   * Creates an index over the values cached locally in this region, used by
+   * {@link #query}, {@link #existsValue} and {@link #selectValue} when they
+   * are evaluated locally. The index is kept up to date as entries change.
+   *
+   * @param name The name of the index, unique within the region.
+   * @param expression The attribute path to index, such as
+   * <code>address.city</code>, optionally prefixed by <code>this.</code>.
+   * @param type HASH to answer equality comparisons, RANGE to also answer
+   * ordering comparisons.
+   * @throws IllegalStateException if an index with the same name exists.
+   * @throws QueryException if the expression is not an attribute path.
+   * @throws UnsupportedOperationException if the region does not cache
+   * values.
+   */
+  virtual void createIndex(const std::string& name,
+                           const std::string& expression,
+                           IndexType type = IndexType::HASH) = 0;
+
+  /**
+   * Removes the index with the given name.
+   *
+   * @returns false if the region has no index with that name.
+   */
+  virtual bool removeIndex(const std::string& name) = 0;
+
   /**
    * Removes all of the entries for the specified keys from this region.
    * The effect of this call is equivalent to that of calling {@link #destroy}
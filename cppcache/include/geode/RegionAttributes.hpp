@@ -311,6 +311,15 @@ class APACHE_GEODE_EXPORT RegionAttributes
   bool getConcurrencyChecksEnabled() const {
     return m_isConcurrencyChecksEnabled;
   }
+
+  /**
+   * Returns true if the region keeps its values in serialized form.
+   * <p>
+   * @return true if values are stored as serialized bytes
+   * @see RegionAttributesFactory#setStoreSerializedValues
+   */
+  bool getStoreSerializedValues() const { return m_storeSerializedValues; }
+
   RegionAttributes& operator=(const RegionAttributes&) = default;
 
  private:
@@ -331,6 +340,7 @@ class APACHE_GEODE_EXPORT RegionAttributes
   void setLruEntriesLimit(int limit);
   void setDiskPolicy(DiskPolicyType diskPolicy);
   void setConcurrencyChecksEnabled(bool enable);
+  void setStoreSerializedValues(bool enable);
 
   inline bool getEntryExpiryEnabled() const {
     return (m_entryTimeToLive > std::chrono::seconds::zero() ||
@@ -379,6 +389,7 @@ class APACHE_GEODE_EXPORT RegionAttributes
   std::string m_poolName;
   bool m_isClonable;
   bool m_isConcurrencyChecksEnabled;
+  bool m_storeSerializedValues;
   friend class RegionAttributesFactory;
   friend class AttributesMutator;
   friend class Cache;
@@ -427,6 +427,20 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setConcurrencyChecksEnabled(
       bool concurrencyChecksEnabled);
 
+  /**
+   * Sets whether the region stores its values as serialized bytes instead of
+   * deserialized objects. Values received from the server are kept in the
+   * form they arrived in and are only deserialized when the application
+   * reads them, so regions whose values are mostly passed through use less
+   * memory and CPU. Each read returns a newly deserialized object unless a
+   * previously returned one is still referenced by the application, so
+   * changes made to a returned value are never seen by the cache.
+   * @param storeSerializedValues whether to store values in serialized form
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getStoreSerializedValues()
+   */
+  RegionAttributesFactory& setStoreSerializedValues(bool storeSerializedValues);
+
   // FACTORY METHOD
 
   /**
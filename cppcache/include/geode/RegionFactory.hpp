@@ -262,6 +262,14 @@ class APACHE_GEODE_EXPORT RegionFactory {
    */
   RegionFactory& setConcurrencyChecksEnabled(bool enable);
 
+  /**
+   * Sets whether the region stores its values as serialized bytes.
+   * @param enable whether to store values in serialized form
+   * @return a reference to <code>this</code>
+   * @see RegionAttributesFactory#setStoreSerializedValues
+   */
+  RegionFactory& setStoreSerializedValues(bool enable);
+
  private:
   RegionFactory(apache::geode::client::RegionShortcut preDefinedRegion,
                 CacheImpl* cacheImpl);
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_RESULTCOLUMN_H_
+#define GEODE_RESULTCOLUMN_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class ResultColumn ResultColumn.hpp
+ *
+ * The values of one field across all the rows of a StructSet.
+ *
+ * A field whose values are all of the same numeric or boolean type is stored
+ * unboxed in a contiguous array, alongside a bitmap of the rows holding
+ * null, so that it can be scanned without touching a Struct or a Cacheable.
+ * Any other field keeps its values as objects.
+ *  Example:
+ *  <br>
+ *  <pre>
+ * auto column = structSet->getColumn(structSet->getFieldIndex("price"));
+ * if (column->getType() == ResultColumn::Type::FLOATING_POINT) {
+ *   auto prices = column->getFloatingPointValues();
+ *   for (size_t row = 0; row < column->size(); row++) {
+ *     if (!column->isNull(row)) {
+ *       total += prices[row];
+ *     }
+ *   }
+ * }
+ * </pre>
+ *
+ * @see StructSet::getColumn
+ */
+class APACHE_GEODE_EXPORT ResultColumn {
+ public:
+  enum class Type {
+    /** bool, char16_t, int8_t, int16_t, int32_t or int64_t values */
+    INTEGRAL,
+    /** float or double values */
+    FLOATING_POINT,
+    /** values of any other type, or of more than one type */
+    OBJECT
+  };
+
+  virtual ~ResultColumn() noexcept = default;
+
+  virtual Type getType() const = 0;
+
+  /** Returns the number of rows. */
+  virtual size_t size() const = 0;
+
+  virtual bool isNull(size_t row) const = 0;
+
+  /**
+   * Returns the values of an INTEGRAL column widened to 64 bits, with 0 in
+   * the null rows, or nullptr for any other type of column.
+   */
+  virtual const int64_t* getIntegralValues() const = 0;
+
+  /**
+   * Returns the values of a FLOATING_POINT column widened to double, with 0
+   * in the null rows, or nullptr for any other type of column.
+   */
+  virtual const double* getFloatingPointValues() const = 0;
+
+  /**
+   * Returns the value in row as an object of its original type, or nullptr
+   * if it is null. Numeric and boolean values are boxed anew on each call.
+   *
+   * @throws IllegalArgumentException if row is out of bounds.
+   */
+  virtual std::shared_ptr<Serializable> getObject(size_t row) const = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RESULTCOLUMN_H_
@@ -0,0 +1,96 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_RESULTSTREAM_H_
+#define GEODE_RESULTSTREAM_H_
+
+#include <chrono>
+#include <memory>
+
+#include "SelectResults.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class ResultStream ResultStream.hpp
+ * Hands out the results of a query or function execution in batches while
+ * the server is still sending them, instead of once all of them have
+ * arrived.
+ *
+ * Only a bounded number of results is buffered: while that many are waiting
+ * to be taken, the client stops reading the response, so that a slow
+ * consumer holds back the server rather than filling client memory.
+ *
+ * An open stream keeps its execution, and the connection it uses, busy
+ * until all of its results are taken. Releasing the last reference to the
+ * stream closes it.
+ *  Example:
+ *  <br>
+ *  <pre>
+ * auto stream = queryService->newQuery("select * from /region")->stream();
+ * while (auto batch = stream->next()) {
+ *   for (auto&& row : *batch) {
+ *     ...
+ *   }
+ * }
+ * </pre>
+ *
+ * @see Query::stream
+ * @see Execution::stream
+ */
+class APACHE_GEODE_EXPORT ResultStream {
+ public:
+  /** The number of results buffered unless the caller chooses otherwise. */
+  static constexpr size_t DEFAULT_MAX_BUFFERED_RESULTS = 10000;
+
+  virtual ~ResultStream() noexcept = default;
+
+  /**
+   * Returns every result received and not yet taken, waiting for at least
+   * one if there is none. Query results are returned as a ResultSet or a
+   * StructSet, function results as a ResultSet.
+   *
+   * @param timeout how long to wait for a result
+   * @return the next batch of results, or nullptr once all of them have
+   * been taken
+   * @throws TimeoutException if no result arrives in time
+   * @throws Exception the error that ended the execution, once the results
+   * received before it have been taken
+   */
+  virtual std::shared_ptr<SelectResults> next(
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Discards the results not yet taken. The rest of the response is still
+   * read, but its results are dropped as they arrive.
+   */
+  virtual void close() = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RESULTSTREAM_H_
@@ -242,6 +242,92 @@ inline std::vector<TObj> readArrayObject(
   return array;
 }
 
+// Fixed width element arrays are copied and byte swapped in bulk
+
+template <typename TObj>
+inline void writeArrayObjectOnly(apache::geode::client::DataOutput& output,
+                                 const std::vector<TObj>& array) {
+  output.writeArrayLen(static_cast<int32_t>(array.size()));
+  output.writeArrayOnly(array.data(), array.size());
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int8_t>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int16_t>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int32_t>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<int64_t>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<float>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<double>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<char16_t>& array) {
+  writeArrayObjectOnly(output, array);
+}
+
+template <>
+inline std::vector<int8_t> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readByteArray();
+}
+
+template <>
+inline std::vector<int16_t> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readShortArray();
+}
+
+template <>
+inline std::vector<int32_t> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readIntArray();
+}
+
+template <>
+inline std::vector<int64_t> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readLongArray();
+}
+
+template <>
+inline std::vector<float> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readFloatArray();
+}
+
+template <>
+inline std::vector<double> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readDoubleArray();
+}
+
+template <>
+inline std::vector<char16_t> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  return input.readCharArray();
+}
+
 template <typename TObj, typename TLen>
 inline void readObject(apache::geode::client::DataInput& input, TObj*& array,
                        TLen& len) {
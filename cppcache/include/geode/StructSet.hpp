@@ -21,6 +21,7 @@
 #define GEODE_STRUCTSET_H_
 
 #include "CqResults.hpp"
+#include "ResultColumn.hpp"
 #include "Struct.hpp"
 #include "internal/geode_globals.hpp"
 
@@ -61,6 +62,19 @@ class APACHE_GEODE_EXPORT StructSet : public CqResults {
    * @throws std::out_of_range if index is not found
    */
   virtual const std::string& getFieldName(int32_t index) = 0;
+
+  /**
+   * Get the values of a field across all the rows of the StructSet.
+   *
+   * When the query-columnar-results system property is set, struct results
+   * are decoded straight into columns, and this returns them without any
+   * Struct being built. Otherwise the column is gathered from the Structs.
+   *
+   * @param index the index number of the field.
+   * @returns the column of the field.
+   * @throws std::out_of_range if index is not found
+   */
+  virtual std::shared_ptr<ResultColumn> getColumn(int32_t index) = 0;
 };
 
 }  // namespace client
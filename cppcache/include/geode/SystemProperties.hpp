@@ -161,6 +161,15 @@ class APACHE_GEODE_EXPORT SystemProperties {
    */
   int32_t maxSocketBufferSize() const { return m_maxSocketBufferSize; }
 
+  /**
+   * Returns the size, in bytes, from which message parts are compressed on
+   * connections to servers that accept compression, or 0 if compression is
+   * not offered to servers.
+   */
+  int32_t messageCompressionThreshold() const {
+    return m_messageCompressionThreshold;
+  }
+
   /**
    * Returns the time between two consecutive pings to servers
    */
@@ -242,6 +251,23 @@ class APACHE_GEODE_EXPORT SystemProperties {
    */
   uint32_t logDiskSpaceLimit() const { return m_logDiskSpaceLimit; }
 
+  /**
+   * Returns true if log lines are written by a background thread (log-async).
+   */
+  bool logAsync() const { return m_logAsync; }
+
+  /**
+   * Returns the number of log lines that may wait for the background writer
+   * (log-async-queue-size).
+   */
+  uint32_t logAsyncQueueSize() const { return m_logAsyncQueueSize; }
+
+  /**
+   * Returns true if logging threads wait for room when the log queue is full
+   * rather than dropping the line (log-async-block-when-full).
+   */
+  bool logAsyncBlockWhenFull() const { return m_logAsyncBlockWhenFull; }
+
   /**
    * Returns the stat-file-space-limit.
    */
@@ -283,6 +309,12 @@ class APACHE_GEODE_EXPORT SystemProperties {
     m_onClientDisconnectClearPdxTypeIds = set;
   }
 
+  /**
+   * Returns true if struct query results are decoded into one column per
+   * field instead of one Struct per row (query-columnar-results).
+   */
+  bool queryColumnarResults() const { return m_queryColumnarResults; }
+
   /** Return the security Diffie-Hellman secret key algorithm */
   const std::string& securityClientDhAlgo() const {
     return m_securityClientDhAlgo;
@@ -359,6 +391,9 @@ class APACHE_GEODE_EXPORT SystemProperties {
 
   uint32_t m_logFileSizeLimit;
   uint32_t m_logDiskSpaceLimit;
+  bool m_logAsync;
+  uint32_t m_logAsyncQueueSize;
+  bool m_logAsyncBlockWhenFull;
 
   uint32_t m_statsFileSizeLimit;
   uint32_t m_statsDiskSpaceLimit;
@@ -368,6 +403,7 @@ class APACHE_GEODE_EXPORT SystemProperties {
   int32_t m_heapLRULimit;
   int32_t m_heapLRUDelta;
   int32_t m_maxSocketBufferSize;
+  int32_t m_messageCompressionThreshold;
   std::chrono::seconds m_pingInterval;
   std::chrono::seconds m_redundancyMonitorInterval;
 
@@ -402,6 +438,7 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::chrono::milliseconds m_tombstoneTimeout;
   bool m_enableChunkHandlerThread;
   bool m_onClientDisconnectClearPdxTypeIds;
+  bool m_queryColumnarResults;
 
   /**
    * Processes the given property/value pair, saving
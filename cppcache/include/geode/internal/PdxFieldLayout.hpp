@@ -0,0 +1,60 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXFIELDLAYOUT_H_
+#define GEODE_PDXFIELDLAYOUT_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class DataOutput;
+
+namespace internal {
+
+/**
+ * Implemented by PdxSerializable types whose fields are laid out at compile
+ * time, so that once their PdxType is known they can be written straight
+ * to a DataOutput instead of through a PdxWriter.
+ */
+
+class APACHE_GEODE_EXPORT PdxFieldLayout {
+ public:
+  virtual ~PdxFieldLayout() noexcept = default;
+
+  /**
+   * Writes the fields in the order and encoding a PdxWriter gives them,
+   * appending the offset from fieldsStart of each variable length field to
+   * varLenOffsets.
+   */
+  virtual void writePdxFields(DataOutput& output, size_t fieldsStart,
+                              std::vector<int32_t>& varLenOffsets) const = 0;
+};
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXFIELDLAYOUT_H_
@@ -21,6 +21,8 @@
 #define GEODE_UTIL_FUNCTIONAL_H_
 
 #include <codecvt>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <locale>
 #include <memory>
@@ -101,13 +103,30 @@ struct geode_hash<std::u16string> {
 
 /**
  * Hashes like java.lang.String
+ *
+ * Runs of ASCII characters, which map one to one to UTF-16 code units, are
+ * hashed 8 at a time by folding each word into the hash with precomputed
+ * powers of 31.
  */
 template <>
 struct geode_hash<std::string> {
   inline int32_t operator()(const std::string& val) {
     int32_t hash = 0;
 
+    const auto data = val.data();
+    const auto length = val.length();
     for (auto&& it = val.cbegin(); it < val.cend(); it++) {
+      auto offset = static_cast<size_t>(it - val.cbegin());
+      if (offset + 8 <= length) {
+        uint64_t word;
+        std::memcpy(&word, data + offset, 8);
+        if ((word & 0x8080808080808080ULL) == 0) {
+          hash = hashAscii8(hash, data + offset);
+          it += 7;
+          continue;
+        }
+      }
+
       auto cp = static_cast<uint32_t>(0xff & *it);
       if (cp < 0x80) {
         // 1 byte
@@ -146,6 +165,21 @@ struct geode_hash<std::string> {
 
     return hash;
   }
+
+ private:
+  inline static int32_t hashAscii8(int32_t hash, const char* ascii) {
+    // powers of 31 modulo 2^32
+    auto h = static_cast<uint32_t>(hash) * 0x94446F01U;  // 31^8
+    h += 0x67E12CDFU * static_cast<uint8_t>(ascii[0]);   // 31^7
+    h += 0x34E63B41U * static_cast<uint8_t>(ascii[1]);   // 31^6
+    h += 0x01B4D89FU * static_cast<uint8_t>(ascii[2]);   // 31^5
+    h += 0x000E1781U * static_cast<uint8_t>(ascii[3]);   // 31^4
+    h += 0x0000745FU * static_cast<uint8_t>(ascii[4]);   // 31^3
+    h += 0x000003C1U * static_cast<uint8_t>(ascii[5]);   // 31^2
+    h += 0x0000001FU * static_cast<uint8_t>(ascii[6]);   // 31^1
+    h += static_cast<uint8_t>(ascii[7]);
+    return static_cast<int32_t>(h);
+  }
 };
 
 }  // namespace internal
@@ -212,3 +212,38 @@ BEGIN_TEST(TestEmptiedMap)
   ASSERT(vecKeys.size() == 10, "expected more entries");
 
 END_TEST(TestEmptiedMap)
+
+BEGIN_TEST(TestBulkInvalidateAndClear)
+  CacheHelper& cacheHelper = CacheHelper::getHelper();
+  std::shared_ptr<Region> regionPtr;
+  // enough entries for the segments to be processed in parallel
+  const uint32_t count = 70000;
+  cacheHelper.createPlainRegion(fwtest_Name, regionPtr, count);
+  uint32_t i;
+  for (i = 0; i < count; i++) {
+    char buf[100];
+    sprintf(buf, "%d", i);
+    auto key = CacheableKey::create(buf);
+    sprintf(buf, "value of %d", i);
+    regionPtr->put(key, cacheHelper.createCacheable(buf));
+  }
+  ASSERT(regionPtr->size() == count, "unexpected entries count");
+
+  regionPtr->localInvalidateRegion();
+  ASSERT(regionPtr->keys().size() == count, "invalidate removed keys");
+  for (i = 0; i < count; i += 997) {
+    char buf[100];
+    sprintf(buf, "%d", i);
+    ASSERT(!regionPtr->containsValueForKey(CacheableKey::create(buf)),
+           "expected value to be invalidated");
+  }
+
+  regionPtr->localClear();
+  ASSERT(regionPtr->size() == 0, "expected no entries after clear");
+  ASSERT(regionPtr->keys().size() == 0, "expected no keys after clear");
+
+  // the region is usable again after the bulk operations
+  auto key = CacheableKey::create("again");
+  regionPtr->put(key, cacheHelper.createCacheable("value"));
+  ASSERT(regionPtr->containsValueForKey(key), "expected value after put");
+END_TEST(TestBulkInvalidateAndClear)
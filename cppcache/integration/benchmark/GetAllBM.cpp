@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <framework/Cluster.h>
+#include <framework/Gfsh.h>
+
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/PoolManager.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+namespace {
+
+const int kMaxKeys = 100000;
+
+class GetAllBM : public benchmark::Fixture {
+ public:
+  GetAllBM() {
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >=
+                                        boost::log::trivial::warning);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State&) override {
+    if (!cluster) {
+      cluster = std::unique_ptr<Cluster>(
+          new Cluster(Name{name_}, LocatorCount{1}, ServerCount{3}));
+      cluster->getGfsh()
+          .create()
+          .region()
+          .withName("region")
+          .withType("PARTITION")
+          .execute();
+
+      singleHopCache = createCache(true);
+      singleHopRegion = createRegion(*singleHopCache);
+      multiHopCache = createCache(false);
+      multiHopRegion = createRegion(*multiHopCache);
+
+      HashMapOfCacheable batch;
+      for (int i = 0; i < kMaxKeys; i++) {
+        auto key = CacheableInt32::create(i);
+        keys.push_back(key);
+        batch.emplace(key, CacheableString::create("value"));
+        if (batch.size() == 1000) {
+          singleHopRegion->putAll(batch);
+          batch.clear();
+        }
+      }
+    }
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {}
+
+ protected:
+  void SetName(const char* name) {
+    name_ = name;
+
+    Benchmark::SetName(name);
+  }
+
+  void getAll(benchmark::State& state, Region& region) {
+    const std::vector<std::shared_ptr<CacheableKey>> subset(
+        keys.begin(), keys.begin() + state.range(0));
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(region.getAll(subset));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  std::unique_ptr<Cluster> cluster;
+  std::unique_ptr<Cache> singleHopCache;
+  std::shared_ptr<Region> singleHopRegion;
+  std::unique_ptr<Cache> multiHopCache;
+  std::shared_ptr<Region> multiHopRegion;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+
+ private:
+  std::unique_ptr<Cache> createCache(bool singleHop) {
+    auto cache = std::unique_ptr<Cache>(
+        new Cache(CacheFactory().set("log-level", "none").create()));
+    auto poolFactory = cache->getPoolManager().createFactory();
+    cluster->applyLocators(poolFactory);
+    poolFactory.setPRSingleHopEnabled(singleHop);
+    poolFactory.create("default");
+    return cache;
+  }
+
+  std::shared_ptr<Region> createRegion(Cache& cache) {
+    return cache.createRegionFactory(RegionShortcut::PROXY)
+        .setPoolName("default")
+        .create("region");
+  }
+
+  std::string name_;
+};
+
+BENCHMARK_DEFINE_F(GetAllBM, singleHop)(benchmark::State& state) {
+  getAll(state, *singleHopRegion);
+}
+
+BENCHMARK_DEFINE_F(GetAllBM, multiHop)(benchmark::State& state) {
+  getAll(state, *multiHopRegion);
+}
+
+BENCHMARK_REGISTER_F(GetAllBM, singleHop)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(kMaxKeys)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(GetAllBM, multiHop)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(kMaxKeys)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -249,6 +249,8 @@ TEST(PdxInstanceTest, testPdxInstance) {
 
   EXPECT_EQ(-960665662, pdxTypeInstance->hashcode())
       << "Pdxhashcode hashcode not matched with java pdx hash code.";
+  EXPECT_EQ(-960665662, pdxTypeInstance->hashcode())
+      << "Cached Pdxhashcode should match the computed hash code.";
 
   // TODO split into separate test for nested pdx object test.
   ParentPdx pdxParentOriginal(10);
@@ -0,0 +1,132 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/PdxSerializableFields.hpp>
+#include <geode/QueryService.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+#include <geode/TypeRegistry.hpp>
+
+#include "framework/Cluster.h"
+
+namespace {
+
+using apache::geode::client::CacheableString;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxSerializableFields;
+using apache::geode::client::RegionShortcut;
+
+class Order : public PdxSerializableFields<Order> {
+ public:
+  inline Order() : Order(0, "", 0.0, {}, {}) {}
+
+  inline Order(int32_t id, std::string name, double price,
+               std::vector<int32_t> quantities, std::vector<std::string> tags)
+      : id_(id),
+        name_(std::move(name)),
+        price_(price),
+        quantities_(std::move(quantities)),
+        tags_(std::move(tags)) {}
+
+  ~Order() noexcept override = default;
+
+  template <class TFields>
+  static void pdxFields(TFields& fields) {
+    fields("id", &Order::id_);
+    fields("name", &Order::name_);
+    fields("price", &Order::price_);
+    fields("quantities", &Order::quantities_);
+    fields("tags", &Order::tags_);
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "PdxSerializableFieldsTest.Order";
+    return className;
+  }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<Order>();
+  }
+
+  int32_t getId() const { return id_; }
+  const std::string& getName() const { return name_; }
+  double getPrice() const { return price_; }
+  const std::vector<int32_t>& getQuantities() const { return quantities_; }
+  const std::vector<std::string>& getTags() const { return tags_; }
+
+ private:
+  int32_t id_;
+  std::string name_;
+  double price_;
+  std::vector<int32_t> quantities_;
+  std::vector<std::string> tags_;
+};
+
+TEST(PdxSerializableFieldsTest, writesSameLayoutOnceTypeIsKnown) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto cache = cluster.createCache();
+  auto region = cache.createRegionFactory(RegionShortcut::PROXY)
+                    .setPoolName("default")
+                    .create("region");
+  cache.getTypeRegistry().registerPdxType(Order::createDeserializable);
+
+  // the first put defines the type, the second writes the fields directly
+  auto first = std::make_shared<Order>(1, "first", 1.5,
+                                       std::vector<int32_t>{1, 2},
+                                       std::vector<std::string>{"a"});
+  auto second = std::make_shared<Order>(
+      2, std::string(300, 'x'), 2.5, std::vector<int32_t>{3, 4, 5},
+      std::vector<std::string>{"b", "c"});
+  region->put("first", first);
+  region->put("second", second);
+
+  for (const auto& order : {first, second}) {
+    auto returned = std::dynamic_pointer_cast<Order>(
+        region->get(order == first ? "first" : "second"));
+    ASSERT_NE(nullptr, returned);
+    EXPECT_EQ(order->getId(), returned->getId());
+    EXPECT_EQ(order->getName(), returned->getName());
+    EXPECT_EQ(order->getPrice(), returned->getPrice());
+    EXPECT_EQ(order->getQuantities(), returned->getQuantities());
+    EXPECT_EQ(order->getTags(), returned->getTags());
+  }
+
+  // the server reads the fields of both layouts
+  auto results = cache.getQueryService()
+                     ->newQuery("SELECT o.name FROM /region o WHERE o.id = 2")
+                     ->execute();
+  ASSERT_EQ(1, results->size());
+  auto name = std::dynamic_pointer_cast<CacheableString>((*results)[0]);
+  ASSERT_NE(nullptr, name);
+  EXPECT_EQ(second->getName(), name->value());
+}
+
+}  // namespace
@@ -32,9 +32,11 @@ namespace {
 
 using apache::geode::client::Cache;
 using apache::geode::client::CacheableInt16;
+using apache::geode::client::CacheableInt32;
 using apache::geode::client::CacheableKey;
 using apache::geode::client::CacheableString;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::HashMapOfCacheable;
 using apache::geode::client::IllegalStateException;
 using apache::geode::client::Region;
 using apache::geode::client::RegionShortcut;
@@ -155,6 +157,67 @@ TEST(RegisterKeysTest, RegisterAnyWithCachingRegion) {
   }
 }
 
+TEST(RegisterKeysTest, RegisterManyKeysWithCachingRegion) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("PARTITION")
+      .execute();
+
+  // more keys than fit in one register interest batch
+  const int32_t count = 150000;
+  std::vector<std::shared_ptr<CacheableKey> > keys;
+  keys.reserve(count);
+  for (int32_t i = 0; i < count; i++) {
+    keys.push_back(CacheableInt32::create(i));
+  }
+
+  {
+    auto cache = createTestCache();
+    auto poolFactory =
+        cache.getPoolManager().createFactory().setSubscriptionEnabled(true);
+    cluster.applyLocators(poolFactory);
+    poolFactory.create("default");
+    auto region = setupCachingProxyRegion(cache);
+
+    HashMapOfCacheable entries;
+    for (int32_t i = 0; i < count; i++) {
+      entries.emplace(keys[i], CacheableInt32::create(i));
+      if (entries.size() == 1000) {
+        region->putAll(entries);
+        entries.clear();
+      }
+    }
+    region->putAll(entries);
+
+    cache.close();
+  }
+
+  {
+    auto cache2 = createTestCache();
+    auto poolFactory =
+        cache2.getPoolManager().createFactory().setSubscriptionEnabled(true);
+    cluster.applyLocators(poolFactory);
+    poolFactory.create("default");
+    auto region2 = setupCachingProxyRegion(cache2);
+
+    region2->registerKeys(keys, false, true);
+
+    ASSERT_EQ(static_cast<size_t>(count), region2->getInterestList().size());
+    ASSERT_EQ(static_cast<uint32_t>(count), region2->size());
+    for (int32_t i = 0; i < count; i += 997) {
+      auto&& entry = region2->getEntry(keys[i]);
+      ASSERT_NE(entry, nullptr);
+      auto&& value =
+          std::dynamic_pointer_cast<CacheableInt32>(entry->getValue());
+      ASSERT_NE(value, nullptr);
+      ASSERT_EQ(value->value(), i);
+    }
+  }
+}
+
 TEST(RegisterKeysTest, RegisterAllWithProxyRegion) {
   Cluster cluster{LocatorCount{1}, ServerCount{1}};
   cluster.getGfsh()
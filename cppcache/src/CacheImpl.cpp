@@ -279,6 +279,10 @@ void CacheImpl::close(bool keepalive) {
 
   if (m_closed || (!m_initialized)) return;
 
+  // Release producers waiting on streams nobody drains; they finish once
+  // their requests fail or complete, at the latest when the pools close.
+  m_resultStreams.cancel();
+
   // Close the distribution manager used for queries.
   if (m_remoteQueryServicePtr != nullptr) {
     m_remoteQueryServicePtr->close();
@@ -328,6 +332,8 @@ void CacheImpl::close(bool keepalive) {
   LOGFINE("Closed pool manager with keepalive %s",
           keepalive ? "true" : "false");
 
+  m_resultStreams.join();
+
   // Close CachePef Stats
   if (m_cacheStats) {
     _GEODE_SAFE_DELETE(m_cacheStats);
@@ -527,6 +533,9 @@ std::shared_ptr<RegionInternal> CacheImpl::createRegion_internal(
     const std::shared_ptr<CacheStatistics>& csptr, bool shared) {
   std::shared_ptr<RegionInternal> rptr = nullptr;
   RegionKind regionKind = getRegionKind(attrs);
+  if (attrs.getStoreSerializedValues()) {
+    m_serializedValueRegions = true;
+  }
   const auto& poolName = attrs.getPoolName();
   const auto& regionEndpoints = attrs.getEndpoints();
   const std::string cacheEndpoints =
@@ -788,6 +797,8 @@ std::shared_ptr<SerializationRegistry> CacheImpl::getSerializationRegistry()
 
 ThreadPool& CacheImpl::getThreadPool() { return m_threadPool; }
 
+ResultStreamManager& CacheImpl::getResultStreams() { return m_resultStreams; }
+
 std::shared_ptr<CacheTransactionManager>
 CacheImpl::getCacheTransactionManager() {
   this->throwIfClosed();
@@ -40,6 +40,7 @@
 #include "NonCopyable.hpp"
 #include "PdxTypeRegistry.hpp"
 #include "RemoteQueryService.hpp"
+#include "ResultStreamImpl.hpp"
 #include "ThreadPool.hpp"
 #include "util/synchronized_map.hpp"
 
@@ -104,6 +105,12 @@ class APACHE_GEODE_EXPORT CacheImpl : private NonCopyable,
 
   bool getAndResetNetworkHopFlag() { return m_networkhop.exchange(false); }
 
+  /**
+   * Returns false if no region of this cache was ever created to store
+   * serialized values, so notifications can skip looking their region up.
+   */
+  bool hasSerializedValueRegions() const { return m_serializedValueRegions; }
+
   int getBlackListBucketTimeouts() { return m_blacklistBucketTimeout; }
 
   void incBlackListBucketTimeouts() { ++m_blacklistBucketTimeout; }
@@ -311,6 +318,8 @@ class APACHE_GEODE_EXPORT CacheImpl : private NonCopyable,
 
   ThreadPool& getThreadPool();
 
+  ResultStreamManager& getResultStreams();
+
   inline const std::shared_ptr<AuthInitialize>& getAuthInitialize() {
     return m_authInitialize;
   }
@@ -337,6 +346,7 @@ class APACHE_GEODE_EXPORT CacheImpl : private NonCopyable,
 
  private:
   std::atomic<bool> m_networkhop;
+  std::atomic<bool> m_serializedValueRegions{false};
   std::atomic<int> m_blacklistBucketTimeout;
   std::atomic<int8_t> m_serverGroupFlag;
   bool m_ignorePdxUnreadFields;
@@ -399,6 +409,7 @@ class APACHE_GEODE_EXPORT CacheImpl : private NonCopyable,
   std::shared_ptr<SerializationRegistry> m_serializationRegistry;
   std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
   ThreadPool m_threadPool;
+  ResultStreamManager m_resultStreams;
   const std::shared_ptr<AuthInitialize> m_authInitialize;
   std::unique_ptr<TypeRegistry> m_typeRegistry;
 
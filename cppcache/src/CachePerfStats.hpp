@@ -43,18 +43,19 @@ class APACHE_GEODE_EXPORT CachePerfStats {
 
     if (statsType == nullptr) {
       const bool largerIsBetter = true;
-      StatisticDescriptor** statDescArr = new StatisticDescriptor*[24];
+      StatisticDescriptor** statDescArr = new StatisticDescriptor*[28];
 
       statDescArr[0] = factory->createIntCounter(
           "creates", "The total number of cache creates", "entries",
           largerIsBetter);
-      statDescArr[1] = factory->createIntCounter(
+      // incremented by every application thread on every operation
+      statDescArr[1] = factory->createStripedIntCounter(
           "puts", "The total number of cache puts", "entries", largerIsBetter);
-      statDescArr[2] = factory->createIntCounter(
+      statDescArr[2] = factory->createStripedIntCounter(
           "gets", "The total number of cache gets", "entries", largerIsBetter);
-      statDescArr[3] = factory->createIntCounter(
+      statDescArr[3] = factory->createStripedIntCounter(
           "hits", "The total number of cache hits", "entries", largerIsBetter);
-      statDescArr[4] = factory->createIntCounter(
+      statDescArr[4] = factory->createStripedIntCounter(
           "misses", "The total number of cache misses", "entries",
           !largerIsBetter);
       statDescArr[5] = factory->createIntGauge(
@@ -95,7 +96,7 @@ class APACHE_GEODE_EXPORT CachePerfStats {
           "processedDeltaMessagesTime",
           "Total time spent applying delta (received from server) on existing "
           "values at client",
-          "operations", largerIsBetter);
+          "nanoseconds", !largerIsBetter);
       statDescArr[14] = factory->createIntCounter(
           "tombstoneCount", "The total number of current tombstones", "entries",
           false);
@@ -137,10 +138,30 @@ class APACHE_GEODE_EXPORT CachePerfStats {
           "pdxDeserializedBytes",
           "Total number of bytes read by pdx deserialization.", "entries",
           !largerIsBetter);
+      statDescArr[24] = factory->createIntGauge(
+          "queuedEventsBacklog",
+          "The current number of queued events received by a reconnecting "
+          "durable client that have not been applied yet",
+          "operations", !largerIsBetter);
+      statDescArr[25] = factory->createIntCounter(
+          "queuedEventsReplayed",
+          "Total number of queued events received by a reconnecting durable "
+          "client and applied, including the conflated ones",
+          "operations", largerIsBetter);
+      statDescArr[26] = factory->createLongCounter(
+          "queuedEventsReplayTime",
+          "Total time spent applying queued events received by a reconnecting "
+          "durable client",
+          "nanoseconds", !largerIsBetter);
+      statDescArr[27] = factory->createIntCounter(
+          "deltaApplyRetries",
+          "Total number of times a delta received from server was applied "
+          "again because the value changed while it was being applied",
+          "operations", !largerIsBetter);
 
       statsType = factory->createType("CachePerfStats",
                                       "Statistics about native client cache",
-                                      statDescArr, 24);
+                                      statDescArr, 28);
     }
     GF_D_ASSERT(statsType != nullptr);
     // Create Statistics object
@@ -175,6 +196,10 @@ class APACHE_GEODE_EXPORT CachePerfStats {
     m_pdxSerializedBytesId = statsType->nameToId("pdxSerializedBytes");
     m_pdxDeserializationsId = statsType->nameToId("pdxDeserializations");
     m_pdxDeserializedBytesId = statsType->nameToId("pdxDeserializedBytes");
+    m_queuedEventsBacklogId = statsType->nameToId("queuedEventsBacklog");
+    m_queuedEventsReplayedId = statsType->nameToId("queuedEventsReplayed");
+    m_queuedEventsReplayTimeId = statsType->nameToId("queuedEventsReplayTime");
+    m_deltaApplyRetriesId = statsType->nameToId("deltaApplyRetries");
 
     // Set initial value
     m_cachePerfStats->setInt(m_destroysId, 0);
@@ -201,6 +226,10 @@ class APACHE_GEODE_EXPORT CachePerfStats {
     m_cachePerfStats->setLong(m_pdxSerializedBytesId, 0);
     m_cachePerfStats->setInt(m_pdxDeserializationsId, 0);
     m_cachePerfStats->setLong(m_pdxDeserializedBytesId, 0);
+    m_cachePerfStats->setInt(m_queuedEventsBacklogId, 0);
+    m_cachePerfStats->setInt(m_queuedEventsReplayedId, 0);
+    m_cachePerfStats->setLong(m_queuedEventsReplayTimeId, 0);
+    m_cachePerfStats->setInt(m_deltaApplyRetriesId, 0);
   }
 
   virtual ~CachePerfStats() { m_cachePerfStats = nullptr; }
@@ -217,9 +246,13 @@ class APACHE_GEODE_EXPORT CachePerfStats {
 
   inline void incDestroys() { m_cachePerfStats->incInt(m_destroysId, 1); }
 
-  inline void incCreates() { m_cachePerfStats->incInt(m_createsId, 1); }
+  inline void incCreates(int32_t count = 1) {
+    m_cachePerfStats->incInt(m_createsId, count);
+  }
 
-  inline void incPuts() { m_cachePerfStats->incInt(m_putsId, 1); }
+  inline void incPuts(int32_t count = 1) {
+    m_cachePerfStats->incInt(m_putsId, count);
+  }
 
   inline void incGets() { m_cachePerfStats->incInt(m_getsId, 1); }
 
@@ -249,15 +282,19 @@ class APACHE_GEODE_EXPORT CachePerfStats {
     m_cachePerfStats->incInt(m_deltaFailedOnReceive, 1);
   }
 
-  inline void incTimeSpentOnDeltaApplication(int32_t time) {
-    m_cachePerfStats->incInt(m_processedDeltaMessagesTime, time);
+  inline void incTimeSpentOnDeltaApplication(int64_t time) {
+    m_cachePerfStats->incLong(m_processedDeltaMessagesTime, time);
+  }
+
+  inline void incDeltaApplyRetries() {
+    m_cachePerfStats->incInt(m_deltaApplyRetriesId, 1);
   }
 
   inline void incTombstoneCount() {
     m_cachePerfStats->incInt(m_tombstoneCount, 1);
   }
-  inline void decTombstoneCount() {
-    m_cachePerfStats->incInt(m_tombstoneCount, -1);
+  inline void decTombstoneCount(int32_t count = 1) {
+    m_cachePerfStats->incInt(m_tombstoneCount, -count);
   }
   inline void incTombstoneSize(int64_t size) {
     m_cachePerfStats->incLong(m_tombstoneSize, size);
@@ -265,8 +302,21 @@ class APACHE_GEODE_EXPORT CachePerfStats {
   inline void decTombstoneSize(int64_t size) {
     m_cachePerfStats->incLong(m_tombstoneSize, -size);
   }
-  inline void incConflatedEvents() {
-    m_cachePerfStats->incInt(m_conflatedEvents, 1);
+  inline void incConflatedEvents(int32_t count = 1) {
+    m_cachePerfStats->incInt(m_conflatedEvents, count);
+  }
+
+  inline void incQueuedEventsBacklog(int32_t count) {
+    m_cachePerfStats->incInt(m_queuedEventsBacklogId, count);
+  }
+
+  inline void incQueuedEventsReplayed(int32_t count) {
+    m_cachePerfStats->incInt(m_queuedEventsReplayedId, count);
+    m_cachePerfStats->incInt(m_queuedEventsBacklogId, -count);
+  }
+
+  inline int32_t getQueuedEventsReplayTimeId() {
+    return m_queuedEventsReplayTimeId;
   }
   int64_t getTombstoneSize() {
     return m_cachePerfStats->getLong(m_tombstoneSize);
@@ -357,6 +407,10 @@ class APACHE_GEODE_EXPORT CachePerfStats {
   int32_t m_pdxSerializedBytesId;
   int32_t m_pdxDeserializationsId;
   int32_t m_pdxDeserializedBytesId;
+  int32_t m_queuedEventsBacklogId;
+  int32_t m_queuedEventsReplayedId;
+  int32_t m_queuedEventsReplayTimeId;
+  int32_t m_deltaApplyRetriesId;
 };
 }  // namespace client
 }  // namespace geode
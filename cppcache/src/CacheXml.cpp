@@ -150,6 +150,8 @@ CacheXml::CacheXml() {
 
   CONCURRENCY_CHECKS_ENABLED = "concurrency-checks-enabled";
 
+  STORE_SERIALIZED_VALUES = "store-serialized-values";
+
   TOMBSTONE_TIMEOUT = "tombstone-timeout";
 
   /** Pool elements and attributes */
@@ -202,6 +202,7 @@ class APACHE_GEODE_EXPORT CacheXml {
   const char* MULTIUSER_SECURE_MODE;
   const char* PR_SINGLE_HOP_ENABLED;
   const char* CONCURRENCY_CHECKS_ENABLED;
+  const char* STORE_SERIALIZED_VALUES;
   const char* TOMBSTONE_TIMEOUT;
 
   /** Name of the named region attributes */
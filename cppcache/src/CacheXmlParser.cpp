@@ -920,6 +920,19 @@ void CacheXmlParser::startRegionAttributes(const xmlChar** atts) {
                                   "<concurrency-checks-enabled>");
         }
         regionAttributesFactory->setConcurrencyChecksEnabled(flag);
+      } else if (STORE_SERIALIZED_VALUES == name) {
+        bool flag = false;
+        std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+        if ("false" == value) {
+          flag = false;
+        } else if ("true" == value) {
+          flag = true;
+        } else {
+          throw CacheXmlException("XML: " + value +
+                                  " is not a valid value for the attribute "
+                                  "<store-serialized-values>");
+        }
+        regionAttributesFactory->setStoreSerializedValues(flag);
       }
     }  // for loop
   }    // atts is nullptr
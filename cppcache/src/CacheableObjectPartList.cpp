@@ -40,6 +40,20 @@ void CacheableObjectPartList::fromData(DataInput& input) {
     std::shared_ptr<Cacheable> value;
     std::shared_ptr<Exception> ex;
     // bool isException;
+    // the entries for the local cache go in together once the chunk is read
+    MapPutBatch puts;
+    // if value has already been received via notification or put by
+    // another thread, then return that
+    auto addValue = [this](const std::shared_ptr<CacheableKey>& valueKey,
+                           std::shared_ptr<Cacheable> newValue,
+                           const std::shared_ptr<Cacheable>& oldValue) {
+      if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
+        newValue = m_region->fromStoredValue(oldValue);
+      }
+      if (m_values != nullptr) {
+        m_values->emplace(valueKey, newValue);
+      }
+    };
     int32_t keysOffset = (m_keysOffset != nullptr ? *m_keysOffset : 0);
     for (int32_t index = keysOffset; index < keysOffset + len; ++index) {
       if (hasKeys) {
@@ -73,7 +87,6 @@ void CacheableObjectPartList::fromData(DataInput& input) {
         m_exceptions->emplace(key, ex);
       } else {
         input.readObject(value);
-        std::shared_ptr<Cacheable> oldValue;
         if (m_addToLocalCache) {
           // for both  register interest  and getAll it is desired
           // to overwrite an invalidated entry
@@ -86,29 +99,30 @@ void CacheableObjectPartList::fromData(DataInput& input) {
             updateCount = pos->second;
             m_updateCountMap->erase(pos);
           }
-          std::shared_ptr<VersionTag> versionTag;
-          GfErrType err =
-              m_region->putLocal("getAll", false, key, value, oldValue, true,
-                                 updateCount, m_destroyTracker, versionTag);
-          if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
-            LOGDEBUG(
-                "CacheableObjectPartList::fromData putLocal for key [%s] failed because the cache \
-                already contains an entry with higher version.",
-                Utils::nullSafeToString(key).c_str());
-          }
+          puts.keys.push_back(key);
+          puts.values.push_back(value);
+          puts.updateCounts.push_back(updateCount);
         } else {
+          std::shared_ptr<Cacheable> oldValue;
           m_region->getEntry(key, oldValue);
+          addValue(key, value, oldValue);
         }
-        // if value has already been received via notification or put by
-        // another thread, then return that
-        if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
-          value = oldValue;
-        }
-        if (m_values != nullptr) {
-          m_values->emplace(key, value);
-        }
       }
     }
+
+    // the batch replaces its values with their stored form
+    const auto values = puts.values;
+    m_region->putLocalBatch("getAll", puts, m_destroyTracker);
+    for (size_t index = 0; index < puts.results.size(); ++index) {
+      const auto& result = puts.results[index];
+      if (result.err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+        LOGDEBUG(
+            "CacheableObjectPartList::fromData putLocal for key [%s] failed because the cache \
+                already contains an entry with higher version.",
+            Utils::nullSafeToString(puts.keys[index]).c_str());
+      }
+      addValue(puts.keys[index], values[index], result.oldValue);
+    }
     if (m_keysOffset != nullptr) {
       *m_keysOffset += len;
     }
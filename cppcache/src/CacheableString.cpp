@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <cwchar>
 #include <locale>
+#include <memory>
 
 #include <geode/CacheableString.hpp>
 #include <geode/DataInput.hpp>
@@ -34,6 +35,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+CacheableString::~CacheableString() noexcept { delete m_serialized.load(); }
+
 void CacheableString::toData(DataOutput& output) const {
   if (m_type == DSCode::CacheableASCIIString) {
     output.writeAscii(m_str);
@@ -56,6 +59,7 @@ void CacheableString::fromData(DataInput& input) {
   } else if (m_type == DSCode::CacheableStringHuge) {
     input.readUtf16Huge(m_str);
   }
+  delete m_serialized.exchange(nullptr);
 }
 
 std::shared_ptr<Serializable> CacheableString::createDeserializable() {
@@ -109,18 +113,36 @@ int32_t CacheableString::hashcode() const {
   return m_hashcode;
 }
 
-bool CacheableString::isAscii(const std::string& str) {
-  for (auto&& c : str) {
-    if (c & 0x80) {
-      return false;
+const std::vector<int8_t>& CacheableString::serializedForm() const {
+  auto serialized = m_serialized.load(std::memory_order_acquire);
+  if (serialized == nullptr) {
+    DataOutputInternal output;
+    output.write(static_cast<int8_t>(m_type));
+    toData(output);
+    auto buffer = reinterpret_cast<const int8_t*>(output.getBuffer());
+    std::unique_ptr<const std::vector<int8_t>> computed(
+        new std::vector<int8_t>(buffer, buffer + output.getBufferLength()));
+
+    // Another thread may have published first, in which case use its copy.
+    if (m_serialized.compare_exchange_strong(serialized, computed.get(),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+      serialized = computed.release();
     }
   }
-  return true;
+  return *serialized;
+}
+
+bool CacheableString::isAscii(const std::string& str) {
+  return ascii_prefix_length(str.data(), str.length()) == str.length();
 }
 
 size_t CacheableString::objectSize() const {
   auto size = sizeof(CacheableString) +
               sizeof(std::string::value_type) * m_str.capacity();
+  if (auto serialized = m_serialized.load(std::memory_order_acquire)) {
+    size += sizeof(std::vector<int8_t>) + serialized->capacity();
+  }
   return size;
 }
 
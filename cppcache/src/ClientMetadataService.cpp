@@ -313,11 +313,17 @@ ClientMetadataService::getServerToFilterMap(
   auto serverToFilterMap = std::make_shared<ServerToFilterMap>();
 
   std::vector<std::shared_ptr<CacheableKey>> keysWhichLeft;
-  std::map<int, std::shared_ptr<BucketServerLocation>> buckets;
+  const auto totalNumBuckets = clientMetadata->getTotalNumBuckets();
+  const auto resolver = region->getAttributes().getPartitionResolver();
+
+  // Look up each bucket's server once and remember its key list, so every
+  // further key of the bucket is appended without hashing the location.
+  std::vector<std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>>>
+      bucketKeyLists(totalNumBuckets);
+  std::vector<bool> bucketLookedUp(totalNumBuckets, false);
 
   for (const auto& key : keys) {
     LOGDEBUG("cmds = %s", key->toString().c_str());
-    const auto resolver = region->getAttributes().getPartitionResolver();
     std::shared_ptr<CacheableKey> resolveKey;
 
     if (resolver == nullptr) {
@@ -329,42 +335,33 @@ ClientMetadataService::getServerToFilterMap(
       resolveKey = resolver->getRoutingObject(event);
     }
 
-    int bucketId =
-        std::abs(resolveKey->hashcode() % clientMetadata->getTotalNumBuckets());
-    std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> keyList =
-        nullptr;
+    int bucketId = std::abs(resolveKey->hashcode() % totalNumBuckets);
+    auto& keyList = bucketKeyLists[bucketId];
 
-    const auto& bucketsIter = buckets.find(bucketId);
-    if (bucketsIter == buckets.end()) {
+    if (!bucketLookedUp[bucketId]) {
+      bucketLookedUp[bucketId] = true;
       int8_t version = -1;
-      // auto serverLocation = std::make_shared<BucketServerLocation>();
       std::shared_ptr<BucketServerLocation> serverLocation = nullptr;
       clientMetadata->getServerLocation(bucketId, isPrimary, serverLocation,
                                         version);
-      if (!(serverLocation && serverLocation->isValid())) {
-        keysWhichLeft.push_back(key);
-        continue;
-      }
-
-      buckets[bucketId] = serverLocation;
-
-      const auto& itrRes = serverToFilterMap->find(serverLocation);
+      if (serverLocation && serverLocation->isValid()) {
+        auto& serverKeys = (*serverToFilterMap)[serverLocation];
+        if (!serverKeys) {
+          serverKeys =
+              std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+        }
+        keyList = serverKeys;
 
-      if (itrRes == serverToFilterMap->end()) {
-        keyList =
-            std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
-        serverToFilterMap->emplace(serverLocation, keyList);
-      } else {
-        keyList = itrRes->second;
+        LOGDEBUG("new keylist bucket =%d res = %d", bucketId,
+                 serverToFilterMap->size());
       }
+    }
 
-      LOGDEBUG("new keylist buckets =%d res = %d", buckets.size(),
-               serverToFilterMap->size());
+    if (keyList) {
+      keyList->push_back(key);
     } else {
-      keyList = (*serverToFilterMap)[bucketsIter->second];
+      keysWhichLeft.push_back(key);
     }
-
-    keyList->push_back(key);
   }
 
   if (!keysWhichLeft.empty() && !serverToFilterMap->empty()) {
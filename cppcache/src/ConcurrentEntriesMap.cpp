@@ -17,6 +17,10 @@
 #include "ConcurrentEntriesMap.hpp"
 
 #include <algorithm>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
 
 #include "RegionInternal.hpp"
 #include "TableOfPrimes.hpp"
@@ -27,6 +31,14 @@ namespace client {
 
 bool EntriesMap::boolVal = false;
 
+namespace {
+
+// below this many entries a bulk operation finishes before threads would
+// have started
+const uint32_t PARALLEL_BULK_THRESHOLD = 64 * 1024;
+
+}  // namespace
+
 ConcurrentEntriesMap::ConcurrentEntriesMap(
     ExpiryTaskManager* expiryTaskManager,
     std::unique_ptr<EntryFactory> entryFactory, bool concurrencyChecksEnabled,
@@ -65,12 +77,106 @@ void ConcurrentEntriesMap::close() {
   }
 }
 void ConcurrentEntriesMap::clear() {
-  for (uint32_t index = 0; index < m_concurrency; index++) {
-    m_segments[index].clear();
-  }
+  forEachSegment(m_size,
+                 [this](int index) { m_segments[index].clear(); });
   m_size = 0;
 }
 
+void ConcurrentEntriesMap::invalidateAll(
+    std::vector<std::shared_ptr<MapEntryImpl>>& invalidated) {
+  std::vector<std::vector<std::shared_ptr<MapEntryImpl>>> segmentEntries(
+      m_concurrency);
+  forEachSegment(m_size, [this, &segmentEntries](int index) {
+    m_segments[index].invalidateAll(segmentEntries[index]);
+  });
+
+  size_t total = invalidated.size();
+  for (const auto& entries : segmentEntries) {
+    total += entries.size();
+  }
+  invalidated.reserve(total);
+  for (auto& entries : segmentEntries) {
+    std::move(entries.begin(), entries.end(), std::back_inserter(invalidated));
+  }
+}
+
+void ConcurrentEntriesMap::invalidateKeys(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys) {
+  std::vector<std::vector<std::shared_ptr<CacheableKey>>> segmentKeys(
+      m_concurrency);
+  for (const auto& key : keys) {
+    segmentKeys[segmentIdx(key)].push_back(key);
+  }
+
+  uint32_t added = 0;
+  for (int index = 0; index < m_concurrency; ++index) {
+    if (!segmentKeys[index].empty()) {
+      added += m_segments[index].invalidateKeys(segmentKeys[index]);
+    }
+  }
+  m_size += added;
+}
+
+void ConcurrentEntriesMap::forEachKeyGroup(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys,
+    const std::function<void(const std::vector<size_t>&)>& task) const {
+  std::vector<std::vector<size_t>> segmentKeys(m_concurrency);
+  for (size_t index = 0; index < keys.size(); ++index) {
+    segmentKeys[segmentIdx(keys[index])].push_back(index);
+  }
+
+  forEachSegment(static_cast<uint32_t>(keys.size()),
+                 [&segmentKeys, &task](int index) {
+                   if (!segmentKeys[index].empty()) {
+                     task(segmentKeys[index]);
+                   }
+                 });
+}
+
+void ConcurrentEntriesMap::forEachSegment(
+    uint32_t entries, const std::function<void(int)>& task) const {
+  unsigned threads = 1;
+  if (entries >= PARALLEL_BULK_THRESHOLD) {
+    threads = std::min(std::thread::hardware_concurrency(),
+                       static_cast<unsigned>(m_concurrency));
+  }
+  if (threads <= 1) {
+    for (int index = 0; index < m_concurrency; ++index) {
+      task(index);
+    }
+    return;
+  }
+
+  std::atomic<int> next(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto worker = [this, &task, &next, &error, &errorMutex]() {
+    try {
+      for (int index; (index = next++) < m_concurrency;) {
+        task(index);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(errorMutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (unsigned i = 1; i < threads; ++i) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 ConcurrentEntriesMap::~ConcurrentEntriesMap() { delete[] m_segments; }
 
 GfErrType ConcurrentEntriesMap::create(
@@ -120,6 +226,17 @@ GfErrType ConcurrentEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
   return err;
 }
 
+void ConcurrentEntriesMap::putBatch(MapPutBatch& batch, int destroyTracker) {
+  batch.results.resize(batch.keys.size());
+  std::atomic<uint32_t> created(0);
+  forEachKeyGroup(batch.keys, [this, &batch, &created, destroyTracker](
+                                  const std::vector<size_t>& group) {
+    created += segmentFor(batch.keys[group.front()])
+                   ->putBatch(batch, group, destroyTracker);
+  });
+  m_size += created;
+}
+
 bool ConcurrentEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<Cacheable>& value,
                                std::shared_ptr<MapEntryImpl>& me) {
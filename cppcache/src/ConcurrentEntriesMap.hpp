@@ -20,6 +20,7 @@
 #ifndef GEODE_CONCURRENTENTRIESMAP_H_
 #define GEODE_CONCURRENTENTRIESMAP_H_
 #include <atomic>
+#include <functional>
 
 #include <geode/RegionEntry.hpp>
 #include <geode/internal/geode_globals.hpp>
@@ -68,6 +69,13 @@ class APACHE_GEODE_EXPORT ConcurrentEntriesMap : public EntriesMap {
    */
   inline int segmentIdx(uint32_t hash) const { return (hash % m_concurrency); }
 
+  /**
+   * Runs task for the index of every segment. Bulk operations over enough
+   * entries to take a while spread the segments over several threads.
+   */
+  void forEachSegment(uint32_t entries,
+                      const std::function<void(int)>& task) const;
+
  public:
   /**
    * @brief constructor, must call open before using map.
@@ -86,8 +94,32 @@ class APACHE_GEODE_EXPORT ConcurrentEntriesMap : public EntriesMap {
 
   virtual ~ConcurrentEntriesMap();
 
+  /**
+   * Clears the segments, in parallel for large maps.
+   */
   virtual void clear();
 
+  /**
+   * Invalidates a segment at a time under a single lock, in parallel for
+   * large maps, instead of looking up and locking each entry.
+   */
+  virtual void invalidateAll(
+      std::vector<std::shared_ptr<MapEntryImpl>>& invalidated);
+
+  /**
+   * Groups keys by segment and invalidates each group under a single lock.
+   */
+  virtual void invalidateKeys(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys);
+
+  /**
+   * Groups keys by segment and runs task once per non-empty group, in
+   * parallel for large key lists.
+   */
+  virtual void forEachKeyGroup(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      const std::function<void(const std::vector<size_t>&)>& task) const;
+
   virtual GfErrType put(const std::shared_ptr<CacheableKey>& key,
                         const std::shared_ptr<Cacheable>& newValue,
                         std::shared_ptr<MapEntryImpl>& me,
@@ -96,6 +128,13 @@ class APACHE_GEODE_EXPORT ConcurrentEntriesMap : public EntriesMap {
                         std::shared_ptr<VersionTag> versionTag,
                         bool& isUpdate = EntriesMap::boolVal,
                         DataInput* delta = nullptr);
+
+  /**
+   * Groups the batch by segment and puts each group under a single lock,
+   * in parallel for large batches.
+   */
+  virtual void putBatch(MapPutBatch& batch, int destroyTracker);
+
   virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& me,
                                std::shared_ptr<Cacheable>& oldValue,
@@ -25,9 +25,17 @@ namespace apache {
 namespace geode {
 namespace client {
 
+CqAttributesImpl::CqAttributesImpl()
+    : m_cqListeners(std::make_shared<listener_container_type>()),
+      m_dataPolicyHasBeenSet(false) {}
+
 CqAttributes::listener_container_type CqAttributesImpl::getCqListeners() {
-  std::lock_guard<decltype(m_mutex)> _guard(m_mutex);
-  return m_cqListeners;
+  return *getCqListenersSnapshot();
+}
+
+std::shared_ptr<const CqAttributes::listener_container_type>
+CqAttributesImpl::getCqListenersSnapshot() const {
+  return std::atomic_load(&m_cqListeners);
 }
 
 void CqAttributesImpl::addCqListener(const std::shared_ptr<CqListener>& cql) {
@@ -35,12 +43,16 @@ void CqAttributesImpl::addCqListener(const std::shared_ptr<CqListener>& cql) {
     throw IllegalArgumentException("addCqListener parameter was null");
   }
   std::lock_guard<decltype(m_mutex)> _guard(m_mutex);
-  m_cqListeners.push_back(cql);
+  auto listeners = std::make_shared<listener_container_type>(*m_cqListeners);
+  listeners->push_back(cql);
+  std::atomic_store(&m_cqListeners,
+                    std::shared_ptr<const listener_container_type>(
+                        std::move(listeners)));
 }
 
 CqAttributesImpl* CqAttributesImpl::clone() {
   auto clone = new CqAttributesImpl();
-  clone->setCqListeners(m_cqListeners);
+  clone->setCqListeners(*getCqListenersSnapshot());
   return clone;
 }
 
@@ -51,13 +63,17 @@ void CqAttributesImpl::setCqListeners(
     return;
   }
 
-  decltype(m_cqListeners) oldListeners(m_cqListeners);
+  decltype(m_cqListeners) oldListeners;
   {
     std::lock_guard<decltype(m_mutex)> _guard(m_mutex);
-    m_cqListeners = addedListeners;
+    oldListeners = m_cqListeners;
+    std::atomic_store(&m_cqListeners,
+                      std::shared_ptr<const listener_container_type>(
+                          std::make_shared<listener_container_type>(
+                              addedListeners)));
   }
-  if (!oldListeners.empty()) {
-    for (auto l : oldListeners) {
+  if (!oldListeners->empty()) {
+    for (auto l : *oldListeners) {
       try {
         l->close();
         // Handle client side exceptions.
@@ -66,7 +82,6 @@ void CqAttributesImpl::setCqListeners(
                 ex.what());
       }
     }
-    oldListeners.clear();
   }
 }
 
@@ -76,12 +91,16 @@ void CqAttributesImpl::removeCqListener(
     throw IllegalArgumentException("removeCqListener parameter was null");
   }
   std::lock_guard<decltype(m_mutex)> _guard(m_mutex);
-  if (!m_cqListeners.empty()) {
-    m_cqListeners.erase(
+  if (!m_cqListeners->empty()) {
+    auto listeners = std::make_shared<listener_container_type>(*m_cqListeners);
+    listeners->erase(
         std::remove_if(
-            m_cqListeners.begin(), m_cqListeners.end(),
+            listeners->begin(), listeners->end(),
             [cql](std::shared_ptr<CqListener> l) -> bool { return cql == l; }),
-        m_cqListeners.end());
+        listeners->end());
+    std::atomic_store(&m_cqListeners,
+                      std::shared_ptr<const listener_container_type>(
+                          std::move(listeners)));
     try {
       cql->close();
       // Handle client side exceptions.
@@ -20,6 +20,7 @@
 #ifndef GEODE_CQATTRIBUTESIMPL_H_
 #define GEODE_CQATTRIBUTESIMPL_H_
 
+#include <memory>
 #include <mutex>
 
 #include <geode/CqAttributes.hpp>
@@ -42,10 +43,18 @@ namespace client {
  */
 class APACHE_GEODE_EXPORT CqAttributesImpl : public CqAttributes {
  public:
+  CqAttributesImpl();
   ~CqAttributesImpl() noexcept override {}
 
   listener_container_type getCqListeners() override;
 
+  /**
+   * Get the CqListeners without copying them. The returned list is
+   * immutable; changes to the listeners replace it rather than modify it.
+   */
+  std::shared_ptr<const listener_container_type> getCqListenersSnapshot()
+      const;
+
   /**
    * Get the CqListener set with the CQ.
    * Returns the CqListener associated with the CQ.
@@ -60,7 +69,8 @@ class APACHE_GEODE_EXPORT CqAttributesImpl : public CqAttributes {
   CqAttributesImpl* clone();
 
  private:
-  listener_container_type m_cqListeners;
+  // replaced under m_mutex, read without it
+  std::shared_ptr<const listener_container_type> m_cqListeners;
   bool m_dataPolicyHasBeenSet;
   std::recursive_mutex m_mutex;
 };
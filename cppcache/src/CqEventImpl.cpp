@@ -27,23 +27,22 @@
 namespace apache {
 namespace geode {
 namespace client {
-CqEventImpl::CqEventImpl(std::shared_ptr<CqQuery>& cQuery, CqOperation baseOp,
-                         CqOperation cqOp, std::shared_ptr<CacheableKey>& key,
-                         std::shared_ptr<Cacheable>& value,
+CqEventImpl::CqEventImpl(std::shared_ptr<CqQuery> cQuery, CqOperation baseOp,
+                         CqOperation cqOp,
+                         const std::shared_ptr<CacheableKey>& key,
+                         const std::shared_ptr<Cacheable>& value,
                          ThinClientBaseDM* tcrdm,
-                         std::shared_ptr<CacheableBytes> deltaBytes,
-                         std::shared_ptr<EventId> eventId)
-    : m_error(false) {
-  m_cQuery = cQuery;
-  m_queryOp = cqOp;
-  m_baseOp = baseOp;
-  m_key = key;
-  m_newValue = value;
-  if (m_queryOp == CqOperation::OP_TYPE_INVALID) m_error = true;
-  m_tcrdm = tcrdm;
-  m_deltaValue = deltaBytes;
-  m_eventId = eventId;
-}
+                         const std::shared_ptr<CacheableBytes>& deltaBytes,
+                         const std::shared_ptr<EventId>& eventId)
+    : m_cQuery(std::move(cQuery)),
+      m_baseOp(baseOp),
+      m_queryOp(cqOp),
+      m_key(key),
+      m_newValue(value),
+      m_error(cqOp == CqOperation::OP_TYPE_INVALID),
+      m_tcrdm(tcrdm),
+      m_deltaValue(deltaBytes),
+      m_eventId(eventId) {}
 std::shared_ptr<CqQuery> CqEventImpl::getCq() const { return m_cQuery; }
 
 CqOperation CqEventImpl::getBaseOperation() const { return m_baseOp; }
@@ -45,11 +45,11 @@ class ThinClientBaseDM;
 class EventId;
 class CqEventImpl : public CqEvent {
  public:
-  CqEventImpl(std::shared_ptr<CqQuery>& cQuery, CqOperation baseOp,
-              CqOperation cqOp, std::shared_ptr<CacheableKey>& key,
-              std::shared_ptr<Cacheable>& value, ThinClientBaseDM* tcrdm,
-              std::shared_ptr<CacheableBytes> deltaBytes,
-              std::shared_ptr<EventId> eventId);
+  CqEventImpl(std::shared_ptr<CqQuery> cQuery, CqOperation baseOp,
+              CqOperation cqOp, const std::shared_ptr<CacheableKey>& key,
+              const std::shared_ptr<Cacheable>& value, ThinClientBaseDM* tcrdm,
+              const std::shared_ptr<CacheableBytes>& deltaBytes,
+              const std::shared_ptr<EventId>& eventId);
 
   std::shared_ptr<CqQuery> getCq() const;
 
@@ -21,6 +21,7 @@
 #include <geode/CqAttributesMutator.hpp>
 #include <geode/ExceptionTypes.hpp>
 
+#include "CqAttributesImpl.hpp"
 #include "ResultSetImpl.hpp"
 #include "StructSetImpl.hpp"
 #include "TcrConnectionManager.hpp"
@@ -233,6 +234,13 @@ std::shared_ptr<CqAttributes> CqQueryImpl::getCqAttributes() const {
   return m_cqAttributes;
 }
 
+std::shared_ptr<const CqAttributes::listener_container_type>
+CqQueryImpl::getCqListenersSnapshot() const {
+  // created by CqAttributesFactory, which always makes a CqAttributesImpl
+  return static_cast<CqAttributesImpl*>(m_cqAttributes.get())
+      ->getCqListenersSnapshot();
+}
+
 /**
  * Clears the resource used by CQ.
  * @throws CqException
@@ -556,7 +564,6 @@ void CqQueryImpl::updateStats(CqEvent& cqEvent) {
  * @return true if running, false otherwise
  */
 bool CqQueryImpl::isRunning() const {
-  std::lock_guard<decltype(m_mutex)> _guard(m_mutex);
   return m_cqState == CqState::RUNNING;
 }
 
@@ -20,6 +20,7 @@
 #ifndef GEODE_CQQUERYIMPL_H_
 #define GEODE_CQQUERYIMPL_H_
 
+#include <atomic>
 #include <mutex>
 #include <string>
 
@@ -66,7 +67,8 @@ class CqQueryImpl : public CqQuery,
 
   // Stats counters
   std::shared_ptr<CqStatistics> m_stats;
-  CqState m_cqState;
+  // written under m_mutex, read without it when routing events
+  std::atomic<CqState> m_cqState;
   CqOperation m_cqOperation;
 
   /* CQ Request Type - Start */
@@ -163,6 +165,12 @@ class CqQueryImpl : public CqQuery,
 
   std::shared_ptr<CqAttributes> getCqAttributes() const override;
 
+  /**
+   * Get the CqListeners of this CQ without copying them.
+   */
+  std::shared_ptr<const CqAttributes::listener_container_type>
+  getCqListenersSnapshot() const;
+
   std::shared_ptr<Region> getCqBaseRegion();
 
   /**
@@ -41,7 +41,8 @@ CqService::CqService(ThinClientBaseDM* tccdm,
     : m_tccdm(tccdm),
       m_statisticsFactory(statisticsFactory),
       m_notificationSema(1),
-      m_stats(std::make_shared<CqServiceVsdStats>(m_statisticsFactory)) {
+      m_stats(std::make_shared<CqServiceVsdStats>(m_statisticsFactory)),
+      m_routingTable(std::make_shared<CqRoutingTable>()) {
   m_running = true;
   LOGDEBUG("CqService Started");
 }
@@ -140,17 +141,49 @@ std::shared_ptr<CqQuery> CqService::newCq(
  * Adds the given CQ and cqQuery object into the CQ map.
  */
 void CqService::addCq(const std::string& cqName, std::shared_ptr<CqQuery>& cq) {
+  auto&& lock = m_cqQueryMap.make_lock();
   auto result = m_cqQueryMap.emplace(cqName, cq);
   if (!result.second) {
     throw CqExistsException("CQ with given name already exists. ");
   }
+  routeCq(cqName, std::dynamic_pointer_cast<CqQueryImpl>(cq));
 }
 
 /**
  * Removes given CQ from the cqMap..
  */
 void CqService::removeCq(const std::string& cqName) {
-  m_cqQueryMap.erase(cqName);
+  auto&& lock = m_cqQueryMap.make_lock();
+  if (m_cqQueryMap.erase(cqName) > 0) {
+    routeCq(cqName, nullptr);
+  }
+}
+
+void CqService::routeCq(const std::string& cqName,
+                        std::shared_ptr<CqQueryImpl> cq) {
+  auto routingTable = std::make_shared<CqRoutingTable>(*m_routingTable);
+  const auto found = routingTable->ids.find(cqName);
+  if (cq == nullptr) {
+    if (found == routingTable->ids.end()) {
+      return;
+    }
+    routingTable->cqs[found->second] = nullptr;
+    routingTable->freeIds.push_back(found->second);
+    routingTable->ids.erase(found);
+  } else if (found != routingTable->ids.end()) {
+    routingTable->cqs[found->second] = std::move(cq);
+  } else if (!routingTable->freeIds.empty()) {
+    const auto id = routingTable->freeIds.back();
+    routingTable->freeIds.pop_back();
+    routingTable->ids.emplace(cqName, id);
+    routingTable->cqs[id] = std::move(cq);
+  } else {
+    routingTable->ids.emplace(cqName,
+                              static_cast<int32_t>(routingTable->cqs.size()));
+    routingTable->cqs.push_back(std::move(cq));
+  }
+  std::atomic_store(&m_routingTable, std::shared_ptr<const CqRoutingTable>(
+                                         std::move(routingTable)));
 }
 
 /**
@@ -173,7 +206,10 @@ std::shared_ptr<CqQuery> CqService::getCq(const std::string& cqName) {
  */
 void CqService::clearCqQueryMap() {
   Log::fine("Cleaning clearCqQueryMap.");
+  auto&& lock = m_cqQueryMap.make_lock();
   m_cqQueryMap.clear();
+  std::atomic_store(&m_routingTable, std::shared_ptr<const CqRoutingTable>(
+                                         std::make_shared<CqRoutingTable>()));
 }
 
 /**
@@ -393,17 +429,21 @@ void CqService::receiveNotification(TcrMessage* msg) {
  * @param key
  * @param value
  */
-void CqService::invokeCqListeners(const std::map<std::string, int>* cqs,
+void CqService::invokeCqListeners(const TcrMessage::CqOperationList* cqs,
                                   uint32_t messageType,
                                   std::shared_ptr<CacheableKey> key,
                                   std::shared_ptr<Cacheable> value,
                                   std::shared_ptr<CacheableBytes> deltaValue,
                                   std::shared_ptr<EventId> eventId) {
   LOGDEBUG("CqService::invokeCqListeners");
+  auto routingTable = std::atomic_load(&m_routingTable);
+  const auto baseOp = getOperation(messageType);
   for (const auto& kv : *cqs) {
-    const auto cqName = kv.first;
-    auto cQuery = getCq(cqName);
-    auto cQueryImpl = std::dynamic_pointer_cast<CqQueryImpl>(cQuery);
+    const auto& cqName = kv.first;
+    const auto found = routingTable->ids.find(cqName);
+    const auto cQueryImpl = found == routingTable->ids.end()
+                                ? nullptr
+                                : routingTable->cqs[found->second].get();
     if (!(cQueryImpl && cQueryImpl->isRunning())) {
       LOGFINE("Unable to invoke CqListener, %s, CqName: %s",
               cQueryImpl ? "CQ not found" : "CQ is Not running",
@@ -426,23 +466,24 @@ void CqService::invokeCqListeners(const std::map<std::string, int>* cqs,
     }
 
     // Construct CqEvent.
-    auto cqEvent =
-        new CqEventImpl(cQuery, getOperation(messageType), getOperation(cqOp),
-                        key, value, m_tccdm, deltaValue, eventId);
+    CqEventImpl cqEvent(routingTable->cqs[found->second], baseOp,
+                        getOperation(cqOp), key, value, m_tccdm, deltaValue,
+                        eventId);
 
     // Update statistics
-    cQueryImpl->updateStats(*cqEvent);
+    cQueryImpl->updateStats(cqEvent);
 
     // invoke CQ Listeners.
-    for (auto l : cQueryImpl->getCqAttributes()->getCqListeners()) {
+    auto listeners = cQueryImpl->getCqListenersSnapshot();
+    for (const auto& l : *listeners) {
       try {
         // Check if the listener is not null, it could have been changed/reset
         // by the CqAttributeMutator.
         if (l) {
-          if (cqEvent->getError() == true) {
-            l->onError(*cqEvent);
+          if (cqEvent.getError() == true) {
+            l->onError(cqEvent);
           } else {
-            l->onEvent(*cqEvent);
+            l->onEvent(cqEvent);
           }
         }
         // Handle client side exceptions.
@@ -452,7 +493,6 @@ void CqService::invokeCqListeners(const std::map<std::string, int>* cqs,
                     .c_str());
       }
     }
-    delete cqEvent;
   }
 }
 
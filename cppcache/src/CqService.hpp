@@ -21,8 +21,11 @@
 #define GEODE_CQSERVICE_H_
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <ace/Semaphore.h>
 
@@ -45,6 +48,7 @@ namespace client {
 
 class ThinClientBaseDM;
 class TcrEndpoint;
+class CqQueryImpl;
 
 /**
  * @class CqService CqService.hpp
@@ -68,8 +72,23 @@ class APACHE_GEODE_EXPORT CqService
 
   std::shared_ptr<CqServiceStatistics> m_stats;
 
+  // Names of the registered CQs interned to dense ids, with the CQ registered
+  // under each id. The ids of removed CQs are freed for reuse. Replaced as a
+  // whole under the lock of m_cqQueryMap whenever a CQ is added or removed,
+  // so that notifications are routed from a snapshot without taking any lock.
+  struct CqRoutingTable {
+    std::unordered_map<std::string, int32_t> ids;
+    std::vector<std::shared_ptr<CqQueryImpl>> cqs;
+    std::vector<int32_t> freeIds;
+  };
+  std::shared_ptr<const CqRoutingTable> m_routingTable;
+
   inline bool noCq() const { return m_cqQueryMap.empty(); }
 
+  // publishes a routing table with cq registered under cqName, or without
+  // cqName if cq is null; the lock of m_cqQueryMap must be held
+  void routeCq(const std::string& cqName, std::shared_ptr<CqQueryImpl> cq);
+
  public:
   typedef std::vector<std::shared_ptr<CqQuery>> query_container_type;
 
@@ -221,7 +240,7 @@ class APACHE_GEODE_EXPORT CqService
    * @param key
    * @param value
    */
-  void invokeCqListeners(const std::map<std::string, int>* cqs,
+  void invokeCqListeners(const TcrMessage::CqOperationList* cqs,
                          uint32_t messageType,
                          std::shared_ptr<CacheableKey> key,
                          std::shared_ptr<Cacheable> value,
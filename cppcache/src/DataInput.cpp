@@ -22,6 +22,7 @@
 #include "CacheRegionHelper.hpp"
 #include "SerializationRegistry.hpp"
 #include "util/JavaModifiedUtf8.hpp"
+#include "util/byteswap.hpp"
 #include "util/string.hpp"
 
 namespace apache {
@@ -46,13 +47,48 @@ const SerializationRegistry& DataInput::getSerializationRegistry() const {
 
 Cache* DataInput::getCache() const { return m_cache->getCache(); }
 
+template <typename T>
+void DataInput::readArrayOnlySwapped(T* values, size_t len) {
+  if (len > 0) {
+    const auto size = len * sizeof(T);
+    _GEODE_CHECK_BUFFER_SIZE(size);
+    internal::ByteSwap::copy<T>(values, m_buf, len);
+    m_buf += size;
+  }
+}
+
+void DataInput::readArrayOnly(int16_t* values, size_t len) {
+  readArrayOnlySwapped(values, len);
+}
+
+void DataInput::readArrayOnly(int32_t* values, size_t len) {
+  readArrayOnlySwapped(values, len);
+}
+
+void DataInput::readArrayOnly(int64_t* values, size_t len) {
+  readArrayOnlySwapped(values, len);
+}
+
+void DataInput::readArrayOnly(float* values, size_t len) {
+  readArrayOnlySwapped(values, len);
+}
+
+void DataInput::readArrayOnly(double* values, size_t len) {
+  readArrayOnlySwapped(values, len);
+}
+
+void DataInput::readArrayOnly(char16_t* values, size_t len) {
+  readArrayOnlySwapped(values, len);
+}
+
 template <class _Traits, class _Allocator>
 void DataInput::readJavaModifiedUtf8(
     std::basic_string<char, _Traits, _Allocator>& value) {
-  // TODO string OPTIMIZE skip intermediate utf16 string
-  std::u16string utf16;
-  readJavaModifiedUtf8(utf16);
-  value = to_utf8(utf16);
+  uint16_t length = readInt16();
+  _GEODE_CHECK_BUFFER_SIZE(length);
+  value = internal::JavaModifiedUtf8::decodeToUtf8(
+      reinterpret_cast<const char*>(m_buf), length);
+  advanceCursor(length);
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataInput::readJavaModifiedUtf8(std::string&);
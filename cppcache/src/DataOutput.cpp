@@ -25,6 +25,7 @@
 #include "SerializationRegistry.hpp"
 #include "util/JavaModifiedUtf8.hpp"
 #include "util/Log.hpp"
+#include "util/byteswap.hpp"
 #include "util/string.hpp"
 
 namespace apache {
@@ -127,6 +128,40 @@ void DataOutput::writeObjectInternal(const std::shared_ptr<Serializable>& ptr,
   getSerializationRegistry().serialize(ptr, *this, isDelta);
 }
 
+template <class T>
+void DataOutput::writeArrayOnlySwapped(const T* values, size_t len) {
+  if (len > 0) {
+    const auto size = len * sizeof(T);
+    ensureCapacity(size);
+    internal::ByteSwap::copy<T>(m_buf, values, len);
+    m_buf += size;
+  }
+}
+
+void DataOutput::writeArrayOnly(const int16_t* values, size_t len) {
+  writeArrayOnlySwapped(values, len);
+}
+
+void DataOutput::writeArrayOnly(const int32_t* values, size_t len) {
+  writeArrayOnlySwapped(values, len);
+}
+
+void DataOutput::writeArrayOnly(const int64_t* values, size_t len) {
+  writeArrayOnlySwapped(values, len);
+}
+
+void DataOutput::writeArrayOnly(const float* values, size_t len) {
+  writeArrayOnlySwapped(values, len);
+}
+
+void DataOutput::writeArrayOnly(const double* values, size_t len) {
+  writeArrayOnlySwapped(values, len);
+}
+
+void DataOutput::writeArrayOnly(const char16_t* values, size_t len) {
+  writeArrayOnlySwapped(values, len);
+}
+
 void DataOutput::acquireLock() { globalBigBufferMutex.lock(); }
 
 void DataOutput::releaseLock() { globalBigBufferMutex.unlock(); }
@@ -141,14 +176,26 @@ template <class _Traits, class _Allocator>
 void DataOutput::writeJavaModifiedUtf8(
     const std::basic_string<char, _Traits, _Allocator>& value) {
   /*
-   * OPTIMIZE convert from UTF-8 to CESU-8/Java Modified UTF-8 directly
+   * Converts from UTF-8 to CESU-8/Java Modified UTF-8 directly
    * http://www.unicode.org/reports/tr26/
    */
   if (value.empty()) {
     writeInt(static_cast<uint16_t>(0));
-  } else {
+    return;
+  }
+
+  const auto encodedLen = internal::JavaModifiedUtf8::encodedLength(
+      value.data(), value.length());
+  if (encodedLen > std::numeric_limits<uint16_t>::max()) {
+    // truncates at the same UTF-16 code unit as other string types
     writeJavaModifiedUtf8(to_utf16(value));
+    return;
   }
+
+  writeInt(static_cast<uint16_t>(encodedLen));
+  ensureCapacity(encodedLen);
+  m_buf = internal::JavaModifiedUtf8::encode(value.data(), value.length(),
+                                             m_buf);
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataOutput::writeJavaModifiedUtf8(const std::string&);
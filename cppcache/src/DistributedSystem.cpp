@@ -81,6 +81,10 @@ DistributedSystem DistributedSystem::create(
   } else {
     Log::setLogLevel(systemProperties->logLevel());
   }
+  if (systemProperties->logAsync()) {
+    Log::startAsync(systemProperties->logAsyncQueueSize(),
+                    systemProperties->logAsyncBlockWhenFull());
+  }
 
   try {
     CppCacheLibrary::getProductDir();
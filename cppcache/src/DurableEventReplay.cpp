@@ -0,0 +1,163 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DurableEventReplay.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include <geode/SystemProperties.hpp>
+#include <geode/internal/functional.hpp>
+
+#include "CachePerfStats.hpp"
+#include "DistributedSystemImpl.hpp"
+#include "TcrMessage.hpp"
+#include "Utils.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+typedef std::unordered_map<std::shared_ptr<CacheableKey>, std::vector<size_t>,
+                           dereference_hash<std::shared_ptr<CacheableKey>>,
+                           dereference_equal_to<std::shared_ptr<CacheableKey>>>
+    KeyUpdates;
+
+}  // namespace
+
+const char* DurableEventReplay::NC_DurableReplay = "NC DurableReplay";
+
+const std::chrono::seconds DurableEventReplay::IdleTimeout =
+    std::chrono::seconds(30);
+
+DurableEventReplay::DurableEventReplay(CachePerfStats& stats,
+                                       Dispatcher dispatch, bool conflate,
+                                       bool timeStatistics)
+    : m_stats(stats),
+      m_dispatch(std::move(dispatch)),
+      m_conflate(conflate),
+      m_timeStatistics(timeStatistics),
+      m_finishing(false),
+      m_thread(&DurableEventReplay::run, this) {}
+
+DurableEventReplay::~DurableEventReplay() { finish(); }
+
+bool DurableEventReplay::conflates(const SystemProperties& props) {
+  return props.conflateEvents() == "true";
+}
+
+void DurableEventReplay::add(TcrMessageReply* msg) {
+  m_stats.incQueuedEventsBacklog(1);
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  m_queue.push_back(msg);
+  if (m_queue.size() == 1) {
+    m_cond.notify_one();
+  }
+}
+
+void DurableEventReplay::finish() {
+  {
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    m_finishing = true;
+  }
+  m_cond.notify_one();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void DurableEventReplay::run() {
+  DistributedSystemImpl::setThreadName(NC_DurableReplay);
+  std::vector<TcrMessageReply*> batch;
+  while (true) {
+    {
+      std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+      m_cond.wait(lock, [this] { return m_finishing || !m_queue.empty(); });
+      if (m_queue.empty()) {
+        break;
+      }
+      batch.swap(m_queue);
+    }
+    replay(batch);
+    batch.clear();
+  }
+}
+
+void DurableEventReplay::replay(std::vector<TcrMessageReply*>& batch) {
+  const auto sampleStartNanos = m_timeStatistics ? Utils::startStatOpTime() : 0;
+  const auto received = static_cast<int32_t>(batch.size());
+
+  if (m_conflate && batch.size() > 1) {
+    m_stats.incConflatedEvents(conflate(batch));
+  }
+  for (auto msg : batch) {
+    if (msg == nullptr) {
+      continue;
+    }
+    try {
+      m_dispatch(msg);
+    } catch (const Exception& ex) {
+      LOGERROR("Exception while replaying queued event: %s: %s",
+               ex.getName().c_str(), ex.what());
+    } catch (...) {
+      LOGERROR("Unexpected exception while replaying queued event");
+    }
+  }
+
+  m_stats.incQueuedEventsReplayed(received);
+  if (m_timeStatistics) {
+    Utils::updateStatOpTime(m_stats.getStat(),
+                            m_stats.getQueuedEventsReplayTimeId(),
+                            sampleStartNanos);
+  }
+}
+
+int32_t DurableEventReplay::conflate(std::vector<TcrMessageReply*>& batch) {
+  // creates and updates of each key since the last event of any other kind,
+  // which must see every earlier event applied
+  std::unordered_map<std::string, KeyUpdates> updates;
+  int32_t dropped = 0;
+  for (size_t index = 0; index < batch.size(); ++index) {
+    auto msg = batch[index];
+    const auto type = msg->getMessageType();
+    const bool isUpdate =
+        type == TcrMessage::LOCAL_CREATE || type == TcrMessage::LOCAL_UPDATE;
+    if (!isUpdate || msg->hasCqPart() || msg->getKey() == nullptr) {
+      updates.clear();
+      continue;
+    }
+
+    auto& keyUpdates = updates[msg->getRegionName()][msg->getKey()];
+    // a delta needs the value the earlier updates leave behind
+    if (!msg->hasDelta()) {
+      for (auto superseded : keyUpdates) {
+        _GEODE_SAFE_DELETE(batch[superseded]);
+        ++dropped;
+      }
+      keyUpdates.clear();
+    }
+    keyUpdates.push_back(index);
+  }
+  return dropped;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_DURABLEEVENTREPLAY_H_
+#define GEODE_DURABLEEVENTREPLAY_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CachePerfStats;
+class SystemProperties;
+class TcrMessageReply;
+
+/**
+ * Applies the backlog of queued events that a durable client receives after
+ * reconnecting, up to the marker the server sends after the last of them.
+ *
+ * The subscription thread keeps reading and decoding messages while a replay
+ * thread applies whatever accumulated in the meantime as one batch. Within a
+ * batch, create and update events that a later full value for the same key
+ * supersedes are dropped before they reach the cache and its listeners,
+ * when conflate-events is true.
+ */
+class DurableEventReplay {
+ public:
+  typedef std::function<void(TcrMessageReply*)> Dispatcher;
+
+  DurableEventReplay(CachePerfStats& stats, Dispatcher dispatch, bool conflate,
+                     bool timeStatistics);
+
+  ~DurableEventReplay();
+
+  /** Queues msg to be dispatched after the events queued before it. */
+  void add(TcrMessageReply* msg);
+
+  /** Dispatches every queued event and stops the replay thread. */
+  void finish();
+
+  /**
+   * Deletes the create and update events of batch that a later full value for
+   * the same key in the same region supersedes, leaving nullptr in their
+   * place. Any other event is a barrier that nothing before it is dropped
+   * across. Returns the number of events dropped.
+   */
+  static int32_t conflate(std::vector<TcrMessageReply*>& batch);
+
+  /**
+   * Whether replay conflates events. Only an explicit conflate-events=true
+   * does; the default "server" leaves it to each server region's setting,
+   * which the client cannot see, so every event is dispatched.
+   */
+  static bool conflates(const SystemProperties& props);
+
+  /** How long a channel may stay quiet before replay ends without a marker. */
+  static const std::chrono::seconds IdleTimeout;
+
+ private:
+  void run();
+  void replay(std::vector<TcrMessageReply*>& batch);
+
+  CachePerfStats& m_stats;
+  const Dispatcher m_dispatch;
+  const bool m_conflate;
+  const bool m_timeStatistics;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::vector<TcrMessageReply*> m_queue;
+  bool m_finishing;
+  std::thread m_thread;
+
+  static const char* NC_DurableReplay;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DURABLEEVENTREPLAY_H_
@@ -22,7 +22,9 @@
 
 // This needs to be ace free so that the region can include it.
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include <geode/CacheableKey.hpp>
 #include <geode/RegionEntry.hpp>
@@ -66,6 +68,13 @@ class APACHE_GEODE_EXPORT EntriesMap {
                         std::shared_ptr<VersionTag> versionTag,
                         bool& isUpdate = EntriesMap::boolVal,
                         DataInput* delta = nullptr) = 0;
+
+  /**
+   * @brief put every entry of batch, as put() does, taking each segment's
+   * lock once for all of the batch's keys in that segment.
+   */
+  virtual void putBatch(MapPutBatch& batch, int destroyTracker) = 0;
+
   virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& me,
                                std::shared_ptr<Cacheable>& oldValue,
@@ -93,6 +102,25 @@ class APACHE_GEODE_EXPORT EntriesMap {
   /** @brief remove all entries in the map. */
   virtual void clear() = 0;
 
+  /**
+   * @brief invalidate every entry in the map, appending those that had a
+   * value to invalidated.
+   */
+  virtual void invalidateAll(
+      std::vector<std::shared_ptr<MapEntryImpl>>& invalidated) = 0;
+
+  /** @brief invalidate the entries for keys, as invalidate() does. */
+  virtual void invalidateKeys(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys) = 0;
+
+  /**
+   * @brief run task for each group of keys that share a segment, passing
+   * the indexes of the group's keys; groups may run concurrently.
+   */
+  virtual void forEachKeyGroup(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      const std::function<void(const std::vector<size_t>&)>& task) const = 0;
+
   /**
    * @brief remove the entry for key from the map;
    *   returns false and nullptr MapEntry if absent
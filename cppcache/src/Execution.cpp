@@ -59,6 +59,12 @@ std::shared_ptr<ResultCollector> Execution::execute(
   return impl_->execute(routingObj, args, rs, func, timeout);
 }
 
+std::shared_ptr<ResultStream> Execution::stream(
+    const std::string& func, std::chrono::milliseconds timeout,
+    size_t maxBufferedResults) {
+  return impl_->stream(func, timeout, maxBufferedResults);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
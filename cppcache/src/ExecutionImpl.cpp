@@ -23,7 +23,9 @@
 #include <geode/ExceptionTypes.hpp>
 #include <geode/internal/geode_globals.hpp>
 
+#include "CacheRegionHelper.hpp"
 #include "NoResult.hpp"
+#include "ResultStreamImpl.hpp"
 #include "TcrConnectionManager.hpp"
 #include "ThinClientPoolDM.hpp"
 #include "ThinClientRegion.hpp"
@@ -406,6 +408,27 @@ GfErrType ExecutionImpl::getFuncAttributes(const std::string& func,
   return err;
 }
 
+std::shared_ptr<ResultStream> ExecutionImpl::stream(
+    const std::string& func, std::chrono::milliseconds timeout,
+    size_t maxBufferedResults) {
+  CacheImpl* cacheImpl = nullptr;
+  if (m_region != nullptr) {
+    cacheImpl = CacheRegionHelper::getCacheImpl(&m_region->getCache());
+  } else if (auto tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get())) {
+    cacheImpl = tcrdm->getConnectionManager().getCacheImpl();
+  } else {
+    throw IllegalArgumentException(
+        "Execute: pool cast to ThinClientPoolDM failed");
+  }
+  std::shared_ptr<ExecutionImpl> execution(new ExecutionImpl(*this));
+  return cacheImpl->getResultStreams().start(
+      maxBufferedResults, [execution, func, timeout](
+                              const std::shared_ptr<ResultStreamImpl>& stream) {
+        execution->m_rc = std::make_shared<StreamingResultCollector>(stream);
+        execution->execute(func, timeout);
+      });
+}
+
 void ExecutionImpl::addResults(
     std::shared_ptr<ResultCollector>& collector,
     const std::shared_ptr<CacheableVector>& results) {
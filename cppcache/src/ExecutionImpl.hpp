@@ -75,6 +75,10 @@ class ExecutionImpl {
       const std::string& func,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
 
+  std::shared_ptr<ResultStream> stream(const std::string& func,
+                                       std::chrono::milliseconds timeout,
+                                       size_t maxBufferedResults);
+
   static void addResults(std::shared_ptr<ResultCollector>& collector,
                          const std::shared_ptr<CacheableVector>& results);
 
@@ -23,14 +23,16 @@ namespace apache {
 namespace geode {
 namespace client {
 
-void ExpEntryFactory::newMapEntry(ExpiryTaskManager* expiryTaskManager,
+void ExpEntryFactory::newMapEntry(MapEntryPool* pool,
+                                  ExpiryTaskManager* expiryTaskManager,
                                   const std::shared_ptr<CacheableKey>& key,
                                   std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result =
-        MapEntryT<VersionedExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result = MapEntryT<VersionedExpMapEntry, 0, 0>::create(
+        pool, expiryTaskManager, key);
   } else {
-    result = MapEntryT<ExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result =
+        MapEntryT<ExpMapEntry, 0, 0>::create(pool, expiryTaskManager, key);
   }
 }
 
@@ -84,7 +84,8 @@ class APACHE_GEODE_EXPORT ExpEntryFactory : public EntryFactory {
 
   virtual ~ExpEntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  virtual void newMapEntry(MapEntryPool* pool,
+                           ExpiryTaskManager* expiryTaskManager,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 };
@@ -158,8 +158,13 @@ class FairQueue {
 
     if (!m_closed) {
       do {
-        m_cond.wait(&stopAt);
+        // an item put back after the caller found the queue empty, but
+        // before the queue lock was taken here, signalled nobody
         mp = popFromQueue(isClosed);
+        if (mp == nullptr && !isClosed) {
+          m_cond.wait(&stopAt);
+          mp = popFromQueue(isClosed);
+        }
         if (mp && excludeList) {
           if (exclude(mp, excludeList)) {
             mp->close();
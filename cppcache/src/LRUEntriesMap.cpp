@@ -252,6 +252,39 @@ GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
   return err;
 }
 
+void LRUEntriesMap::invalidateAll(
+    std::vector<std::shared_ptr<MapEntryImpl>>& invalidated) {
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  getKeys(keys);
+  for (const auto& key : keys) {
+    std::shared_ptr<MapEntryImpl> me;
+    std::shared_ptr<Cacheable> oldValue;
+    invalidate(key, me, oldValue, nullptr);
+    if (me != nullptr) {
+      invalidated.push_back(std::move(me));
+    }
+  }
+}
+
+void LRUEntriesMap::invalidateKeys(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys) {
+  for (const auto& key : keys) {
+    std::shared_ptr<MapEntryImpl> me;
+    std::shared_ptr<Cacheable> oldValue;
+    invalidate(key, me, oldValue, nullptr);
+  }
+}
+
+void LRUEntriesMap::putBatch(MapPutBatch& batch, int destroyTracker) {
+  batch.results.resize(batch.keys.size());
+  for (size_t index = 0; index < batch.keys.size(); ++index) {
+    auto& result = batch.results[index];
+    result.err = put(batch.keys[index], batch.values[index], result.entry,
+                     result.oldValue, batch.updateCount(index),
+                     destroyTracker, batch.versionTag(index), result.isUpdate);
+  }
+}
+
 GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
                              const std::shared_ptr<Cacheable>& newValue,
                              std::shared_ptr<MapEntryImpl>& me,
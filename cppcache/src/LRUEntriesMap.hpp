@@ -89,10 +89,27 @@ class APACHE_GEODE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
                         std::shared_ptr<VersionTag> versionTag,
                         bool& isUpdate = EntriesMap::boolVal,
                         DataInput* delta = nullptr);
+
+  /**
+   * Puts entry by entry, since each put may evict or overflow entries of
+   * other segments.
+   */
+  virtual void putBatch(MapPutBatch& batch, int destroyTracker);
+
   virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& me,
                                std::shared_ptr<Cacheable>& oldValue,
                                std::shared_ptr<VersionTag> versionTag);
+
+  /**
+   * Invalidates entry by entry, since each one may need to be read back from
+   * disk and changes the size of the map.
+   */
+  virtual void invalidateAll(
+      std::vector<std::shared_ptr<MapEntryImpl>>& invalidated);
+
+  virtual void invalidateKeys(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys);
   virtual GfErrType create(const std::shared_ptr<CacheableKey>& key,
                            const std::shared_ptr<Cacheable>& newValue,
                            std::shared_ptr<MapEntryImpl>& me,
@@ -24,14 +24,15 @@ namespace geode {
 namespace client {
 
 void LRUExpEntryFactory::newMapEntry(
-    ExpiryTaskManager* expiryTaskManager,
+    MapEntryPool* pool, ExpiryTaskManager* expiryTaskManager,
     const std::shared_ptr<CacheableKey>& key,
     std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedLRUExpMapEntry, 0, 0>::create(expiryTaskManager,
-                                                              key);
+    result = MapEntryT<VersionedLRUExpMapEntry, 0, 0>::create(
+        pool, expiryTaskManager, key);
   } else {
-    result = MapEntryT<LRUExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result =
+        MapEntryT<LRUExpMapEntry, 0, 0>::create(pool, expiryTaskManager, key);
   }
 }
 
@@ -90,7 +90,8 @@ class APACHE_GEODE_EXPORT LRUExpEntryFactory : public EntryFactory {
 
   virtual ~LRUExpEntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  virtual void newMapEntry(MapEntryPool* pool,
+                           ExpiryTaskManager* expiryTaskManager,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 };
@@ -113,7 +113,8 @@ class APACHE_GEODE_EXPORT LRUEntryFactory : public EntryFactory {
 
   virtual ~LRUEntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  virtual void newMapEntry(MapEntryPool* pool,
+                           ExpiryTaskManager* expiryTaskManager,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 };
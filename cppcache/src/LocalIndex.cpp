@@ -0,0 +1,292 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LocalIndex.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+LocalIndex::LocalIndex(std::string name, QueryPath path, IndexType type)
+    : m_name(std::move(name)),
+      m_path(std::move(path)),
+      m_type(type),
+      m_populating(true) {}
+
+LocalIndex::Attribute LocalIndex::evaluate(
+    const std::shared_ptr<Cacheable>& value) const {
+  try {
+    return Attribute{m_path.evaluate(value), true};
+  } catch (const QueryException&) {
+    return Attribute{QueryValue(), false};
+  }
+}
+
+void LocalIndex::put(const std::shared_ptr<CacheableKey>& key,
+                     const std::shared_ptr<Cacheable>& value) {
+  put(key, evaluate(value));
+}
+
+void LocalIndex::put(const std::shared_ptr<CacheableKey>& key,
+                     Attribute attribute) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_populating) {
+    m_touched.insert(key);
+  }
+  unguardedPut(key, std::move(attribute));
+}
+
+void LocalIndex::remove(const std::shared_ptr<CacheableKey>& key) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_populating) {
+    m_touched.insert(key);
+  }
+  unguardedRemove(key);
+}
+
+void LocalIndex::populate(const std::shared_ptr<CacheableKey>& key,
+                          const std::shared_ptr<Cacheable>& value) {
+  auto attribute = evaluate(value);
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_touched.find(key) == m_touched.end()) {
+    unguardedPut(key, std::move(attribute));
+  }
+}
+
+void LocalIndex::populated() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_populating = false;
+  m_touched.clear();
+}
+
+void LocalIndex::unguardedPut(const std::shared_ptr<CacheableKey>& key,
+                              Attribute attribute) {
+  unguardedRemove(key);
+
+  if (!attribute.indexable) {
+    m_unindexable.insert(key);
+    return;
+  }
+
+  if (attribute.value.isDefined()) {
+    if (m_type == IndexType::HASH) {
+      m_hash[attribute.value].insert(key);
+    } else {
+      m_range[attribute.value].insert(key);
+    }
+  }
+  m_values.emplace(key, std::move(attribute.value));
+}
+
+void LocalIndex::unguardedRemove(const std::shared_ptr<CacheableKey>& key) {
+  const auto found = m_values.find(key);
+  if (found == m_values.end()) {
+    m_unindexable.erase(key);
+    return;
+  }
+
+  if (found->second.isDefined()) {
+    if (m_type == IndexType::HASH) {
+      const auto bucket = m_hash.find(found->second);
+      bucket->second.erase(key);
+      if (bucket->second.empty()) {
+        m_hash.erase(bucket);
+      }
+    } else {
+      const auto bucket = m_range.find(found->second);
+      bucket->second.erase(key);
+      if (bucket->second.empty()) {
+        m_range.erase(bucket);
+      }
+    }
+  }
+  m_values.erase(found);
+}
+
+bool LocalIndex::find(QueryOperator op, const QueryValue& value,
+                      std::vector<std::shared_ptr<CacheableKey>>& keys) const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_populating || !m_unindexable.empty() || op == QueryOperator::NE) {
+    return false;
+  }
+  if (!value.isDefined()) {
+    // nothing compares with UNDEFINED
+    return true;
+  }
+
+  if (op == QueryOperator::EQ) {
+    const KeySet* bucket = nullptr;
+    if (m_type == IndexType::HASH) {
+      const auto found = m_hash.find(value);
+      bucket = found == m_hash.end() ? nullptr : &found->second;
+    } else {
+      const auto found = m_range.find(value);
+      bucket = found == m_range.end() ? nullptr : &found->second;
+    }
+    if (bucket != nullptr) {
+      keys.insert(keys.end(), bucket->begin(), bucket->end());
+    }
+    return true;
+  }
+
+  if (m_type == IndexType::HASH) {
+    return false;
+  }
+  if (value.getKind() == QueryValue::Kind::NIL) {
+    // null is not ordered
+    return true;
+  }
+
+  // values of other kinds never compare, so stop at the edge of the run of
+  // values of the same kind
+  if (op == QueryOperator::LT || op == QueryOperator::LE) {
+    auto end = op == QueryOperator::LT ? m_range.lower_bound(value)
+                                       : m_range.upper_bound(value);
+    while (end != m_range.begin()) {
+      --end;
+      if (end->first.getKind() != value.getKind()) {
+        break;
+      }
+      keys.insert(keys.end(), end->second.begin(), end->second.end());
+    }
+  } else {
+    auto begin = op == QueryOperator::GT ? m_range.upper_bound(value)
+                                         : m_range.lower_bound(value);
+    for (; begin != m_range.end() && begin->first.getKind() == value.getKind();
+         ++begin) {
+      keys.insert(keys.end(), begin->second.begin(), begin->second.end());
+    }
+  }
+  return true;
+}
+
+size_t LocalIndex::size() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_values.size() + m_unindexable.size();
+}
+
+LocalIndexes::LocalIndexes()
+    : m_indexes(std::make_shared<const IndexList>()), m_count(0) {}
+
+std::shared_ptr<LocalIndex> LocalIndexes::create(const std::string& name,
+                                                 QueryPath path,
+                                                 IndexType type) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  auto indexes = std::make_shared<IndexList>(*m_indexes);
+  for (const auto& index : *indexes) {
+    if (index->getName() == name) {
+      throw IllegalStateException("An index named " + name +
+                                  " already exists");
+    }
+  }
+
+  auto index = std::make_shared<LocalIndex>(name, std::move(path), type);
+  indexes->push_back(index);
+  std::atomic_store(&m_indexes,
+                    std::shared_ptr<const IndexList>(std::move(indexes)));
+  ++m_count;
+  return index;
+}
+
+bool LocalIndexes::remove(const std::string& name) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  auto indexes = std::make_shared<IndexList>(*m_indexes);
+  for (auto i = indexes->begin(); i != indexes->end(); ++i) {
+    if ((*i)->getName() == name) {
+      indexes->erase(i);
+      std::atomic_store(&m_indexes,
+                        std::shared_ptr<const IndexList>(std::move(indexes)));
+      --m_count;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::shared_ptr<LocalIndex> LocalIndexes::find(const QueryPath& path,
+                                               QueryOperator op) const {
+  if (op == QueryOperator::NE) {
+    return nullptr;
+  }
+
+  std::shared_ptr<LocalIndex> result;
+  const auto indexes = std::atomic_load(&m_indexes);
+  for (const auto& index : *indexes) {
+    if (!(index->getPath() == path)) {
+      continue;
+    }
+    if (index->getType() == IndexType::HASH) {
+      if (op == QueryOperator::EQ) {
+        return index;
+      }
+    } else if (result == nullptr) {
+      result = index;
+    }
+  }
+  return result;
+}
+
+void LocalIndexes::put(const std::shared_ptr<CacheableKey>& key,
+                       const std::shared_ptr<Cacheable>& value) {
+  const auto indexes = std::atomic_load(&m_indexes);
+  for (const auto& index : *indexes) {
+    index->put(key, value);
+  }
+}
+
+void LocalIndexes::remove(const std::shared_ptr<CacheableKey>& key) {
+  const auto indexes = std::atomic_load(&m_indexes);
+  for (const auto& index : *indexes) {
+    index->remove(key);
+  }
+}
+
+LocalIndexes::Evaluation LocalIndexes::evaluate(
+    const std::shared_ptr<Cacheable>& value) const {
+  Evaluation evaluation;
+  evaluation.m_indexes = std::atomic_load(&m_indexes);
+  if (value != nullptr) {
+    evaluation.m_indexed = true;
+    evaluation.m_attributes.reserve(evaluation.m_indexes->size());
+    for (const auto& index : *evaluation.m_indexes) {
+      evaluation.m_attributes.push_back(index->evaluate(value));
+    }
+  }
+  return evaluation;
+}
+
+bool LocalIndexes::put(const std::shared_ptr<CacheableKey>& key,
+                       const Evaluation& evaluation) {
+  const auto indexes = std::atomic_load(&m_indexes);
+  if (indexes != evaluation.m_indexes) {
+    return false;
+  }
+  for (size_t i = 0; i < indexes->size(); ++i) {
+    if (evaluation.m_indexed) {
+      (*indexes)[i]->put(key, evaluation.m_attributes[i]);
+    } else {
+      (*indexes)[i]->remove(key);
+    }
+  }
+  return true;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
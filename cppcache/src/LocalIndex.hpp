@@ -0,0 +1,207 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALINDEX_H_
+#define GEODE_LOCALINDEX_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <geode/CacheableKey.hpp>
+#include <geode/IndexType.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+#include "QueryValue.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Maps the value of one attribute of a region's cached values to the keys
+ * holding them, so that the local query engine can find the entries
+ * matching a comparison without scanning the region.
+ *
+ * Entries whose attribute cannot be read locally make the index unusable
+ * until they are gone, since the index could no longer answer a query
+ * completely; queries then fall back to scanning.
+ */
+class APACHE_GEODE_EXPORT LocalIndex {
+ public:
+  LocalIndex(std::string name, QueryPath path, IndexType type);
+
+  inline const std::string& getName() const { return m_name; }
+
+  inline const QueryPath& getPath() const { return m_path; }
+
+  inline IndexType getType() const { return m_type; }
+
+  /** The attribute of a value, as the index keeps it. */
+  struct Attribute {
+    QueryValue value;
+    // false if the attribute cannot be read locally
+    bool indexable;
+  };
+
+  /**
+   * Reads the attribute of value, which may deserialize it, so callers
+   * holding locks of their own evaluate values before taking them.
+   */
+  Attribute evaluate(const std::shared_ptr<Cacheable>& value) const;
+
+  /** Indexes key under the attribute of value, replacing any old entry. */
+  void put(const std::shared_ptr<CacheableKey>& key,
+           const std::shared_ptr<Cacheable>& value);
+
+  /** Indexes key under an attribute evaluated beforehand. */
+  void put(const std::shared_ptr<CacheableKey>& key, Attribute attribute);
+
+  void remove(const std::shared_ptr<CacheableKey>& key);
+
+  /**
+   * Adds an entry read while the index is being populated. Entries put or
+   * removed since population began are newer and are left alone.
+   */
+  void populate(const std::shared_ptr<CacheableKey>& key,
+                const std::shared_ptr<Cacheable>& value);
+
+  /** Marks the end of population. */
+  void populated();
+
+  /**
+   * Returns true if the index can answer whether the attribute op value
+   * holds, appending the keys of the entries for which it does to keys.
+   */
+  bool find(QueryOperator op, const QueryValue& value,
+            std::vector<std::shared_ptr<CacheableKey>>& keys) const;
+
+  /** Returns the number of indexed entries. */
+  size_t size() const;
+
+ private:
+  typedef std::unordered_set<
+      std::shared_ptr<CacheableKey>,
+      dereference_hash<std::shared_ptr<CacheableKey>>,
+      dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      KeySet;
+
+  void unguardedRemove(const std::shared_ptr<CacheableKey>& key);
+
+  void unguardedPut(const std::shared_ptr<CacheableKey>& key,
+                    Attribute attribute);
+
+  const std::string m_name;
+  const QueryPath m_path;
+  const IndexType m_type;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::shared_ptr<CacheableKey>, QueryValue,
+                     dereference_hash<std::shared_ptr<CacheableKey>>,
+                     dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      m_values;
+  std::unordered_map<QueryValue, KeySet, QueryValue::Hash> m_hash;
+  std::map<QueryValue, KeySet> m_range;
+  KeySet m_unindexable;
+  bool m_populating;
+  KeySet m_touched;
+};
+
+/**
+ * The indexes of a region. The entries map reports every change to the
+ * region's values here, which costs a single check while there are no
+ * indexes.
+ */
+class APACHE_GEODE_EXPORT LocalIndexes {
+ private:
+  typedef std::vector<std::shared_ptr<LocalIndex>> IndexList;
+
+ public:
+  /**
+   * A value evaluated for every index of the region, so that the entries
+   * map evaluates values before locking a segment and only updates the
+   * indexes under the lock.
+   */
+  class Evaluation {
+   private:
+    friend class LocalIndexes;
+
+    // the indexes the attributes were evaluated for
+    std::shared_ptr<const IndexList> m_indexes;
+    // false for a value the indexes drop, such as a token
+    bool m_indexed = false;
+    std::vector<LocalIndex::Attribute> m_attributes;
+  };
+
+  LocalIndexes();
+
+  inline bool empty() const { return m_count.load() == 0; }
+
+  /**
+   * Adds a new, empty index. Throws IllegalStateException if an index with
+   * the same name exists.
+   */
+  std::shared_ptr<LocalIndex> create(const std::string& name, QueryPath path,
+                                     IndexType type);
+
+  /** Returns false if there is no index with the given name. */
+  bool remove(const std::string& name);
+
+  /**
+   * Returns the index on path able to answer op, preferring hash indexes
+   * for equality, or nullptr if there is none.
+   */
+  std::shared_ptr<LocalIndex> find(const QueryPath& path,
+                                   QueryOperator op) const;
+
+  void put(const std::shared_ptr<CacheableKey>& key,
+           const std::shared_ptr<Cacheable>& value);
+
+  void remove(const std::shared_ptr<CacheableKey>& key);
+
+  /**
+   * Evaluates value for the current indexes, or for none if value is
+   * nullptr, in which case put removes the key.
+   */
+  Evaluation evaluate(const std::shared_ptr<Cacheable>& value) const;
+
+  /**
+   * Updates the indexes of key with an evaluation. Returns false, changing
+   * nothing, if indexes were created or removed since the evaluation.
+   */
+  bool put(const std::shared_ptr<CacheableKey>& key,
+           const Evaluation& evaluation);
+
+ private:
+  // replaced, never modified, so that puts can iterate without locking
+  std::shared_ptr<const IndexList> m_indexes;
+  std::atomic<size_t> m_count;
+  std::mutex m_mutex;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALINDEX_H_
@@ -0,0 +1,702 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LocalQuery.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <regex>
+#include <unordered_map>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "LocalIndex.hpp"
+#include "ResultSetImpl.hpp"
+#include "StructSetImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+const std::regex PREDICATE_IS_FULL_QUERY_REGEX("^\\s*(?:select|import)\\b",
+                                               std::regex::icase);
+
+struct Token {
+  enum class Type { IDENTIFIER, NUMBER, STRING, SYMBOL, END };
+
+  Type type;
+  std::string text;
+};
+
+bool isIdentifierStart(char c) {
+  return std::isalpha(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+}
+
+bool isIdentifierPart(char c) {
+  return isIdentifierStart(c) || std::isdigit(static_cast<unsigned char>(c)) ||
+         c == '-';
+}
+
+bool isDigit(const std::string& query, size_t position) {
+  return position < query.size() &&
+         std::isdigit(static_cast<unsigned char>(query[position]));
+}
+
+std::vector<Token> tokenize(const std::string& query) {
+  std::vector<Token> tokens;
+  size_t position = 0;
+  while (position < query.size()) {
+    const auto c = query[position];
+    const auto start = position;
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      ++position;
+    } else if (isIdentifierStart(c)) {
+      while (position < query.size() && isIdentifierPart(query[position])) {
+        ++position;
+      }
+      tokens.push_back({Token::Type::IDENTIFIER,
+                        query.substr(start, position - start)});
+    } else if (isDigit(query, position) ||
+               (c == '-' && isDigit(query, position + 1))) {
+      ++position;
+      while (isDigit(query, position)) {
+        ++position;
+      }
+      if (position < query.size() && query[position] == '.' &&
+          isDigit(query, position + 1)) {
+        position += 2;
+        while (isDigit(query, position)) {
+          ++position;
+        }
+      }
+      if (position < query.size() &&
+          (query[position] == 'e' || query[position] == 'E')) {
+        ++position;
+        if (position < query.size() &&
+            (query[position] == '+' || query[position] == '-')) {
+          ++position;
+        }
+        while (isDigit(query, position)) {
+          ++position;
+        }
+      }
+      if (position < query.size() &&
+          std::strchr("lLdDfF", query[position]) != nullptr) {
+        ++position;
+      }
+      tokens.push_back(
+          {Token::Type::NUMBER, query.substr(start, position - start)});
+    } else if (c == '\'') {
+      std::string text;
+      for (++position;; ++position) {
+        if (position >= query.size()) {
+          throw QueryException("Unterminated string literal in query");
+        }
+        if (query[position] == '\'') {
+          if (position + 1 < query.size() && query[position + 1] == '\'') {
+            ++position;
+          } else {
+            ++position;
+            break;
+          }
+        }
+        text += query[position];
+      }
+      tokens.push_back({Token::Type::STRING, std::move(text)});
+    } else {
+      static const char* const kTwoCharacterSymbols[] = {"<>", "!=", "<=",
+                                                         ">="};
+      std::string symbol(1, c);
+      for (const auto candidate : kTwoCharacterSymbols) {
+        if (query.compare(position, 2, candidate) == 0) {
+          symbol = candidate;
+          break;
+        }
+      }
+      if (symbol.size() == 1 && std::strchr("*,.()=<>/", c) == nullptr) {
+        throw QueryException("Unexpected character '" + symbol +
+                             "' in query");
+      }
+      position += symbol.size();
+      tokens.push_back({Token::Type::SYMBOL, std::move(symbol)});
+    }
+  }
+  tokens.push_back({Token::Type::END, ""});
+  return tokens;
+}
+
+bool equalsIgnoreCase(const std::string& text, const char* keyword) {
+  size_t i = 0;
+  for (; i < text.size() && keyword[i] != '\0'; ++i) {
+    if (std::tolower(static_cast<unsigned char>(text[i])) != keyword[i]) {
+      return false;
+    }
+  }
+  return i == text.size() && keyword[i] == '\0';
+}
+
+bool isReserved(const std::string& text) {
+  static const char* const kReserved[] = {
+      "select", "distinct", "from", "where", "as",    "and",
+      "or",     "not",      "limit", "order", "group", "import"};
+  for (const auto keyword : kReserved) {
+    if (equalsIgnoreCase(text, keyword)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+QueryOperator mirror(QueryOperator op) {
+  switch (op) {
+    case QueryOperator::LT:
+      return QueryOperator::GT;
+    case QueryOperator::LE:
+      return QueryOperator::GE;
+    case QueryOperator::GT:
+      return QueryOperator::LT;
+    case QueryOperator::GE:
+      return QueryOperator::LE;
+    default:
+      return op;
+  }
+}
+
+struct Operand {
+  Operand() : isLiteral(false) {}
+
+  QueryValue evaluate(const std::shared_ptr<Cacheable>& value) const {
+    return isLiteral ? literal : path.evaluate(value);
+  }
+
+  bool isLiteral;
+  QueryPath path;
+  QueryValue literal;
+};
+
+// Conditions on UNDEFINED attributes are neither true nor false, and
+// negating them does not make them true.
+enum class Truth { IS_FALSE, IS_TRUE, UNKNOWN };
+
+Truth truthOf(bool value) { return value ? Truth::IS_TRUE : Truth::IS_FALSE; }
+
+int32_t hashOf(const std::shared_ptr<Cacheable>& value) {
+  if (auto key = dynamic_cast<const CacheableKey*>(value.get())) {
+    return key->hashcode();
+  }
+  return static_cast<int32_t>(std::hash<Cacheable*>{}(value.get()));
+}
+
+bool sameValue(const std::shared_ptr<Cacheable>& lhs,
+               const std::shared_ptr<Cacheable>& rhs) {
+  if (lhs == rhs) {
+    return true;
+  }
+  auto lhsKey = dynamic_cast<const CacheableKey*>(lhs.get());
+  auto rhsKey = dynamic_cast<const CacheableKey*>(rhs.get());
+  return lhsKey != nullptr && rhsKey != nullptr && *lhsKey == *rhsKey;
+}
+
+// The rows already selected by a DISTINCT query.
+class DistinctRows {
+ public:
+  typedef std::vector<std::shared_ptr<Cacheable>> Row;
+
+  /** Returns false if an equal row was already added. */
+  bool add(const Row& row) {
+    size_t hash = 17;
+    for (const auto& value : row) {
+      hash = hash * 31 + static_cast<size_t>(hashOf(value));
+    }
+
+    const auto range = m_rows.equal_range(hash);
+    for (auto i = range.first; i != range.second; ++i) {
+      if (std::equal(row.begin(), row.end(), i->second.begin(), sameValue)) {
+        return false;
+      }
+    }
+    m_rows.emplace(hash, row);
+    return true;
+  }
+
+ private:
+  std::unordered_multimap<size_t, Row> m_rows;
+};
+
+}  // namespace
+
+struct LocalQuery::Condition {
+  enum class Type { OR, AND, NOT, COMPARE, TEST };
+
+  explicit Condition(Type type) : type(type), op(QueryOperator::EQ) {}
+
+  Truth evaluate(const std::shared_ptr<Cacheable>& value) const {
+    switch (type) {
+      case Type::OR: {
+        auto result = Truth::IS_FALSE;
+        for (const auto& operand : operands) {
+          const auto truth = operand->evaluate(value);
+          if (truth == Truth::IS_TRUE) {
+            return truth;
+          } else if (truth == Truth::UNKNOWN) {
+            result = truth;
+          }
+        }
+        return result;
+      }
+      case Type::AND: {
+        auto result = Truth::IS_TRUE;
+        for (const auto& operand : operands) {
+          const auto truth = operand->evaluate(value);
+          if (truth == Truth::IS_FALSE) {
+            return truth;
+          } else if (truth == Truth::UNKNOWN) {
+            result = truth;
+          }
+        }
+        return result;
+      }
+      case Type::NOT: {
+        const auto truth = operands.front()->evaluate(value);
+        return truth == Truth::UNKNOWN ? truth
+                                       : truthOf(truth == Truth::IS_FALSE);
+      }
+      case Type::COMPARE: {
+        const auto left = lhs.evaluate(value);
+        const auto right = rhs.evaluate(value);
+        if (!left.isDefined() || !right.isDefined()) {
+          return Truth::UNKNOWN;
+        }
+        return truthOf(left.satisfies(op, right));
+      }
+      case Type::TEST: {
+        const auto result = lhs.evaluate(value);
+        if (result.getKind() == QueryValue::Kind::BOOLEAN) {
+          return truthOf(result.satisfies(QueryOperator::EQ,
+                                          QueryValue::ofBoolean(true)));
+        } else if (result.getKind() == QueryValue::Kind::NUMBER ||
+                   result.getKind() == QueryValue::Kind::STRING) {
+          throw QueryException(lhs.path.toString() + " is not a boolean");
+        }
+        return Truth::UNKNOWN;
+      }
+    }
+    return Truth::UNKNOWN;
+  }
+
+  Type type;
+  std::vector<std::unique_ptr<Condition>> operands;
+  Operand lhs;
+  Operand rhs;
+  QueryOperator op;
+};
+
+class LocalQuery::Parser {
+ public:
+  Parser(const std::string& query, LocalQuery* result)
+      : m_tokens(tokenize(query)), m_position(0), m_result(result) {}
+
+  QueryPath parsePath() {
+    auto path = toPath(parsePathNames());
+    if (peek().type != Token::Type::END) {
+      unexpected();
+    }
+    return path;
+  }
+
+  void parse() {
+    expectKeyword("select");
+    m_result->m_distinct = acceptKeyword("distinct");
+
+    std::vector<std::pair<std::vector<std::string>, std::string>> projections;
+    if (acceptSymbol("*")) {
+      projections.emplace_back();
+    } else {
+      do {
+        auto path = parsePathNames();
+        std::string name;
+        if (acceptKeyword("as")) {
+          name = expectIdentifier();
+        }
+        projections.emplace_back(std::move(path), std::move(name));
+      } while (acceptSymbol(","));
+    }
+
+    expectKeyword("from");
+    parseRegion();
+
+    for (auto& projection : projections) {
+      auto& names = projection.first;
+      auto name = projection.second;
+      if (name.empty()) {
+        name = names.empty() ? m_alias : names.back();
+      }
+      m_result->m_projections.push_back(
+          {toPath(std::move(names)), std::move(name)});
+    }
+
+    if (acceptKeyword("where")) {
+      m_result->m_where = parseOr();
+    }
+
+    if (acceptKeyword("limit")) {
+      const auto& token = next();
+      if (token.type != Token::Type::NUMBER ||
+          token.text.find_first_not_of("0123456789") != std::string::npos) {
+        throw QueryException("LIMIT must be a non-negative integer");
+      }
+      m_result->m_limit = std::strtoull(token.text.c_str(), nullptr, 10);
+    }
+
+    if (peek().type != Token::Type::END) {
+      unexpected();
+    }
+  }
+
+ private:
+  const Token& peek() const { return m_tokens[m_position]; }
+
+  const Token& next() {
+    const auto& token = m_tokens[m_position];
+    if (token.type != Token::Type::END) {
+      ++m_position;
+    }
+    return token;
+  }
+
+  [[noreturn]] void unexpected() const {
+    const auto& token = peek();
+    if (token.type == Token::Type::END) {
+      throw QueryException("Unexpected end of query");
+    }
+    throw QueryException("Unexpected '" + token.text +
+                         "' in query; only SELECT ... FROM ... WHERE ... "
+                         "LIMIT over a single region can be run locally");
+  }
+
+  bool isKeyword(const char* keyword) const {
+    return peek().type == Token::Type::IDENTIFIER &&
+           equalsIgnoreCase(peek().text, keyword);
+  }
+
+  bool acceptKeyword(const char* keyword) {
+    if (isKeyword(keyword)) {
+      ++m_position;
+      return true;
+    }
+    return false;
+  }
+
+  void expectKeyword(const char* keyword) {
+    if (!acceptKeyword(keyword)) {
+      unexpected();
+    }
+  }
+
+  bool acceptSymbol(const char* symbol) {
+    if (peek().type == Token::Type::SYMBOL && peek().text == symbol) {
+      ++m_position;
+      return true;
+    }
+    return false;
+  }
+
+  void expectSymbol(const char* symbol) {
+    if (!acceptSymbol(symbol)) {
+      unexpected();
+    }
+  }
+
+  std::string expectIdentifier() {
+    if (peek().type != Token::Type::IDENTIFIER || isReserved(peek().text)) {
+      unexpected();
+    }
+    if (peek().text[0] == '$') {
+      throw QueryException("Query parameters cannot be bound locally");
+    }
+    return next().text;
+  }
+
+  void parseRegion() {
+    if (peek().type != Token::Type::SYMBOL || peek().text != "/") {
+      unexpected();
+    }
+    while (acceptSymbol("/")) {
+      m_result->m_regionPath += '/';
+      m_result->m_regionPath += expectIdentifier();
+    }
+
+    if (acceptKeyword("as") || (peek().type == Token::Type::IDENTIFIER &&
+                                !isReserved(peek().text))) {
+      m_alias = expectIdentifier();
+    }
+  }
+
+  std::vector<std::string> parsePathNames() {
+    std::vector<std::string> names;
+    names.push_back(expectIdentifier());
+    while (acceptSymbol(".")) {
+      names.push_back(expectIdentifier());
+    }
+    if (peek().type == Token::Type::SYMBOL && peek().text == "(") {
+      throw QueryException("Method invocations cannot be evaluated locally");
+    }
+    return names;
+  }
+
+  // the iterator variable, named by the alias or this, is the value itself
+  QueryPath toPath(std::vector<std::string> names) const {
+    if (!names.empty() &&
+        (names.front() == "this" ||
+         (!m_alias.empty() && names.front() == m_alias))) {
+      names.erase(names.begin());
+    }
+    return QueryPath(std::move(names));
+  }
+
+  QueryValue toNumber(const std::string& text) const {
+    const auto suffix = text.back();
+    const auto isInteger =
+        text.find_first_of(".eEdDfF") == std::string::npos;
+    errno = 0;
+    if (isInteger) {
+      const auto value = std::strtoll(text.c_str(), nullptr, 10);
+      if (errno == ERANGE ||
+          ((suffix != 'l' && suffix != 'L') &&
+           (value > std::numeric_limits<int32_t>::max() ||
+            value < std::numeric_limits<int32_t>::min()))) {
+        throw QueryException("Number " + text + " is out of range");
+      }
+      return QueryValue::ofInteger(value);
+    }
+    return QueryValue::ofDouble(std::strtod(text.c_str(), nullptr));
+  }
+
+  std::unique_ptr<Condition> parseOr() {
+    auto condition = parseAnd();
+    if (!isKeyword("or")) {
+      return condition;
+    }
+    std::unique_ptr<Condition> result(new Condition(Condition::Type::OR));
+    result->operands.push_back(std::move(condition));
+    while (acceptKeyword("or")) {
+      result->operands.push_back(parseAnd());
+    }
+    return result;
+  }
+
+  std::unique_ptr<Condition> parseAnd() {
+    auto condition = parseNot();
+    if (!isKeyword("and")) {
+      return condition;
+    }
+    std::unique_ptr<Condition> result(new Condition(Condition::Type::AND));
+    result->operands.push_back(std::move(condition));
+    while (acceptKeyword("and")) {
+      result->operands.push_back(parseNot());
+    }
+    return result;
+  }
+
+  std::unique_ptr<Condition> parseNot() {
+    if (acceptKeyword("not")) {
+      std::unique_ptr<Condition> result(new Condition(Condition::Type::NOT));
+      result->operands.push_back(parseNot());
+      return result;
+    }
+    return parseComparison();
+  }
+
+  std::unique_ptr<Condition> parseComparison() {
+    if (acceptSymbol("(")) {
+      auto result = parseOr();
+      expectSymbol(")");
+      return result;
+    }
+
+    std::unique_ptr<Condition> result(new Condition(Condition::Type::TEST));
+    result->lhs = parseOperand();
+
+    static const std::pair<const char*, QueryOperator> kOperators[] = {
+        {"=", QueryOperator::EQ},  {"<>", QueryOperator::NE},
+        {"!=", QueryOperator::NE}, {"<", QueryOperator::LT},
+        {"<=", QueryOperator::LE}, {">", QueryOperator::GT},
+        {">=", QueryOperator::GE}};
+    for (const auto& op : kOperators) {
+      if (acceptSymbol(op.first)) {
+        result->type = Condition::Type::COMPARE;
+        result->op = op.second;
+        result->rhs = parseOperand();
+        break;
+      }
+    }
+
+    if (result->type == Condition::Type::TEST && result->lhs.isLiteral) {
+      unexpected();
+    }
+    return result;
+  }
+
+  Operand parseOperand() {
+    Operand operand;
+    const auto& token = peek();
+    if (token.type == Token::Type::NUMBER) {
+      operand.isLiteral = true;
+      operand.literal = toNumber(next().text);
+    } else if (token.type == Token::Type::STRING) {
+      operand.isLiteral = true;
+      operand.literal = QueryValue::ofString(next().text);
+    } else if (isKeyword("true") || isKeyword("false")) {
+      operand.isLiteral = true;
+      operand.literal = QueryValue::ofBoolean(isKeyword("true"));
+      next();
+    } else if (isKeyword("null")) {
+      operand.isLiteral = true;
+      operand.literal = QueryValue::ofNull();
+      next();
+    } else {
+      operand.path = toPath(parsePathNames());
+    }
+    return operand;
+  }
+
+  std::vector<Token> m_tokens;
+  size_t m_position;
+  // null when only parsing a path
+  LocalQuery* m_result;
+  std::string m_alias;
+};
+
+std::string LocalQuery::forPredicate(const std::string& regionPath,
+                                     const std::string& predicate) {
+  if (std::regex_search(predicate, PREDICATE_IS_FULL_QUERY_REGEX)) {
+    return predicate;
+  }
+  return "select distinct * from " + regionPath + " this where " + predicate;
+}
+
+QueryPath LocalQuery::parsePath(const std::string& expression) {
+  return Parser(expression, nullptr).parsePath();
+}
+
+LocalQuery::LocalQuery(const std::string& query)
+    : m_distinct(false), m_limit(std::numeric_limits<size_t>::max()) {
+  Parser(query, this).parse();
+}
+
+LocalQuery::~LocalQuery() noexcept = default;
+
+bool LocalQuery::findCandidates(
+    const LocalQuerySource& source,
+    std::vector<std::shared_ptr<CacheableKey>>& keys) const {
+  const auto indexes = source.getIndexes();
+  if (m_where == nullptr || indexes == nullptr || indexes->empty()) {
+    return false;
+  }
+
+  std::vector<const Condition*> terms;
+  if (m_where->type == Condition::Type::AND) {
+    for (const auto& operand : m_where->operands) {
+      terms.push_back(operand.get());
+    }
+  } else {
+    terms.push_back(m_where.get());
+  }
+
+  for (const auto term : terms) {
+    if (term->type != Condition::Type::COMPARE ||
+        term->lhs.isLiteral == term->rhs.isLiteral) {
+      continue;
+    }
+    const auto& path = term->lhs.isLiteral ? term->rhs.path : term->lhs.path;
+    const auto& literal =
+        term->lhs.isLiteral ? term->lhs.literal : term->rhs.literal;
+    const auto op = term->lhs.isLiteral ? mirror(term->op) : term->op;
+
+    const auto index = indexes->find(path, op);
+    if (index != nullptr && index->find(op, literal, keys)) {
+      return true;
+    }
+    keys.clear();
+  }
+  return false;
+}
+
+bool LocalQuery::matches(const std::shared_ptr<Cacheable>& value) const {
+  return m_where == nullptr || m_where->evaluate(value) == Truth::IS_TRUE;
+}
+
+std::shared_ptr<SelectResults> LocalQuery::execute(
+    const LocalQuerySource& source) const {
+  LocalQuerySource::Entries entries;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  if (findCandidates(source, keys)) {
+    entries.reserve(keys.size());
+    for (auto& key : keys) {
+      auto value = source.getValue(key);
+      if (value != nullptr) {
+        entries.emplace_back(std::move(key), std::move(value));
+      }
+    }
+  } else {
+    entries = source.getEntries();
+  }
+
+  auto values = CacheableVector::create();
+  DistinctRows distinctRows;
+  DistinctRows::Row row(m_projections.size());
+  size_t rows = 0;
+  for (const auto& entry : entries) {
+    if (rows >= m_limit) {
+      break;
+    }
+    if (!matches(entry.second)) {
+      continue;
+    }
+
+    for (size_t i = 0; i < m_projections.size(); ++i) {
+      bool defined;
+      row[i] = m_projections[i].path.resolve(entry.second, defined);
+    }
+    if (m_distinct && !distinctRows.add(row)) {
+      continue;
+    }
+    values->insert(values->end(), row.begin(), row.end());
+    ++rows;
+  }
+
+  if (m_projections.size() == 1) {
+    return std::make_shared<ResultSetImpl>(values);
+  }
+
+  std::vector<std::string> fieldNames;
+  for (const auto& projection : m_projections) {
+    fieldNames.push_back(projection.name);
+  }
+  return std::make_shared<StructSetImpl>(values, fieldNames);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
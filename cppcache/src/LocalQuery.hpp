@@ -0,0 +1,139 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALQUERY_H_
+#define GEODE_LOCALQUERY_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geode/CacheableKey.hpp>
+#include <geode/SelectResults.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+#include "QueryValue.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class LocalIndexes;
+
+/**
+ * The cached entries a LocalQuery runs against.
+ */
+class APACHE_GEODE_EXPORT LocalQuerySource {
+ public:
+  typedef std::vector<
+      std::pair<std::shared_ptr<CacheableKey>, std::shared_ptr<Cacheable>>>
+      Entries;
+
+  virtual ~LocalQuerySource() noexcept = default;
+
+  /** Returns every entry with a value, deserialized. */
+  virtual Entries getEntries() const = 0;
+
+  /** Returns the deserialized value of key, or nullptr if there is none. */
+  virtual std::shared_ptr<Cacheable> getValue(
+      const std::shared_ptr<CacheableKey>& key) const = 0;
+
+  /** Returns the indexes over the entries, or nullptr if there are none. */
+  virtual const LocalIndexes* getIndexes() const = 0;
+};
+
+/**
+ * A query over a single region, evaluated against its cached entries.
+ *
+ * Only a subset of OQL is understood:
+ * <pre>
+ * SELECT [DISTINCT] (* | alias | path [AS name] [, ...])
+ *   FROM /region [[AS] alias]
+ *   [WHERE condition]
+ *   [LIMIT n]
+ * </pre>
+ * where a condition combines comparisons (=, &lt;&gt;, !=, &lt;, &lt;=,
+ * &gt;, &gt;=) of attribute paths and literals with AND, OR, NOT and
+ * parentheses. Anything else is rejected with a QueryException when the
+ * query is parsed, so that callers can hand the query to the server instead.
+ *
+ * A comparison of an attribute with a literal, alone or as a term of the
+ * top-level AND, is answered from an index on that attribute when there is
+ * one; every candidate it yields is still checked against the whole
+ * condition.
+ */
+class APACHE_GEODE_EXPORT LocalQuery {
+ public:
+  /**
+   * Returns the query Region::query runs for predicate, which is either a
+   * full query or a condition on the values of the region at regionPath.
+   */
+  static std::string forPredicate(const std::string& regionPath,
+                                  const std::string& predicate);
+
+  /**
+   * Parses an attribute path such as <code>this.address.city</code>; throws
+   * QueryException if expression is anything else.
+   */
+  static QueryPath parsePath(const std::string& expression);
+
+  /** Parses query; throws QueryException if it cannot run locally. */
+  explicit LocalQuery(const std::string& query);
+
+  ~LocalQuery() noexcept;
+
+  LocalQuery(const LocalQuery&) = delete;
+  LocalQuery& operator=(const LocalQuery&) = delete;
+
+  /** The full path of the region named in the FROM clause. */
+  inline const std::string& getRegionPath() const { return m_regionPath; }
+
+  /**
+   * Runs the query. Throws QueryException if an attribute it reads cannot
+   * be read locally.
+   */
+  std::shared_ptr<SelectResults> execute(const LocalQuerySource& source) const;
+
+ private:
+  struct Condition;
+  class Parser;
+
+  struct Projection {
+    QueryPath path;
+    std::string name;
+  };
+
+  bool findCandidates(const LocalQuerySource& source,
+                      std::vector<std::shared_ptr<CacheableKey>>& keys) const;
+
+  bool matches(const std::shared_ptr<Cacheable>& value) const;
+
+  std::string m_regionPath;
+  bool m_distinct;
+  std::vector<Projection> m_projections;
+  std::unique_ptr<Condition> m_where;
+  size_t m_limit;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERY_H_
@@ -29,6 +29,7 @@
 #include "EntryExpiryHandler.hpp"
 #include "ExpiryTaskManager.hpp"
 #include "LRUEntriesMap.hpp"
+#include "LocalQuery.hpp"
 #include "RegionExpiryHandler.hpp"
 #include "RegionGlobalLocks.hpp"
 #include "SerializableHelper.hpp"
@@ -541,6 +542,11 @@ std::vector<std::shared_ptr<Cacheable>> LocalRegion::values() {
   if (m_regionAttributes.getCachingEnabled()) {
     // invalidToken should not be added by the MapSegments.
     m_entries->getValues(values);
+    if (m_regionAttributes.getStoreSerializedValues()) {
+      for (auto& value : values) {
+        value = fromStoredValue(value);
+      }
+    }
   }
 
   return values;
@@ -871,6 +877,7 @@ GfErrType LocalRegion::getNoThrow(
       cachePerfStats.incHits();
       updateAccessAndModifiedTimeForEntry(me, false);
       updateAccessAndModifiedTime(false);
+      value = fromStoredValue(value);
       return err;  // found it in local cache...
     }
     localValue = value;
@@ -1043,7 +1050,7 @@ GfErrType LocalRegion::getAllNoThrow(
         cachePerfStats.incHits();
         updateAccessAndModifiedTimeForEntry(me, false);
         regionAccessed = true;
-        values->emplace(key, value);
+        values->emplace(key, fromStoredValue(value));
       } else {
         value = nullptr;
       }
@@ -1414,6 +1421,7 @@ class RemoveActions {
     GfErrType err = GF_NOERR;
     if (!allowNULLValue && m_region.getAttributes().getCachingEnabled()) {
       m_region.getEntry(key, oldValue);
+      oldValue = m_region.fromStoredValue(oldValue);
       if (oldValue != nullptr && newValue != nullptr) {
         if (!serializedEqualTo(oldValue, newValue)) {
           err = GF_ENOENT;
@@ -1454,6 +1462,7 @@ class RemoveActions {
     GfErrType err = GF_NOERR;
     if (!allowNULLValue && cachingEnabled) {
       m_region.getEntry(key, valuePtr);
+      valuePtr = m_region.fromStoredValue(valuePtr);
       if (valuePtr != nullptr && value != nullptr) {
         if (!serializedEqualTo(valuePtr, value)) {
           err = GF_ENOENT;
@@ -1720,7 +1729,8 @@ GfErrType LocalRegion::updateNoThrow(
       std::shared_ptr<VersionTag> versionTag1;
       err = getNoThrow_FullObject(eventId, newValue1, versionTag1);
       if (err == GF_NOERR && newValue1 != nullptr) {
-        err = m_entries->put(key, newValue1, entry, oldValue, updateCount, 0,
+        err = m_entries->put(key, toStoredValue(newValue1), entry, oldValue,
+                             updateCount, 0,
                              versionTag1 != nullptr ? versionTag1 : versionTag);
         if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
           LOGDEBUG(
@@ -1978,95 +1988,95 @@ GfErrType LocalRegion::putAllNoThrow(
                                   aCallbackArgument)) != GF_NOERR) {
     return err;
   }
-  // next the local puts
-  GfErrType localErr;
-  std::shared_ptr<VersionTag> versionTag;
-
+  // next the local puts, applied as one batch a segment lock at a time
+  // before the listeners are invoked for them
   if (cachingEnabled) {
+    GfErrType localErr;
+    MapPutBatch puts;
+    std::vector<std::shared_ptr<VersionTag>> versionTags;
+    if (versionedObjPartListPtr != nullptr) {
+      versionTags = versionedObjPartListPtr->getVersionedTagptr();
+    }
+    auto addPut = [&puts, &oldValueMap, &versionTags](
+                      const std::shared_ptr<CacheableKey>& key,
+                      const std::shared_ptr<Cacheable>& value, size_t index) {
+      const auto& p = oldValueMap[key];
+      puts.keys.push_back(key);
+      puts.values.push_back(value);
+      if (!versionTags.empty()) {
+        puts.versionTags.push_back(versionTags[index]);
+      }
+      puts.updateCounts.push_back(p.second);
+      MapPutBatch::Result result;
+      result.oldValue = p.first;
+      puts.results.push_back(std::move(result));
+    };
+
     if (m_isPRSingleHopEnabled) { /*New PRSingleHop Case:: PR Singlehop
                                      condition*/
-      for (size_t keyIndex = 0;
-           keyIndex < versionedObjPartListPtr->getSucceededKeys()->size();
-           keyIndex++) {
-        const auto valPtr =
-            versionedObjPartListPtr->getSucceededKeys()->at(keyIndex);
-        const auto& mapIter = map.find(valPtr);
-        std::shared_ptr<CacheableKey> key = nullptr;
-        std::shared_ptr<Cacheable> value = nullptr;
-
-        if (mapIter != map.end()) {
-          key = mapIter->first;
-          value = mapIter->second;
-        } else {
+      const auto& succeededKeys = *versionedObjPartListPtr->getSucceededKeys();
+      for (size_t keyIndex = 0; keyIndex < succeededKeys.size(); keyIndex++) {
+        const auto& mapIter = map.find(succeededKeys[keyIndex]);
+        if (mapIter == map.end()) {
           // ThrowERROR
           LOGERROR(
               "ERROR :: LocalRegion::putAllNoThrow() Key must be found in "
               "the "
               "usermap");
+          return GF_CACHE_ILLEGAL_ARGUMENT_EXCEPTION;
         }
-
-        if (versionedObjPartListPtr) {
-          LOGDEBUG("versionedObjPartListPtr->getVersionedTagptr().size() = %d ",
-                   versionedObjPartListPtr->getVersionedTagptr().size());
-          if (versionedObjPartListPtr->getVersionedTagptr().size() > 0) {
-            versionTag =
-                versionedObjPartListPtr->getVersionedTagptr()[keyIndex];
-          }
-        }
-        std::pair<std::shared_ptr<Cacheable>, int>& p = oldValueMap[key];
-        if ((localErr = LocalRegion::putNoThrow(
-                 key, value, aCallbackArgument, p.first, p.second,
-                 CacheEventFlags::LOCAL | CacheEventFlags::NOCACHEWRITER,
-                 versionTag)) == GF_CACHE_ENTRY_UPDATED) {
-          LOGFINEST(
-              "Region::putAll: did not change local value for key [%s] "
-              "since it has been updated by another thread while operation "
-              "was "
-              "in progress",
-              Utils::nullSafeToString(key).c_str());
-        } else if (localErr == GF_CACHE_LISTENER_EXCEPTION) {
-          LOGFINER("Region::putAll: invoke listener error [%d] for key [%s]",
-                   localErr, Utils::nullSafeToString(key).c_str());
-          err = localErr;
-        } else if (localErr != GF_NOERR) {
-          return localErr;
-        }
-      }      // End of for loop
+        addPut(mapIter->first, mapIter->second, keyIndex);
+      }
     } else { /*Non SingleHop case :: PUTALL has taken multiple hops*/
       LOGDEBUG(
           "NILKANTH LocalRegion::putAllNoThrow m_isPRSingleHopEnabled = %d "
           "expected false",
           m_isPRSingleHopEnabled);
-      int index = 0;
+      size_t index = 0;
       for (const auto& iter : map) {
-        const auto& key = iter.first;
-        const auto& value = iter.second;
-        auto& p = oldValueMap[key];
-
-        if (versionedObjPartListPtr) {
-          LOGDEBUG("versionedObjPartListPtr->getVersionedTagptr().size() = %d ",
-                   versionedObjPartListPtr->getVersionedTagptr().size());
-          if (versionedObjPartListPtr->getVersionedTagptr().size() > 0) {
-            versionTag = versionedObjPartListPtr->getVersionedTagptr()[index++];
-          }
-        }
-        if ((localErr = LocalRegion::putNoThrow(
-                 key, value, aCallbackArgument, p.first, p.second,
-                 CacheEventFlags::LOCAL | CacheEventFlags::NOCACHEWRITER,
-                 versionTag)) == GF_CACHE_ENTRY_UPDATED) {
-          LOGFINEST(
-              "Region::putAll: did not change local value for key [%s] "
-              "since it has been updated by another thread while operation "
-              "was "
-              "in progress",
-              Utils::nullSafeToString(key).c_str());
-        } else if (localErr == GF_CACHE_LISTENER_EXCEPTION) {
-          LOGFINER("Region::putAll: invoke listener error [%d] for key [%s]",
-                   localErr, Utils::nullSafeToString(key).c_str());
-          err = localErr;
-        } else if (localErr != GF_NOERR) {
-          return localErr;
-        }
+        addPut(iter.first, iter.second, index++);
+      }
+    }
+    for (size_t index = 0; index < puts.keys.size(); ++index) {
+      if ((localErr = PutActions::checkArgs(puts.keys[index],
+                                            puts.values[index])) != GF_NOERR) {
+        return localErr;
+      }
+    }
+
+    // the batch replaces its values with their stored form
+    const auto values = puts.values;
+    putLocalBatch("Region::putAll", puts, 0);
+
+    for (size_t index = 0; index < puts.keys.size(); ++index) {
+      const auto& key = puts.keys[index];
+      auto& result = puts.results[index];
+      if (result.err == GF_CACHE_ENTRY_UPDATED) {
+        LOGFINEST(
+            "Region::putAll: did not change local value for key [%s] "
+            "since it has been updated by another thread while operation "
+            "was "
+            "in progress",
+            Utils::nullSafeToString(key).c_str());
+      } else if (result.err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+        LOGDEBUG(
+            "Region::putAll: put for key [%s] failed because the cache "
+            "already contains an entry with higher version. The cache "
+            "listener will not be invoked.",
+            Utils::nullSafeToString(key).c_str());
+        continue;
+      } else if (result.err != GF_NOERR) {
+        return result.err;
+      }
+      if ((localErr = invokeCacheListenerForEntryEvent(
+               key, result.oldValue, values[index], aCallbackArgument,
+               CacheEventFlags::LOCAL | CacheEventFlags::NOCACHEWRITER,
+               AFTER_UPDATE)) == GF_CACHE_LISTENER_EXCEPTION) {
+        LOGFINER("Region::putAll: invoke listener error [%d] for key [%s]",
+                 localErr, Utils::nullSafeToString(key).c_str());
+        err = localErr;
+      } else if (localErr != GF_NOERR) {
+        return localErr;
       }
     }
   }
@@ -2284,21 +2294,13 @@ GfErrType LocalRegion::invalidateRegionNoThrow(
   GfErrType err = GF_NOERR;
 
   if (m_regionAttributes.getCachingEnabled()) {
-    std::vector<std::shared_ptr<CacheableKey>> v = keys_internal();
-    auto size = v.size();
-    std::shared_ptr<MapEntryImpl> me;
-    for (decltype(size) i = 0; i < size; i++) {
-      {
-        std::shared_ptr<Cacheable> oldValue;
-        // invalidate all the entries with a nullptr versionTag
-        std::shared_ptr<VersionTag> versionTag;
-        m_entries->invalidate(v.at(i), me, oldValue, versionTag);
-        if (!eventFlags.isEvictOrExpire()) {
-          updateAccessAndModifiedTimeForEntry(me, true);
-        }
-      }
-    }
+    // invalidate all the entries with a nullptr versionTag
+    std::vector<std::shared_ptr<MapEntryImpl>> invalidated;
+    m_entries->invalidateAll(invalidated);
     if (!eventFlags.isEvictOrExpire()) {
+      for (auto& me : invalidated) {
+        updateAccessAndModifiedTimeForEntry(me, true);
+      }
       updateAccessAndModifiedTime(true);
     }
   }
@@ -2455,11 +2457,13 @@ GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
     LOGDEBUG("%s: region [%s] putting key [%s], value [%s]", name.c_str(),
              getFullPath().c_str(), Utils::nullSafeToString(key).c_str(),
              Utils::nullSafeToString(value).c_str());
+    // a delta is applied to the existing value, so value is not stored
+    const auto storedValue = delta == nullptr ? toStoredValue(value) : value;
     if (isCreate) {
-      err = m_entries->create(key, value, entry, oldValue, updateCount,
+      err = m_entries->create(key, storedValue, entry, oldValue, updateCount,
                               destroyTracker, versionTag);
     } else {
-      err = m_entries->put(key, value, entry, oldValue, updateCount,
+      err = m_entries->put(key, storedValue, entry, oldValue, updateCount,
                            destroyTracker, versionTag, isUpdate, delta);
       if (err == GF_INVALID_DELTA) {
         cachePerfStats.incFailureOnDeltaReceived();
@@ -2470,8 +2474,9 @@ GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
         err = getNoThrow_FullObject(eventId, newValue1, versionTag1);
         if (err == GF_NOERR && newValue1 != nullptr) {
           err = m_entries->put(
-              key, newValue1, entry, oldValue, updateCount, destroyTracker,
-              versionTag1 != nullptr ? versionTag1 : versionTag, isUpdate);
+              key, toStoredValue(newValue1), entry, oldValue, updateCount,
+              destroyTracker, versionTag1 != nullptr ? versionTag1 : versionTag,
+              isUpdate);
         }
       }
       if (delta != nullptr &&
@@ -2511,6 +2516,59 @@ GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
   return err;
 }
 
+void LocalRegion::putLocalBatch(const std::string& name, MapPutBatch& batch,
+                                int destroyTracker) {
+  if (batch.keys.empty()) {
+    return;
+  }
+  LOGDEBUG("%s: region [%s] putting a batch of %zu entries", name.c_str(),
+           getFullPath().c_str(), batch.keys.size());
+  for (auto& value : batch.values) {
+    value = toStoredValue(value);
+  }
+  m_entries->putBatch(batch, destroyTracker);
+
+  int32_t created = 0;
+  int32_t updated = 0;
+  const bool expiryEnabled = entryExpiryEnabled();
+  for (auto& result : batch.results) {
+    if (result.err != GF_NOERR) {
+      continue;
+    }
+    // entry expiration
+    if (expiryEnabled) {
+      if (result.isUpdate &&
+          result.entry->getExpProperties().getExpiryTaskId() != -1) {
+        updateAccessAndModifiedTimeForEntry(result.entry, true);
+      } else {
+        registerEntryExpiryTask(result.entry);
+      }
+    }
+    if (result.isUpdate) {
+      ++updated;
+    } else {
+      ++created;
+    }
+  }
+  if (created == 0 && updated == 0) {
+    return;
+  }
+  updateAccessAndModifiedTime(true);
+
+  // update the stats once for the whole batch
+  auto& cachePerfStats = m_cacheImpl->getCachePerfStats();
+  if (updated > 0) {
+    m_regionStats->incPuts(updated);
+    cachePerfStats.incPuts(updated);
+  }
+  if (created > 0) {
+    m_regionStats->setEntries(m_entries->size());
+    cachePerfStats.incEntries(created);
+    m_regionStats->incCreates(created);
+    cachePerfStats.incCreates(created);
+  }
+}
+
 std::vector<std::shared_ptr<CacheableKey>> LocalRegion::keys_internal() {
   std::vector<std::shared_ptr<CacheableKey>> keys;
 
@@ -2551,8 +2609,9 @@ bool LocalRegion::invokeCacheWriterForEntryEvent(
     if (oldValue != nullptr && CacheableToken::isInvalid(oldValue)) {
       oldValue = nullptr;
     }
-    EntryEvent event(shared_from_this(), key, oldValue, newValue,
-                     aCallbackArgument, eventFlags.isNotification());
+    EntryEvent event(shared_from_this(), key, fromStoredValue(oldValue),
+                     fromStoredValue(newValue), aCallbackArgument,
+                     eventFlags.isNotification());
     const char* eventStr = "unknown";
     try {
       bool updateStats = true;
@@ -2662,8 +2721,9 @@ GfErrType LocalRegion::invokeCacheListenerForEntryEvent(
     if (oldValue != nullptr && CacheableToken::isInvalid(oldValue)) {
       oldValue = nullptr;
     }
-    EntryEvent event(shared_from_this(), key, oldValue, newValue,
-                     aCallbackArgument, eventFlags.isNotification());
+    EntryEvent event(shared_from_this(), key, fromStoredValue(oldValue),
+                     fromStoredValue(newValue), aCallbackArgument,
+                     eventFlags.isNotification());
     const char* eventStr = "unknown";
     try {
       bool updateStats = true;
@@ -3162,6 +3222,135 @@ std::shared_ptr<TombstoneList> LocalRegion::getTombstoneList() {
   return m_tombstoneList;
 }
 
+namespace {
+
+class EntriesMapQuerySource : public LocalQuerySource {
+ public:
+  EntriesMapQuerySource(const RegionInternal& region, EntriesMap& entries,
+                        const LocalIndexes& indexes)
+      : m_region(region), m_entries(entries), m_indexes(indexes) {}
+
+  ~EntriesMapQuerySource() noexcept override = default;
+
+  // region entries hold deserialized values already
+  Entries getEntries() const override {
+    std::vector<std::shared_ptr<RegionEntry>> regionEntries;
+    m_entries.getEntries(regionEntries);
+
+    Entries entries;
+    entries.reserve(regionEntries.size());
+    for (const auto& regionEntry : regionEntries) {
+      auto value = regionEntry->getValue();
+      if (CacheableToken::isOverflowed(value)) {
+        value = getValue(regionEntry->getKey());
+      } else if (CacheableToken::isToken(value)) {
+        value = nullptr;
+      }
+      if (value != nullptr) {
+        entries.emplace_back(regionEntry->getKey(), std::move(value));
+      }
+    }
+    return entries;
+  }
+
+  std::shared_ptr<Cacheable> getValue(
+      const std::shared_ptr<CacheableKey>& key) const override {
+    std::shared_ptr<Cacheable> value;
+    std::shared_ptr<MapEntryImpl> entry;
+    m_entries.get(key, value, entry);
+    if (value == nullptr || CacheableToken::isToken(value)) {
+      return nullptr;
+    }
+    return m_region.fromStoredValue(value);
+  }
+
+  const LocalIndexes* getIndexes() const override { return &m_indexes; }
+
+ private:
+  const RegionInternal& m_region;
+  EntriesMap& m_entries;
+  const LocalIndexes& m_indexes;
+};
+
+}  // namespace
+
+std::shared_ptr<SelectResults> LocalRegion::query(
+    const std::string& predicate, std::chrono::milliseconds) {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::query);
+
+  if (predicate.empty()) {
+    LOGERROR("Region query predicate string is empty");
+    throw IllegalArgumentException("Region query predicate string is empty");
+  }
+  if (!m_regionAttributes.getCachingEnabled()) {
+    throw UnsupportedOperationException(
+        "query only supported by Thin Client Region or caching regions.");
+  }
+
+  return executeLocalQuery(
+      LocalQuery(LocalQuery::forPredicate(getFullPath(), predicate)));
+}
+
+bool LocalRegion::existsValue(const std::string& predicate,
+                              std::chrono::milliseconds timeout) {
+  auto results = query(predicate, timeout);
+  return results != nullptr && results->size() > 0;
+}
+
+std::shared_ptr<Serializable> LocalRegion::selectValue(
+    const std::string& predicate, std::chrono::milliseconds timeout) {
+  auto results = query(predicate, timeout);
+
+  if (results == nullptr || results->size() == 0) {
+    return nullptr;
+  }
+
+  if (results->size() > 1) {
+    throw QueryException("selectValue has more than one result");
+  }
+
+  return results->operator[](0);
+}
+
+std::shared_ptr<SelectResults> LocalRegion::executeLocalQuery(
+    const LocalQuery& query) {
+  if (query.getRegionPath() != getFullPath()) {
+    throw QueryException("Region " + getFullPath() +
+                         " cannot locally query region " +
+                         query.getRegionPath());
+  }
+
+  EntriesMapQuerySource source(*this, *m_entries, m_localIndexes);
+  return query.execute(source);
+}
+
+void LocalRegion::createIndex(const std::string& name,
+                              const std::string& expression, IndexType type) {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::createIndex);
+
+  if (!m_regionAttributes.getCachingEnabled()) {
+    throw UnsupportedOperationException(
+        "createIndex only supported by caching regions.");
+  }
+
+  auto index =
+      m_localIndexes.create(name, LocalQuery::parsePath(expression), type);
+
+  // changes made from here on reach the index directly and win over the
+  // values read below
+  EntriesMapQuerySource source(*this, *m_entries, m_localIndexes);
+  for (const auto& entry : source.getEntries()) {
+    index->populate(entry.first, entry.second);
+  }
+  index->populated();
+}
+
+bool LocalRegion::removeIndex(const std::string& name) {
+  return m_localIndexes.remove(name);
+}
+
+LocalIndexes* LocalRegion::getLocalIndexes() { return &m_localIndexes; }
+
 int64_t LocalRegion::startStatOpTime() {
   return m_enableTimeStatistics ? Utils::startStatOpTime() : 0;
 }
@@ -45,6 +45,7 @@
 #include "EntriesMapFactory.hpp"
 #include "EventType.hpp"
 #include "ExpMapEntry.hpp"
+#include "LocalIndex.hpp"
 #include "RegionInternal.hpp"
 #include "RegionStats.hpp"
 #include "SerializationRegistry.hpp"
@@ -80,6 +81,7 @@ class CreateActions;
 class DestroyActions;
 class RemoveActions;
 class InvalidateActions;
+class LocalQuery;
 
 typedef std::unordered_map<std::shared_ptr<CacheableKey>,
                            std::pair<std::shared_ptr<Cacheable>, int>>
@@ -343,6 +345,14 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
                      std::shared_ptr<VersionTag> versionTag,
                      DataInput* delta = nullptr,
                      std::shared_ptr<EventId> eventId = nullptr);
+  /**
+   * put a batch of entries in the local cache of a caching region without
+   * invoking any callbacks, a segment lock at a time; batch.values are
+   * replaced by their stored form and batch.results hold the outcome of
+   * each put
+   */
+  void putLocalBatch(const std::string& name, MapPutBatch& batch,
+                     int destroyTracker);
   GfErrType invalidateLocal(const std::string& name,
                             const std::shared_ptr<CacheableKey>& keyPtr,
                             const std::shared_ptr<Cacheable>& value,
@@ -403,9 +413,40 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
 
   std::shared_ptr<TombstoneList> getTombstoneList() override;
 
+  /**
+   * Evaluates the query against the cached entries; only supported when
+   * caching is enabled.
+   */
+  std::shared_ptr<SelectResults> query(
+      const std::string& predicate,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  bool existsValue(const std::string& predicate,
+                   std::chrono::milliseconds timeout =
+                       DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<Serializable> selectValue(
+      const std::string& predicate,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void createIndex(const std::string& name, const std::string& expression,
+                   IndexType type = IndexType::HASH) override;
+
+  bool removeIndex(const std::string& name) override;
+
+  LocalIndexes* getLocalIndexes() override;
+
  protected:
   /* virtual protected methods */
   virtual void release(bool invokeCallbacks = true);
+  /**
+   * Runs query against the cached entries. Throws QueryException if it
+   * selects from another region or reads attributes that cannot be read
+   * locally.
+   */
+  std::shared_ptr<SelectResults> executeLocalQuery(const LocalQuery& query);
   virtual GfErrType getNoThrow_remote(
       const std::shared_ptr<CacheableKey>& keyPtr,
       std::shared_ptr<Cacheable>& valPtr,
@@ -518,6 +559,7 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
   std::shared_ptr<CacheStatistics> m_cacheStatistics;
   bool m_transactionEnabled;
   std::shared_ptr<TombstoneList> m_tombstoneList;
+  LocalIndexes m_localIndexes;
   bool m_isPRSingleHopEnabled;
   std::shared_ptr<Pool> m_attachedPool;
   bool m_enableTimeStatistics;
@@ -18,9 +18,11 @@
 #include "util/Log.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <cinttypes>
+#include <condition_variable>
 #include <ctime>
 #include <mutex>
 #include <string>
@@ -47,6 +49,7 @@
 #include "Assert.hpp"
 #include "geodeBanner.hpp"
 #include "util/chrono/time_point.hpp"
+#include "util/concurrent/mpsc_ring_buffer.hpp"
 
 #if defined(_WIN32)
 #include <io.h>
@@ -95,6 +98,8 @@ FILE* g_log = nullptr;
 ACE_utsname g_uname;
 pid_t g_pid = 0;
 
+std::atomic<bool> g_asyncLogging(false);
+
 }  // namespace globals
 }  // namespace log
 }  // namespace geode
@@ -161,6 +166,7 @@ namespace client {
 
 LogLevel Log::s_logLevel = LogLevel::Default;
 
+using apache::geode::log::globals::g_asyncLogging;
 using apache::geode::log::globals::g_bytesWritten;
 using apache::geode::log::globals::g_diskSpaceLimit;
 using apache::geode::log::globals::g_fileInfo;
@@ -178,6 +184,161 @@ using apache::geode::log::globals::g_uname;
 
 /*****************************************************************************/
 
+/**
+ * Background writer behind Log::startAsync. Callers queue formatted lines
+ * without taking the log mutex; a single thread drains the queue, writing
+ * each batch under the mutex with a single flush at the end.
+ */
+class AsyncLogWriter {
+ public:
+  explicit AsyncLogWriter(uint32_t queueSize)
+      : m_queue(queueSize),
+        m_blockWhenFull(false),
+        m_running(false),
+        m_sleeping(false),
+        m_producers(0),
+        m_dropped(0) {}
+
+  void start(bool blockWhenFull) {
+    m_blockWhenFull = blockWhenFull;
+    m_running = true;
+    m_thread = std::thread(&AsyncLogWriter::run, this);
+  }
+
+  /**
+   * Writes out everything queued so far and stops the writer thread. Puts
+   * that have not queued their line by then are refused.
+   */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> guard(m_wakeMutex);
+      m_running = false;
+      m_wake.notify_one();
+    }
+    // a put that saw the writer running finishes queuing before the writer
+    // drains the queue for the last time
+    while (m_producers.load() > 0) {
+      std::this_thread::yield();
+    }
+    wake();
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  /**
+   * Queues line for the writer thread. Returns false, leaving the line to
+   * the caller, if the writer has been stopped.
+   */
+  bool put(LogLevel level, std::string& line) {
+    ProducerGuard producer(m_producers);
+    if (!m_running.load()) {
+      return false;
+    }
+    Record record{level, std::move(line)};
+    while (!m_queue.try_push(record)) {
+      if (!m_running.load()) {
+        line = std::move(record.m_line);
+        return false;
+      }
+      if (!m_blockWhenFull) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+      wake();
+      std::this_thread::yield();
+    }
+    if (m_sleeping.load(std::memory_order_relaxed)) {
+      wake();
+    }
+    return true;
+  }
+
+ private:
+  struct Record {
+    LogLevel m_level;
+    std::string m_line;
+  };
+
+  static const size_t kMaxBatch = 256;
+
+  class ProducerGuard {
+   public:
+    explicit ProducerGuard(std::atomic<int32_t>& producers)
+        : m_producers(producers) {
+      ++m_producers;
+    }
+    ~ProducerGuard() { --m_producers; }
+
+   private:
+    std::atomic<int32_t>& m_producers;
+  };
+
+  void wake() {
+    std::lock_guard<std::mutex> guard(m_wakeMutex);
+    m_wake.notify_one();
+  }
+
+  void run() {
+    std::vector<Record> batch;
+    batch.reserve(kMaxBatch);
+    Record record;
+    for (;;) {
+      auto running = m_running.load();
+      while (batch.size() < kMaxBatch && m_queue.try_pop(record)) {
+        batch.push_back(std::move(record));
+      }
+      auto dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+
+      if (!batch.empty() || dropped > 0) {
+        std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
+        if (dropped > 0) {
+          char buf[256] = {0};
+          auto msg = "Log queue full, dropped " + std::to_string(dropped) +
+                     " log messages";
+          Log::writeLine(LogLevel::Warning,
+                         Log::formatLogLine(buf, LogLevel::Warning),
+                         msg.c_str(), false);
+        }
+        for (const auto& line : batch) {
+          Log::writeLine(line.m_level, "", line.m_line.c_str(), false);
+        }
+        if (!g_logFile) {
+          fflush(stdout);
+        } else if (g_log) {
+          fflush(g_log);
+        }
+        batch.clear();
+      } else if (!running) {
+        break;
+      } else {
+        // producers only wake us while we sleep, so a missed wakeup delays
+        // a line by at most this long
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_sleeping = true;
+        m_wake.wait_for(lock, std::chrono::milliseconds(10));
+        m_sleeping = false;
+      }
+    }
+  }
+
+  util::concurrent::mpsc_ring_buffer<Record> m_queue;
+  bool m_blockWhenFull;
+  std::atomic<bool> m_running;
+  std::atomic<bool> m_sleeping;
+  std::atomic<int32_t> m_producers;
+  std::atomic<size_t> m_dropped;
+  std::mutex m_wakeMutex;
+  std::condition_variable m_wake;
+  std::thread m_thread;
+};
+
+// created by the first Log::startAsync and never destroyed, so callers that
+// saw async logging enabled can always reach it
+std::atomic<AsyncLogWriter*> g_asyncLogWriter(nullptr);
+
+/*****************************************************************************/
+
 void Log::init(LogLevel level, const char* logFileName, int32_t logFileLimit,
                int64_t logDiskSpaceLimit) {
   if (g_log != nullptr) {
@@ -352,6 +513,11 @@ void Log::init(LogLevel level, const char* logFileName, int32_t logFileLimit,
 }
 
 void Log::close() {
+  // the writer thread needs the log mutex to drain the queue
+  if (g_asyncLogging.exchange(false)) {
+    g_asyncLogWriter.load()->stop();
+  }
+
   std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
 
   std::string oldfile;
@@ -372,6 +538,25 @@ void Log::close() {
   }
 }
 
+void Log::startAsync(uint32_t queueSize, bool blockWhenFull) {
+  std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
+  if (g_asyncLogging) {
+    return;
+  }
+  // callers format their lines without the mutex, so do the one-time
+  // initialization in formatLogLine here
+  char buf[256] = {0};
+  formatLogLine(buf, LogLevel::Config);
+
+  auto writer = g_asyncLogWriter.load();
+  if (writer == nullptr) {
+    writer = new AsyncLogWriter(queueSize);
+    g_asyncLogWriter = writer;
+  }
+  writer->start(blockWhenFull);
+  g_asyncLogging = true;
+}
+
 void Log::writeBanner() {
   if (g_logFileWithExt == nullptr) {
     return;
@@ -540,16 +725,36 @@ void Log::put(LogLevel level, const std::string& msg) {
 
 // int g_count = 0;
 void Log::put(LogLevel level, const char* msg) {
+  char buf[256] = {0};
+
+  if (g_asyncLogging.load(std::memory_order_acquire)) {
+    std::string line(formatLogLine(buf, level));
+    line += msg;
+    if (g_asyncLogWriter.load(std::memory_order_acquire)->put(level, line)) {
+      return;
+    }
+    // raced with close(), which stopped the writer; write the line here
+    std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
+    writeLine(level, "", line.c_str(), true);
+    return;
+  }
+
   std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
+  writeLine(level, formatLogLine(buf, level), msg, true);
+}
 
+void Log::writeLine(LogLevel level, const char* prefix, const char* msg,
+                    bool flush) {
   g_fileInfo fileInfo;
 
   char buf[256] = {0};
   char fullpath[512] = {0};
 
   if (!g_logFile) {
-    fprintf(stdout, "%s%s\n", formatLogLine(buf, level), msg);
-    fflush(stdout);
+    fprintf(stdout, "%s%s\n", prefix, msg);
+    if (flush) {
+      fflush(stdout);
+    }
     // TODO: ignoring for now; probably store the log-lines for possible
     // future logging if log-file gets initialized properly
 
@@ -568,8 +773,7 @@ void Log::put(LogLevel level, const char* msg) {
       }
     }
 
-    formatLogLine(buf, level);
-    size_t numChars = static_cast<int>(std::strlen(buf) + std::strlen(msg));
+    size_t numChars = static_cast<int>(std::strlen(prefix) + std::strlen(msg));
     g_bytesWritten +=
         numChars + 2;  // bcoz we have to count trailing new line (\n)
 
@@ -668,7 +872,8 @@ void Log::put(LogLevel level, const char* msg) {
       }
     }
 
-    if ((numChars = fprintf(g_log, "%s%s\n", buf, msg)) == 0 || ferror(g_log)) {
+    if ((numChars = fprintf(g_log, "%s%s\n", prefix, msg)) == 0 ||
+        ferror(g_log)) {
       if ((g_diskSpaceLimit > 0)) {
         g_spaceUsed = g_spaceUsed - (numChars + 2);
       }
@@ -680,7 +885,7 @@ void Log::put(LogLevel level, const char* msg) {
       // process to terminate
       fclose(g_log);
       g_log = nullptr;
-    } else {
+    } else if (flush) {
       fflush(g_log);
     }
   }
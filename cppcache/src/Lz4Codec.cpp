@@ -0,0 +1,211 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Lz4Codec.hpp"
+
+#include <cstring>
+#include <memory>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+constexpr size_t MIN_MATCH = 4;
+// the format requires the last 5 bytes to be literals and the last match to
+// start at least 12 bytes before the end of the block
+constexpr size_t LAST_LITERALS = 5;
+constexpr size_t MATCH_FIND_LIMIT = 12;
+constexpr size_t MAX_OFFSET = 65535;
+constexpr size_t RUN_MASK = 15;
+constexpr int HASH_BITS = 12;
+// skip faster through data that does not compress
+constexpr int SKIP_SHIFT = 6;
+
+inline uint32_t read32(const uint8_t* p) {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline uint32_t hash(uint32_t sequence) {
+  return (sequence * 2654435761U) >> (32 - HASH_BITS);
+}
+
+inline uint8_t* writeLength(uint8_t* out, size_t length) {
+  length -= RUN_MASK;
+  for (; length >= 255; length -= 255) {
+    *out++ = 255;
+  }
+  *out++ = static_cast<uint8_t>(length);
+  return out;
+}
+
+inline bool readLength(const uint8_t*& in, const uint8_t* end,
+                       size_t& length) {
+  uint8_t byte;
+  do {
+    if (in == end) {
+      return false;
+    }
+    byte = *in++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+inline uint8_t* writeLiterals(uint8_t* out, uint8_t* token,
+                              const uint8_t* literals, size_t length) {
+  if (length >= RUN_MASK) {
+    *token = static_cast<uint8_t>(RUN_MASK << 4);
+    out = writeLength(out, length);
+  } else {
+    *token = static_cast<uint8_t>(length << 4);
+  }
+  std::memcpy(out, literals, length);
+  return out + length;
+}
+
+}  // namespace
+
+size_t Lz4Codec::compressBound(size_t length) {
+  return length + length / 255 + 16;
+}
+
+size_t Lz4Codec::compress(const uint8_t* source, size_t length,
+                          uint8_t* destination) {
+  const auto end = source + length;
+  auto anchor = source;
+  auto out = destination;
+
+  if (length > MATCH_FIND_LIMIT) {
+    std::unique_ptr<uint32_t[]> table(new uint32_t[1 << HASH_BITS]());
+    const auto matchStartLimit = end - MATCH_FIND_LIMIT;
+    const auto matchEndLimit = end - LAST_LITERALS;
+
+    auto p = source + 1;
+    while (p < matchStartLimit) {
+      const auto sequence = read32(p);
+      auto& slot = table[hash(sequence)];
+      auto match = source + slot;
+      slot = static_cast<uint32_t>(p - source);
+
+      if (static_cast<size_t>(p - match) > MAX_OFFSET ||
+          read32(match) != sequence) {
+        p += 1 + ((p - anchor) >> SKIP_SHIFT);
+        continue;
+      }
+
+      while (p > anchor && match > source && p[-1] == match[-1]) {
+        --p;
+        --match;
+      }
+      auto matchEnd = p + MIN_MATCH;
+      auto matched = match + MIN_MATCH;
+      while (matchEnd < matchEndLimit && *matchEnd == *matched) {
+        ++matchEnd;
+        ++matched;
+      }
+
+      auto token = out++;
+      out = writeLiterals(out, token, anchor, static_cast<size_t>(p - anchor));
+      const auto offset = static_cast<size_t>(p - match);
+      *out++ = static_cast<uint8_t>(offset);
+      *out++ = static_cast<uint8_t>(offset >> 8);
+      const auto matchLength = static_cast<size_t>(matchEnd - p) - MIN_MATCH;
+      if (matchLength >= RUN_MASK) {
+        *token |= RUN_MASK;
+        out = writeLength(out, matchLength);
+      } else {
+        *token |= static_cast<uint8_t>(matchLength);
+      }
+
+      p = anchor = matchEnd;
+      if (p < matchStartLimit) {
+        table[hash(read32(p - 2))] = static_cast<uint32_t>(p - 2 - source);
+      }
+    }
+  }
+
+  auto token = out++;
+  out = writeLiterals(out, token, anchor, static_cast<size_t>(end - anchor));
+  return static_cast<size_t>(out - destination);
+}
+
+bool Lz4Codec::expand(const uint8_t* source, size_t length,
+                      uint8_t* destination, size_t expandedLength) {
+  auto in = source;
+  const auto inEnd = source + length;
+  auto out = destination;
+  const auto outEnd = destination + expandedLength;
+
+  while (in < inEnd) {
+    const auto token = *in++;
+
+    size_t literals = token >> 4;
+    if (literals == RUN_MASK && !readLength(in, inEnd, literals)) {
+      return false;
+    }
+    if (literals > static_cast<size_t>(inEnd - in) ||
+        literals > static_cast<size_t>(outEnd - out)) {
+      return false;
+    }
+    std::memcpy(out, in, literals);
+    in += literals;
+    out += literals;
+    if (in == inEnd) {
+      // the last sequence has no match
+      break;
+    }
+
+    if (inEnd - in < 2) {
+      return false;
+    }
+    const auto offset = static_cast<size_t>(in[0] | (in[1] << 8));
+    in += 2;
+    if (offset == 0 || offset > static_cast<size_t>(out - destination)) {
+      return false;
+    }
+
+    size_t matchLength = token & RUN_MASK;
+    if (matchLength == RUN_MASK && !readLength(in, inEnd, matchLength)) {
+      return false;
+    }
+    matchLength += MIN_MATCH;
+    if (matchLength > static_cast<size_t>(outEnd - out)) {
+      return false;
+    }
+
+    const auto match = out - offset;
+    if (offset >= matchLength) {
+      std::memcpy(out, match, matchLength);
+    } else {
+      // the match overlaps what it produces, repeating its last offset bytes
+      for (size_t i = 0; i < matchLength; ++i) {
+        out[i] = match[i];
+      }
+    }
+    out += matchLength;
+  }
+
+  return out == outEnd;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,66 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LZ4CODEC_H_
+#define GEODE_LZ4CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @brief Compresses and expands buffers in the LZ4 block format.
+ *
+ * The compressor is the single pass, hash table matcher of the reference
+ * implementation without its acceleration tricks; its output can be read
+ * by any LZ4 block decoder and it can read theirs. The block carries no
+ * lengths of its own, so callers frame it with the expanded length.
+ */
+class APACHE_GEODE_EXPORT Lz4Codec {
+ public:
+  /** Returns the largest block that compress() can make of length bytes. */
+  static size_t compressBound(size_t length);
+
+  /**
+   * Compresses length bytes of source into destination, which must have
+   * room for compressBound(length) bytes, and returns the size of the block.
+   */
+  static size_t compress(const uint8_t* source, size_t length,
+                         uint8_t* destination);
+
+  /**
+   * Expands the block of length bytes at source into exactly
+   * expandedLength bytes at destination. Returns false, leaving destination
+   * undefined, if the block is malformed or does not expand to that length;
+   * it never reads or writes outside either buffer.
+   */
+  static bool expand(const uint8_t* source, size_t length,
+                     uint8_t* destination, size_t expandedLength);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LZ4CODEC_H_
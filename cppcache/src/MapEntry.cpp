@@ -23,13 +23,13 @@ namespace apache {
 namespace geode {
 namespace client {
 
-void EntryFactory::newMapEntry(ExpiryTaskManager*,
+void EntryFactory::newMapEntry(MapEntryPool* pool, ExpiryTaskManager*,
                                const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedMapEntryImpl, 0, 0>::create(key);
+    result = MapEntryT<VersionedMapEntryImpl, 0, 0>::create(pool, key);
   } else {
-    result = MapEntryT<MapEntryImpl, 0, 0>::create(key);
+    result = MapEntryT<MapEntryImpl, 0, 0>::create(pool, key);
   }
 }
 
@@ -41,6 +41,7 @@ namespace client {
 
 class MapEntry;
 class MapEntryImpl;
+class MapEntryPool;
 class LRUEntryProperties;
 class CacheImpl;
 
@@ -296,7 +297,12 @@ class APACHE_GEODE_EXPORT EntryFactory {
 
   virtual ~EntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  /**
+   * Creates a new entry for the given key. The entry and its shared_ptr
+   * control block are allocated together from the given pool.
+   */
+  virtual void newMapEntry(MapEntryPool* pool,
+                           ExpiryTaskManager* expiryTaskManager,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 
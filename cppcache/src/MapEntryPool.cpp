@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MapEntryPool.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+inline std::size_t roundToAlignment(std::size_t size) {
+  const std::size_t alignment = alignof(std::max_align_t);
+  return (std::max(size, sizeof(void*)) + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+const std::size_t MapEntryPool::kFirstSlabBlocks;
+const std::size_t MapEntryPool::kMaxSlabBlocks;
+
+MapEntryPool::MapEntryPool()
+    : m_blockSize(0),
+      m_liveCount(0),
+      m_nextSlabBlocks(kFirstSlabBlocks),
+      m_freeList(nullptr),
+      m_bump(nullptr),
+      m_bumpEnd(nullptr),
+      m_closed(false) {}
+
+MapEntryPool::~MapEntryPool() {
+  for (auto slab : m_slabs) {
+    ::operator delete(slab);
+  }
+}
+
+void* MapEntryPool::allocate(std::size_t size) {
+  const auto blockSize = roundToAlignment(size);
+
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  if (m_blockSize == 0) {
+    m_blockSize = blockSize;
+  }
+
+  void* block;
+  if (blockSize != m_blockSize) {
+    // not an entry of the type this segment creates, so not worth pooling
+    block = ::operator new(size);
+  } else if (m_freeList != nullptr) {
+    block = m_freeList;
+    m_freeList = m_freeList->m_next;
+  } else {
+    block = allocateFromSlab();
+  }
+  ++m_liveCount;
+  return block;
+}
+
+void* MapEntryPool::allocateFromSlab() {
+  if (m_bump == m_bumpEnd) {
+    const auto slabSize = m_nextSlabBlocks * m_blockSize;
+    m_slabs.reserve(m_slabs.size() + 1);
+    auto slab = static_cast<char*>(::operator new(slabSize));
+    m_slabs.push_back(slab);
+    m_bump = slab;
+    m_bumpEnd = slab + slabSize;
+    m_nextSlabBlocks = std::min(m_nextSlabBlocks * 2, kMaxSlabBlocks);
+  }
+  auto block = m_bump;
+  m_bump += m_blockSize;
+  return block;
+}
+
+void MapEntryPool::deallocate(void* block, std::size_t size) {
+  bool destroy = false;
+  {
+    std::lock_guard<spinlock_mutex> guard(m_lock);
+    if (roundToAlignment(size) != m_blockSize) {
+      ::operator delete(block);
+    } else {
+      auto freeBlock = static_cast<FreeBlock*>(block);
+      freeBlock->m_next = m_freeList;
+      m_freeList = freeBlock;
+    }
+
+    destroy = --m_liveCount == 0 && m_closed;
+  }
+
+  if (destroy) {
+    delete this;
+  }
+}
+
+void MapEntryPool::trim() {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  if (m_liveCount != 0 || m_slabs.empty()) {
+    return;
+  }
+
+  // every block is free so the slabs can go wholesale without walking the
+  // free list; keep the newest (and largest) one to refill the segment
+  auto last = m_slabs.back();
+  auto lastSize = m_bumpEnd - last;
+  m_slabs.pop_back();
+  for (auto slab : m_slabs) {
+    ::operator delete(slab);
+  }
+  m_slabs.assign(1, last);
+  m_freeList = nullptr;
+  m_bump = last;
+  m_bumpEnd = last + lastSize;
+}
+
+void MapEntryPool::close() {
+  bool destroy;
+  {
+    std::lock_guard<spinlock_mutex> guard(m_lock);
+    m_closed = true;
+    destroy = m_liveCount == 0;
+  }
+
+  if (destroy) {
+    delete this;
+  }
+}
+
+std::size_t MapEntryPool::liveCount() const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  return m_liveCount;
+}
+
+std::size_t MapEntryPool::slabCount() const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  return m_slabs.size();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
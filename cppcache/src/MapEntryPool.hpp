@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_MAPENTRYPOOL_H_
+#define GEODE_MAPENTRYPOOL_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using util::concurrent::spinlock_mutex;
+
+/**
+ * @brief Slab allocator for the map entries of a single MapSegment.
+ *
+ * Entries are created with <code>std::allocate_shared</code> so the entry and
+ * its shared_ptr control block form one block. All blocks handed out by a
+ * pool have the same size, fixed by the first allocation, and are carved
+ * from slabs that double in size up to a limit. Freed blocks are kept on a
+ * free list for reuse; once every block has been returned, for example after
+ * the segment has been cleared, trim() releases all slabs but the last at
+ * once.
+ *
+ * Entries may outlive their segment (the LRU list and trackers hold
+ * references), so the owner does not delete the pool but calls close(). The
+ * pool then deletes itself when the last outstanding block is returned.
+ */
+class APACHE_GEODE_EXPORT MapEntryPool {
+ public:
+  /**
+   * Minimal allocator over a MapEntryPool for use with
+   * <code>std::allocate_shared</code>.
+   */
+  template <class T>
+  class Allocator {
+   public:
+    typedef T value_type;
+
+    inline explicit Allocator(MapEntryPool* pool) : m_pool(pool) {}
+
+    template <class U>
+    inline Allocator(const Allocator<U>& other) : m_pool(other.m_pool) {}
+
+    inline T* allocate(std::size_t n) {
+      return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+    }
+
+    inline void deallocate(T* p, std::size_t n) {
+      m_pool->deallocate(p, n * sizeof(T));
+    }
+
+    template <class U>
+    inline bool operator==(const Allocator<U>& other) const {
+      return m_pool == other.m_pool;
+    }
+
+    template <class U>
+    inline bool operator!=(const Allocator<U>& other) const {
+      return m_pool != other.m_pool;
+    }
+
+   private:
+    MapEntryPool* m_pool;
+
+    template <class U>
+    friend class Allocator;
+  };
+
+  MapEntryPool();
+
+  MapEntryPool(const MapEntryPool&) = delete;
+  MapEntryPool& operator=(const MapEntryPool&) = delete;
+
+  void* allocate(std::size_t size);
+
+  void deallocate(void* block, std::size_t size);
+
+  /**
+   * Releases all slabs but the last if no blocks are outstanding, as after
+   * the segment has been cleared. Does nothing otherwise.
+   */
+  void trim();
+
+  /**
+   * Releases the owner's hold on the pool. The pool is deleted immediately
+   * if no blocks are outstanding, otherwise when the last one is returned.
+   */
+  void close();
+
+  /** Number of blocks currently allocated from this pool. */
+  std::size_t liveCount() const;
+
+  /** Number of slabs currently held by this pool. */
+  std::size_t slabCount() const;
+
+  static const std::size_t kFirstSlabBlocks = 16;
+  static const std::size_t kMaxSlabBlocks = 1024;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* m_next;
+  };
+
+  ~MapEntryPool();
+
+  void* allocateFromSlab();
+
+  mutable spinlock_mutex m_lock;
+  std::size_t m_blockSize;
+  std::size_t m_liveCount;
+  std::size_t m_nextSlabBlocks;
+  std::vector<char*> m_slabs;
+  FreeBlock* m_freeList;
+  char* m_bump;
+  char* m_bumpEnd;
+  bool m_closed;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_MAPENTRYPOOL_H_
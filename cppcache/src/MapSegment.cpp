@@ -19,12 +19,13 @@
 
 #include <chrono>
 
+#include "CacheImpl.hpp"
+#include "LocalIndex.hpp"
 #include "MapEntry.hpp"
 #include "RegionInternal.hpp"
 #include "TableOfPrimes.hpp"
 #include "ThinClientPoolDM.hpp"
 #include "ThinClientRegion.hpp"
-#include "TombstoneExpiryHandler.hpp"
 #include "TrackedMapEntry.hpp"
 #include "Utils.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
@@ -36,6 +37,9 @@ namespace client {
 bool MapSegment::boolVal = false;
 MapSegment::~MapSegment() {
   delete m_map;
+  if (m_entryPool != nullptr) {
+    m_entryPool->close();
+  }
   // m_entryFactory will be disposed by the containing EntriesMap impl.
 }
 
@@ -49,7 +53,9 @@ void MapSegment::open(RegionInternal* region, const EntryFactory* entryFactory,
            size);
   m_map->reserve(mapSize);
   m_entryFactory = entryFactory;
+  m_entryPool = new MapEntryPool();
   m_region = region;
+  m_indexes = region->getLocalIndexes();
   m_tombstoneList =
       std::make_shared<TombstoneList>(this, m_region->getCacheImpl());
   m_expiryTaskManager = expiryTaskManager;
@@ -61,7 +67,14 @@ void MapSegment::close() {}
 
 void MapSegment::clear() {
   std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  if (m_indexes != nullptr && !m_indexes->empty()) {
+    for (const auto& entry : *m_map) {
+      m_indexes->remove(entry.first);
+    }
+  }
+  m_tombstoneList->clear();
   m_map->clear();
+  m_entryPool->trim();
 }
 
 void MapSegment::lock() { m_segmentMutex.lock(); }
@@ -74,9 +87,8 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
                              std::shared_ptr<Cacheable>& oldValue,
                              int updateCount, int destroyTracker,
                              std::shared_ptr<VersionTag> versionTag) {
-  ExpiryTaskManager::id_type taskid = -1;
-  TombstoneExpiryHandler* handler = nullptr;
   GfErrType err = GF_NOERR;
+  const auto indexEvaluation = evaluateForIndexes(newValue);
   {
     std::lock_guard<spinlock_mutex> lk(m_spinlock);
     // if size is greater than 75 percent of prime, rehash
@@ -112,7 +124,7 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
           err = putForTrackedEntry(key, newValue, entry, entryImpl, updateCount,
                                    versionStamp);
         } else {
-          unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
+          unguardedRemoveActualEntry(key);
           err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
                            versionTag, &versionStamp);
         }
@@ -126,10 +138,9 @@ GfErrType MapSegment::create(const std::shared_ptr<CacheableKey>& key,
         me = entryImpl;
       }
     }
-  }
-  if (taskid != -1) {
-    m_expiryTaskManager->cancelTask(taskid);
-    if (handler != nullptr) delete handler;
+    if (err == GF_NOERR && m_indexes != nullptr && !m_indexes->empty()) {
+      updateIndexes(key, newValue, indexEvaluation);
+    }
   }
   return err;
 }
@@ -144,66 +155,252 @@ GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
                           int destroyTracker, bool& isUpdate,
                           std::shared_ptr<VersionTag> versionTag,
                           DataInput* delta) {
-  ExpiryTaskManager::id_type taskid = -1;
-  TombstoneExpiryHandler* handler = nullptr;
-  GfErrType err = GF_NOERR;
-  {
-    std::lock_guard<spinlock_mutex> lk(m_spinlock);
-    // if size is greater than 75 percent of prime, rehash
-    uint32_t mapSize = TableOfPrimes::getPrime(m_primeIndex);
-    if (((m_map->size() * 75) / 100) > mapSize) {
-      rehash();
-    }
+  if (delta != nullptr && (updateCount < 0 || m_concurrencyChecksEnabled)) {
+    return putDelta(key, newValue, me, oldValue, updateCount, destroyTracker,
+                    isUpdate, versionTag, *delta);
+  }
+  const auto indexEvaluation = evaluateForIndexes(newValue);
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  return unguardedPut(key, newValue, me, oldValue, updateCount, destroyTracker,
+                      isUpdate, versionTag, delta, indexEvaluation);
+}
 
-    const auto& find = m_map->find(key);
-    if (find == m_map->end()) {
-      if (delta != nullptr) {
-        return GF_INVALID_DELTA;  // You can not apply delta when there is no
+GfErrType MapSegment::putDelta(const std::shared_ptr<CacheableKey>& key,
+                               const std::shared_ptr<Cacheable>& newValue,
+                               std::shared_ptr<MapEntryImpl>& me,
+                               std::shared_ptr<Cacheable>& oldValue,
+                               int updateCount, int destroyTracker,
+                               bool& isUpdate,
+                               std::shared_ptr<VersionTag> versionTag,
+                               DataInput& delta) {
+  using clock = std::chrono::steady_clock;
+
+  auto* thinClientRegion = dynamic_cast<ThinClientRegion*>(m_region);
+  ThinClientPoolDM* poolDM = nullptr;
+  if (thinClientRegion) {
+    poolDM = dynamic_cast<ThinClientPoolDM*>(thinClientRegion->getDistMgr());
+  }
+  auto& cachePerfStats = m_region->getCacheImpl()->getCachePerfStats();
+
+  // Without cloning the delta changes the cached value itself, so appliers
+  // of in-place deltas to this segment take turns.
+  const bool cloningEnabled = m_region->getAttributes().getCloningEnabled();
+  std::unique_lock<std::recursive_mutex> inPlaceGuard(m_segmentMutex,
+                                                      std::defer_lock);
+  if (!cloningEnabled) {
+    inPlaceGuard.lock();
+  }
+
+  const auto deltaStart = delta.getBytesRead();
+  while (true) {
+    std::shared_ptr<MapEntryImpl> entryImpl;
+    std::shared_ptr<Cacheable> meOldValue;
+    VersionStamp versionStamp;
+    int32_t entryVersion = 0;
+    {
+      std::lock_guard<spinlock_mutex> lk(m_spinlock);
+      const auto& find = m_map->find(key);
+      if (find == m_map->end()) {
+        // You can not apply delta when there is no entry hence ask for full
+        // object
+        return GF_INVALID_DELTA;
       }
-      // entry hence ask for full object
-      isUpdate = false;
-      err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
-                       versionTag);
-    } else {
-      auto& entry = find->second;
-      auto entryImpl = entry->getImplPtr();
-      std::shared_ptr<Cacheable> meOldValue;
+      entryImpl = find->second->getImplPtr();
       entryImpl->getValueI(meOldValue);
-      // pass the version stamp
-      VersionStamp versionStamp;
+      if (CacheableToken::isTombstone(meOldValue)) {
+        // rare enough for the indexes to evaluate newValue under the lock
+        return unguardedPut(key, newValue, me, oldValue, updateCount,
+                            destroyTracker, isUpdate, versionTag, &delta,
+                            LocalIndexes::Evaluation());
+      }
       if (m_concurrencyChecksEnabled) {
-        versionStamp = entry->getVersionStamp();
+        versionStamp = find->second->getVersionStamp();
+        entryVersion = versionStamp.getEntryVersion();
         if (versionTag) {
-          if (delta == nullptr) {
-            err = versionStamp.processVersionTag(m_region, key, versionTag,
-                                                 false);
-          } else {
-            err =
-                versionStamp.processVersionTag(m_region, key, versionTag, true);
-          }
-
+          auto err =
+              versionStamp.processVersionTag(m_region, key, versionTag, true);
           if (err != GF_NOERR) return err;
           versionStamp.setVersions(versionTag);
         }
       }
-      if (CacheableToken::isTombstone(meOldValue)) {
-        unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
-        err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
-                         versionTag, &versionStamp);
-        meOldValue = nullptr;
-        isUpdate = false;
-      } else if ((err = putForTrackedEntry(key, newValue, entry, entryImpl,
-                                           updateCount, versionStamp, delta)) ==
-                 GF_NOERR) {
-        me = entryImpl;
-        oldValue = meOldValue;
-        isUpdate = (meOldValue != nullptr);
+    }
+
+    // Read, clone and apply outside the spinlock so readers and puts of
+    // other keys in the segment are not held up by the delta.
+    auto value = meOldValue;
+    if (CacheableToken::isOverflowed(value)) {  // get Value from disc.
+      value = getFromDisc(key, entryImpl);
+    }
+    if (value == nullptr || CacheableToken::isDestroyed(value) ||
+        CacheableToken::isInvalid(value)) {
+      if (poolDM) {
+        poolDM->updateNotificationStats(false, std::chrono::nanoseconds(0));
+      }
+      return GF_INVALID_DELTA;
+    }
+    value = m_region->fromStoredValue(value);
+
+    auto valueWithDelta = std::dynamic_pointer_cast<Delta>(value);
+    std::shared_ptr<Cacheable> deltaValue;
+    clock::duration applyTime;
+    try {
+      if (cloningEnabled) {
+        auto tempVal = valueWithDelta->clone();
+        auto currTimeBefore = clock::now();
+        tempVal->fromDelta(delta);
+        applyTime = clock::now() - currTimeBefore;
+        deltaValue = std::dynamic_pointer_cast<Serializable>(tempVal);
+      } else {
+        auto currTimeBefore = clock::now();
+        valueWithDelta->fromDelta(delta);
+        applyTime = clock::now() - currTimeBefore;
+        deltaValue = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
       }
+    } catch (InvalidDeltaException&) {
+      return GF_INVALID_DELTA;
     }
+    auto storedValue = m_region->toStoredValue(deltaValue);
+    const auto indexEvaluation = evaluateForIndexes(deltaValue);
+
+    // Publish only if the entry still holds the value the delta was applied
+    // to, otherwise apply the delta again to whatever replaced it.
+    bool published = false;
+    {
+      std::lock_guard<spinlock_mutex> lk(m_spinlock);
+      const auto& find = m_map->find(key);
+      if (find != m_map->end() && find->second->getImplPtr() == entryImpl) {
+        std::shared_ptr<Cacheable> currentValue;
+        entryImpl->getValueI(currentValue);
+        if (currentValue == meOldValue &&
+            (!m_concurrencyChecksEnabled ||
+             find->second->getVersionStamp().getEntryVersion() ==
+                 entryVersion)) {
+          entryImpl->setValueI(storedValue);
+          if (m_concurrencyChecksEnabled) {
+            // erase if the entry is in tombstone
+            m_tombstoneList->eraseEntryFromTombstoneList(key);
+            entryImpl->getVersionStamp().setVersions(versionStamp);
+          }
+          (void)incrementUpdateCount(key, find->second);
+          if (m_indexes != nullptr && !m_indexes->empty()) {
+            updateIndexes(key, deltaValue, indexEvaluation);
+          }
+          published = true;
+        }
+      }
+    }
+
+    if (published) {
+      if (poolDM) {
+        poolDM->updateNotificationStats(true, applyTime);
+      }
+      cachePerfStats.incTimeSpentOnDeltaApplication(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(applyTime)
+              .count());
+      const_cast<std::shared_ptr<Cacheable>&>(newValue) = deltaValue;
+      me = entryImpl;
+      oldValue = meOldValue;
+      isUpdate = true;
+      return GF_NOERR;
+    }
+    if (!cloningEnabled) {
+      // the value the delta was applied to is no longer cached
+      return GF_INVALID_DELTA;
+    }
+    cachePerfStats.incDeltaApplyRetries();
+    delta.reset(deltaStart);
   }
-  if (taskid != -1) {
-    m_expiryTaskManager->cancelTask(taskid);
-    if (handler != nullptr) delete handler;
+}
+
+uint32_t MapSegment::putBatch(MapPutBatch& batch,
+                              const std::vector<size_t>& indexes,
+                              int destroyTracker) {
+  std::vector<LocalIndexes::Evaluation> indexEvaluations;
+  if (m_indexes != nullptr && !m_indexes->empty()) {
+    indexEvaluations.reserve(indexes.size());
+    for (auto index : indexes) {
+      indexEvaluations.push_back(evaluateForIndexes(batch.values[index]));
+    }
+  }
+  const LocalIndexes::Evaluation noIndexEvaluation;
+
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  uint32_t created = 0;
+  for (size_t i = 0; i < indexes.size(); ++i) {
+    const auto index = indexes[i];
+    auto& result = batch.results[index];
+    result.err = unguardedPut(
+        batch.keys[index], batch.values[index], result.entry, result.oldValue,
+        batch.updateCount(index), destroyTracker, result.isUpdate,
+        batch.versionTag(index), nullptr,
+        indexEvaluations.empty() ? noIndexEvaluation : indexEvaluations[i]);
+    if (result.err == GF_NOERR && !result.isUpdate) {
+      ++created;
+    }
+  }
+  return created;
+}
+
+GfErrType MapSegment::unguardedPut(
+    const std::shared_ptr<CacheableKey>& key,
+    const std::shared_ptr<Cacheable>& newValue,
+    std::shared_ptr<MapEntryImpl>& me, std::shared_ptr<Cacheable>& oldValue,
+    int updateCount, int destroyTracker, bool& isUpdate,
+    std::shared_ptr<VersionTag> versionTag, DataInput* delta,
+    const LocalIndexes::Evaluation& indexEvaluation) {
+  GfErrType err = GF_NOERR;
+  // if size is greater than 75 percent of prime, rehash
+  uint32_t mapSize = TableOfPrimes::getPrime(m_primeIndex);
+  if (((m_map->size() * 75) / 100) > mapSize) {
+    rehash();
+  }
+
+  const auto& find = m_map->find(key);
+  if (find == m_map->end()) {
+    if (delta != nullptr) {
+      return GF_INVALID_DELTA;  // You can not apply delta when there is no
+    }
+    // entry hence ask for full object
+    isUpdate = false;
+    err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+                     versionTag);
+  } else {
+    auto& entry = find->second;
+    auto entryImpl = entry->getImplPtr();
+    std::shared_ptr<Cacheable> meOldValue;
+    entryImpl->getValueI(meOldValue);
+    // pass the version stamp
+    VersionStamp versionStamp;
+    if (m_concurrencyChecksEnabled) {
+      versionStamp = entry->getVersionStamp();
+      if (versionTag) {
+        if (delta == nullptr) {
+          err = versionStamp.processVersionTag(m_region, key, versionTag,
+                                               false);
+        } else {
+          err = versionStamp.processVersionTag(m_region, key, versionTag, true);
+        }
+
+        if (err != GF_NOERR) return err;
+        versionStamp.setVersions(versionTag);
+      }
+    }
+    if (CacheableToken::isTombstone(meOldValue)) {
+      unguardedRemoveActualEntry(key);
+      err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+                       versionTag, &versionStamp);
+      meOldValue = nullptr;
+      isUpdate = false;
+    } else if ((err = putForTrackedEntry(key, newValue, entry, entryImpl,
+                                         updateCount, versionStamp)) ==
+               GF_NOERR) {
+      me = entryImpl;
+      oldValue = meOldValue;
+      isUpdate = (meOldValue != nullptr);
+    }
+  }
+  if (err == GF_NOERR && m_indexes != nullptr && !m_indexes->empty()) {
+    updateIndexes(key, newValue, indexEvaluation);
   }
   return err;
 }
@@ -243,6 +440,9 @@ GfErrType MapSegment::invalidate(const std::shared_ptr<CacheableKey>& key,
     if (oldValue != nullptr) {
       me = entryImpl;
     }
+    if (m_indexes != nullptr && !m_indexes->empty()) {
+      m_indexes->remove(key);
+    }
   } else {
     // create new entry for the key if concurrencychecksEnabled is true
     if (m_concurrencyChecksEnabled) {
@@ -257,12 +457,60 @@ GfErrType MapSegment::invalidate(const std::shared_ptr<CacheableKey>& key,
   return err;
 }
 
+void MapSegment::invalidateAll(
+    std::vector<std::shared_ptr<MapEntryImpl>>& invalidated) {
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  const bool updateIndexes = m_indexes != nullptr && !m_indexes->empty();
+  for (const auto& kv : *m_map) {
+    if (auto entryImpl = unguardedInvalidate(kv.first, kv.second,
+                                             updateIndexes)) {
+      invalidated.push_back(std::move(entryImpl));
+    }
+  }
+}
+
+uint32_t MapSegment::invalidateKeys(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys) {
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  const bool updateIndexes = m_indexes != nullptr && !m_indexes->empty();
+  uint32_t added = 0;
+  for (const auto& key : keys) {
+    const auto& find = m_map->find(key);
+    if (find != m_map->end()) {
+      unguardedInvalidate(key, find->second, updateIndexes);
+    } else if (m_concurrencyChecksEnabled) {
+      std::shared_ptr<MapEntryImpl> me;
+      if (putNoEntry(key, CacheableToken::invalid(), me, -1, -1, nullptr) ==
+          GF_NOERR) {
+        ++added;
+      }
+    }
+  }
+  return added;
+}
+
+std::shared_ptr<MapEntryImpl> MapSegment::unguardedInvalidate(
+    const std::shared_ptr<CacheableKey>& key, std::shared_ptr<MapEntry> entry,
+    bool updateIndexes) {
+  auto entryImpl = entry->getImplPtr();
+  std::shared_ptr<Cacheable> oldValue;
+  entryImpl->getValueI(oldValue);
+  if (CacheableToken::isTombstone(oldValue)) {
+    return nullptr;
+  }
+  entryImpl->setValueI(CacheableToken::invalid());
+  (void)incrementUpdateCount(key, entry);
+  if (updateIndexes) {
+    m_indexes->remove(key);
+  }
+  return oldValue == nullptr ? nullptr : entryImpl;
+}
+
 GfErrType MapSegment::removeWhenConcurrencyEnabled(
     const std::shared_ptr<CacheableKey>& key,
     std::shared_ptr<Cacheable>& oldValue, std::shared_ptr<MapEntryImpl>& me,
     int updateCount, std::shared_ptr<VersionTag> versionTag, bool afterRemote,
-    bool& isEntryFound, ExpiryTaskManager::id_type expiryTaskID,
-    TombstoneExpiryHandler* handler, bool& expTaskSet) {
+    bool& isEntryFound) {
   GfErrType err = GF_NOERR;
   VersionStamp versionStamp;
   // If entry found, else return no entry
@@ -291,8 +539,7 @@ GfErrType MapSegment::removeWhenConcurrencyEnabled(
     if ((err = putForTrackedEntry(key, CacheableToken::tombstone(), entry,
                                   entryImpl, updateCount, versionStamp)) ==
         GF_NOERR) {
-      m_tombstoneList->add(entryImpl, handler, expiryTaskID);
-      expTaskSet = true;
+      m_tombstoneList->add(entryImpl);
     }
     if (CacheableToken::isTombstone(oldValue)) {
       oldValue = nullptr;
@@ -310,8 +557,7 @@ GfErrType MapSegment::removeWhenConcurrencyEnabled(
     if (versionTag) {
       std::shared_ptr<MapEntryImpl> mapEntry;
       putNoEntry(key, CacheableToken::tombstone(), mapEntry, -1, 0, versionTag);
-      m_tombstoneList->add(mapEntry->getImplPtr(), handler, expiryTaskID);
-      expTaskSet = true;
+      m_tombstoneList->add(mapEntry->getImplPtr());
     }
     oldValue = nullptr;
     isEntryFound = false;
@@ -334,26 +580,18 @@ GfErrType MapSegment::remove(const std::shared_ptr<CacheableKey>& key,
                              bool afterRemote, bool& isEntryFound) {
   std::shared_ptr<MapEntry> entry;
   if (m_concurrencyChecksEnabled) {
-    TombstoneExpiryHandler* handler;
-    auto id = m_tombstoneList->getExpiryTask(&handler);
-    bool expTaskSet = false;
-    GfErrType err;
-    {
-      std::lock_guard<spinlock_mutex> lk(m_spinlock);
-      err = removeWhenConcurrencyEnabled(key, oldValue, me, updateCount,
-                                         versionTag, afterRemote, isEntryFound,
-                                         id, handler, expTaskSet);
-    }
-
-    if (!expTaskSet) {
-      m_expiryTaskManager->cancelTask(id);
-      delete handler;
+    std::lock_guard<spinlock_mutex> lk(m_spinlock);
+    auto err = removeWhenConcurrencyEnabled(
+        key, oldValue, me, updateCount, versionTag, afterRemote, isEntryFound);
+    if (err == GF_NOERR && m_indexes != nullptr && !m_indexes->empty()) {
+      m_indexes->remove(key);
     }
     return err;
   }
 
   std::lock_guard<spinlock_mutex> lk(m_spinlock);
-  if (m_map->erase(key) == 0) {
+  const auto& find = m_map->find(key);
+  if (find == m_map->end()) {
     // didn't unbind, probably no entry...
     oldValue = nullptr;
     volatile int destroyTrackers = *m_numDestroyTrackers;
@@ -362,6 +600,11 @@ GfErrType MapSegment::remove(const std::shared_ptr<CacheableKey>& key,
     }
     return GF_CACHE_ENTRY_NOT_FOUND;
   }
+  entry = find->second;
+  m_map->erase(find);
+  if (m_indexes != nullptr && !m_indexes->empty()) {
+    m_indexes->remove(key);
+  }
 
   if (updateCount >= 0 && updateCount != entry->getUpdateCount()) {
     // this is the case when entry has been updated while being tracked
@@ -376,31 +619,42 @@ GfErrType MapSegment::remove(const std::shared_ptr<CacheableKey>& key,
   return GF_NOERR;
 }
 
-bool MapSegment::unguardedRemoveActualEntry(
-    const std::shared_ptr<CacheableKey>& key, bool cancelTask) {
-  m_tombstoneList->eraseEntryFromTombstoneList(key, cancelTask);
-  if (m_map->erase(key) == 0) {
-    return false;
+LocalIndexes::Evaluation MapSegment::evaluateForIndexes(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (m_indexes == nullptr || m_indexes->empty()) {
+    return LocalIndexes::Evaluation();
   }
-  return true;
+  if (value == nullptr || CacheableToken::isToken(value)) {
+    return m_indexes->evaluate(nullptr);
+  }
+  return m_indexes->evaluate(m_region->fromStoredValue(value));
 }
 
-bool MapSegment::unguardedRemoveActualEntryWithoutCancelTask(
-    const std::shared_ptr<CacheableKey>& key, TombstoneExpiryHandler*& handler,
-    ExpiryTaskManager::id_type& taskid) {
-  std::shared_ptr<MapEntry> entry;
-  taskid = m_tombstoneList->eraseEntryFromTombstoneListWithoutCancelTask(
-      key, handler);
+void MapSegment::updateIndexes(const std::shared_ptr<CacheableKey>& key,
+                               const std::shared_ptr<Cacheable>& value,
+                               const LocalIndexes::Evaluation& evaluation) {
+  if (m_indexes->put(key, evaluation)) {
+    return;
+  }
+  // an index was created or removed since the evaluation
+  if (value == nullptr || CacheableToken::isToken(value)) {
+    m_indexes->remove(key);
+  } else {
+    m_indexes->put(key, m_region->fromStoredValue(value));
+  }
+}
+
+bool MapSegment::unguardedRemoveActualEntry(
+    const std::shared_ptr<CacheableKey>& key) {
+  m_tombstoneList->eraseEntryFromTombstoneList(key);
   if (m_map->erase(key) == 0) {
     return false;
   }
   return true;
 }
 
-bool MapSegment::removeActualEntry(const std::shared_ptr<CacheableKey>& key,
-                                   bool cancelTask) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
-  return unguardedRemoveActualEntry(key, cancelTask);
+void MapSegment::unguardedEraseEntry(const std::shared_ptr<CacheableKey>& key) {
+  m_map->erase(key);
 }
 /**
  * @brief get MapEntry for key. throws NoEntryException if absent.
@@ -529,7 +783,8 @@ int MapSegment::addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
     if (addIfAbsent) {
       std::shared_ptr<MapEntryImpl> entryImpl;
       // add a new entry with value as destroyed
-      m_entryFactory->newMapEntry(m_expiryTaskManager, key, entryImpl);
+      m_entryFactory->newMapEntry(m_entryPool, m_expiryTaskManager, key,
+                                  entryImpl);
       entryImpl->setValueI(CacheableToken::destroyed());
       entry = entryImpl;
       newEntry = entryImpl;
@@ -631,76 +886,14 @@ GfErrType MapSegment::putForTrackedEntry(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Cacheable>& newValue,
     std::shared_ptr<MapEntry>& entry, std::shared_ptr<MapEntryImpl>& entryImpl,
-    int updateCount, VersionStamp& versionStamp, DataInput* delta) {
+    int updateCount, VersionStamp& versionStamp) {
   if (updateCount < 0 || m_concurrencyChecksEnabled) {
     // for a non-tracked put (e.g. from notification) go ahead with the
     // create/update and increment the update counter
-    auto* thinClientRegion = dynamic_cast<ThinClientRegion*>(m_region);
-    ThinClientPoolDM* m_poolDM = nullptr;
-    if (thinClientRegion) {
-      m_poolDM =
-          dynamic_cast<ThinClientPoolDM*>(thinClientRegion->getDistMgr());
-    }
-
-    if (delta != nullptr) {
-      std::shared_ptr<Cacheable> oldValue;
-      entryImpl->getValueI(oldValue);
-      if (oldValue == nullptr || CacheableToken::isDestroyed(oldValue) ||
-          CacheableToken::isInvalid(oldValue) ||
-          CacheableToken::isTombstone(oldValue)) {
-        if (m_poolDM) {
-          m_poolDM->updateNotificationStats(false, std::chrono::nanoseconds(0));
-        }
-        return GF_INVALID_DELTA;
-      } else if (CacheableToken::isOverflowed(
-                     oldValue)) {  // get Value from disc.
-        oldValue = getFromDisc(key, entryImpl);
-        if (oldValue == nullptr) {
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(false,
-                                              std::chrono::nanoseconds(0));
-          }
-          return GF_INVALID_DELTA;
-        }
-      }
-
-      using clock = std::chrono::steady_clock;
-
-      auto valueWithDelta = std::dynamic_pointer_cast<Delta>(oldValue);
-      auto& newValue1 = const_cast<std::shared_ptr<Cacheable>&>(newValue);
-      try {
-        if (m_region->getAttributes().getCloningEnabled()) {
-          auto tempVal = valueWithDelta->clone();
-          auto currTimeBefore = clock::now();
-          tempVal->fromDelta(*delta);
-
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(true,
-                                              clock::now() - currTimeBefore);
-          }
-          newValue1 = std::dynamic_pointer_cast<Serializable>(tempVal);
-          entryImpl->setValueI(newValue1);
-        } else {
-          auto currTimeBefore = clock::now();
-          valueWithDelta->fromDelta(*delta);
-          newValue1 = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
-
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(true,
-                                              clock::now() - currTimeBefore);
-          }
-          entryImpl->setValueI(
-              std::dynamic_pointer_cast<Serializable>(valueWithDelta));
-        }
-      } catch (InvalidDeltaException&) {
-        return GF_INVALID_DELTA;
-      }
-    } else {
-      entryImpl->setValueI(newValue);
-    }
+    entryImpl->setValueI(newValue);
     if (m_concurrencyChecksEnabled) {
       // erase if the entry is in tombstone
-      m_tombstoneList->eraseEntryFromTombstoneList(key, true);
+      m_tombstoneList->eraseEntryFromTombstoneList(key);
       entryImpl->getVersionStamp().setVersions(versionStamp);
     }
     (void)incrementUpdateCount(key, entry);
@@ -725,6 +918,10 @@ void MapSegment::reapTombstones(std::shared_ptr<CacheableHashSet> removedKeys) {
   std::lock_guard<spinlock_mutex> lk(m_spinlock);
   m_tombstoneList->reapTombstones(removedKeys);
 }
+void MapSegment::reapExpiredTombstones() {
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  m_tombstoneList->sweepExpiredTombstones(TombstoneList::clock::now());
+}
 
 GfErrType MapSegment::isTombstone(std::shared_ptr<CacheableKey> key,
                                   std::shared_ptr<MapEntryImpl>& me,
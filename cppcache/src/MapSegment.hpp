@@ -31,7 +31,9 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "CacheableToken.hpp"
+#include "LocalIndex.hpp"
 #include "MapEntry.hpp"
+#include "MapEntryPool.hpp"
 #include "MapWithLock.hpp"
 #include "TombstoneList.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
@@ -47,6 +49,36 @@ typedef std::unordered_map<std::shared_ptr<CacheableKey>,
                            dereference_equal_to<std::shared_ptr<CacheableKey>>>
     CacheableKeyHashMap;
 
+/**
+ * @brief a batch of puts applied together, a segment lock at a time, by
+ * EntriesMap::putBatch. keys and values are parallel; versionTags and
+ * updateCounts are too when not empty. putBatch sets one result per key;
+ * as with put(), an oldValue already in results is kept when the put does
+ * not replace it.
+ */
+struct MapPutBatch {
+  struct Result {
+    GfErrType err = GF_NOERR;
+    std::shared_ptr<MapEntryImpl> entry;
+    std::shared_ptr<Cacheable> oldValue;
+    bool isUpdate = false;
+  };
+
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  std::vector<std::shared_ptr<Cacheable>> values;
+  std::vector<std::shared_ptr<VersionTag>> versionTags;
+  std::vector<int> updateCounts;
+  std::vector<Result> results;
+
+  inline std::shared_ptr<VersionTag> versionTag(size_t index) const {
+    return versionTags.empty() ? nullptr : versionTags[index];
+  }
+
+  inline int updateCount(size_t index) const {
+    return updateCounts.empty() ? -1 : updateCounts[index];
+  }
+};
+
 /** @brief type wrapper around the std::unordered_map implementation. */
 class APACHE_GEODE_EXPORT MapSegment {
  private:
@@ -55,7 +87,14 @@ class APACHE_GEODE_EXPORT MapSegment {
   // refers to object managed by the entries map...
   // does not need deletion here.
   const EntryFactory* m_entryFactory;
+  // slabs for the entries of this segment; closed, not deleted, on
+  // destruction since entries may still be referenced elsewhere
+  MapEntryPool* m_entryPool;
   RegionInternal* m_region;
+  // owned by the region; told about every change to a value, under the
+  // spinlock so that it sees changes to a key in order, with the value
+  // evaluated for it before the spinlock was taken
+  LocalIndexes* m_indexes;
   ExpiryTaskManager* m_expiryTaskManager;
 
   // index of the current prime in the primes table
@@ -139,7 +178,8 @@ class APACHE_GEODE_EXPORT MapSegment {
         }
       }
     }
-    m_entryFactory->newMapEntry(m_expiryTaskManager, key, newEntry);
+    m_entryFactory->newMapEntry(m_entryPool, m_expiryTaskManager, key,
+                                newEntry);
     newEntry->setValueI(newValue);
     if (m_concurrencyChecksEnabled) {
       if (versionTag) {
@@ -152,29 +192,69 @@ class APACHE_GEODE_EXPORT MapSegment {
     return GF_NOERR;
   }
 
+  // put for a caller already holding the spinlock, and having evaluated
+  // newValue for the indexes
+  GfErrType unguardedPut(const std::shared_ptr<CacheableKey>& key,
+                         const std::shared_ptr<Cacheable>& newValue,
+                         std::shared_ptr<MapEntryImpl>& me,
+                         std::shared_ptr<Cacheable>& oldValue, int updateCount,
+                         int destroyTracker, bool& isUpdate,
+                         std::shared_ptr<VersionTag> versionTag,
+                         DataInput* delta,
+                         const LocalIndexes::Evaluation& indexEvaluation);
+
+  // applies delta to a copy of the entry's value taken under the spinlock,
+  // then sets the result only if the entry's value and version have not
+  // changed since, applying it again otherwise. With cloning disabled the
+  // delta changes the value itself and cannot be applied again, so a
+  // change in between fails with GF_INVALID_DELTA to fetch the full value.
+  GfErrType putDelta(const std::shared_ptr<CacheableKey>& key,
+                     const std::shared_ptr<Cacheable>& newValue,
+                     std::shared_ptr<MapEntryImpl>& me,
+                     std::shared_ptr<Cacheable>& oldValue, int updateCount,
+                     int destroyTracker, bool& isUpdate,
+                     std::shared_ptr<VersionTag> versionTag, DataInput& delta);
+
   GfErrType putForTrackedEntry(const std::shared_ptr<CacheableKey>& key,
                                const std::shared_ptr<Cacheable>& newValue,
                                std::shared_ptr<MapEntry>& entry,
                                std::shared_ptr<MapEntryImpl>& entryImpl,
-                               int updateCount, VersionStamp& versionStamp,
-                               DataInput* delta = nullptr);
+                               int updateCount, VersionStamp& versionStamp);
 
   std::shared_ptr<Cacheable> getFromDisc(
       std::shared_ptr<CacheableKey> key,
       std::shared_ptr<MapEntryImpl>& entryImpl);
 
+  // evaluates a value about to be stored for the region's indexes, which
+  // may deserialize it, so it is done before taking the spinlock
+  LocalIndexes::Evaluation evaluateForIndexes(
+      const std::shared_ptr<Cacheable>& value) const;
+
+  // updates the region's indexes with the value just stored for key,
+  // evaluating it again only if the indexes changed since evaluation
+  void updateIndexes(const std::shared_ptr<CacheableKey>& key,
+                     const std::shared_ptr<Cacheable>& value,
+                     const LocalIndexes::Evaluation& evaluation);
+
+  // invalidates the entry for key unless it is a tombstone, returning it
+  // if it had a value; the spinlock must be held
+  std::shared_ptr<MapEntryImpl> unguardedInvalidate(
+      const std::shared_ptr<CacheableKey>& key,
+      std::shared_ptr<MapEntry> entry, bool updateIndexes);
+
   GfErrType removeWhenConcurrencyEnabled(
       const std::shared_ptr<CacheableKey>& key,
       std::shared_ptr<Cacheable>& oldValue, std::shared_ptr<MapEntryImpl>& me,
       int updateCount, std::shared_ptr<VersionTag> versionTag, bool afterRemote,
-      bool& isEntryFound, ExpiryTaskManager::id_type expiryTaskID,
-      TombstoneExpiryHandler* handler, bool& expTaskSet);
+      bool& isEntryFound);
 
  public:
   MapSegment()
       : m_map(nullptr),
         m_entryFactory(nullptr),
+        m_entryPool(nullptr),
         m_region(nullptr),
+        m_indexes(nullptr),
         m_expiryTaskManager(nullptr),
         m_primeIndex(0),
         m_spinlock(),
@@ -200,6 +280,11 @@ class APACHE_GEODE_EXPORT MapSegment {
             bool concurrencyChecksEnabled);
 
   void close();
+
+  /**
+   * @brief remove every entry and tombstone, updating the tombstone stats
+   * once for the whole segment.
+   */
   void clear();
 
   /**
@@ -224,12 +309,34 @@ class APACHE_GEODE_EXPORT MapSegment {
                 std::shared_ptr<VersionTag> versionTag,
                 DataInput* delta = nullptr);
 
+  /**
+   * @brief put the entries of batch at indexes, whose keys must all belong
+   * to this segment, under a single lock. Returns the number of entries
+   * created.
+   */
+  uint32_t putBatch(MapPutBatch& batch, const std::vector<size_t>& indexes,
+                    int destroyTracker);
+
   GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                        std::shared_ptr<MapEntryImpl>& me,
                        std::shared_ptr<Cacheable>& oldValue,
                        std::shared_ptr<VersionTag> versionTag,
                        bool& isTokenAdded);
 
+  /**
+   * @brief invalidate every entry that is not a tombstone under a single
+   * lock, appending those that had a value to invalidated.
+   */
+  void invalidateAll(std::vector<std::shared_ptr<MapEntryImpl>>& invalidated);
+
+  /**
+   * @brief invalidate the entries for keys, which must all belong to this
+   * segment, under a single lock. Returns the number of entries added for
+   * absent keys, as invalidate() does when concurrency checks are enabled.
+   */
+  uint32_t invalidateKeys(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys);
+
   /**
    * @brief remove an entry from the map, setting oldValue.
    */
@@ -283,15 +390,19 @@ class APACHE_GEODE_EXPORT MapSegment {
 
   void reapTombstones(std::shared_ptr<CacheableHashSet> removedKeys);
 
-  bool removeActualEntry(const std::shared_ptr<CacheableKey>& key,
-                         bool cancelTask = true);
+  /**
+   * @brief reap the tombstones that have outlived the tombstone timeout;
+   * called by the periodic sweep of the tombstone list.
+   */
+  void reapExpiredTombstones();
 
-  bool unguardedRemoveActualEntryWithoutCancelTask(
-      const std::shared_ptr<CacheableKey>& key,
-      TombstoneExpiryHandler*& handler, ExpiryTaskManager::id_type& taskid);
+  bool unguardedRemoveActualEntry(const std::shared_ptr<CacheableKey>& key);
 
-  bool unguardedRemoveActualEntry(const std::shared_ptr<CacheableKey>& key,
-                                  bool cancelTask = true);
+  /**
+   * @brief erase the entry for key from the map only, for a tombstone the
+   * tombstone list has already dropped; the spinlock must be held.
+   */
+  void unguardedEraseEntry(const std::shared_ptr<CacheableKey>& key);
 
   GfErrType isTombstone(std::shared_ptr<CacheableKey> key,
                         std::shared_ptr<MapEntryImpl>& me, bool& result);
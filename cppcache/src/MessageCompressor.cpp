@@ -0,0 +1,205 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MessageCompressor.hpp"
+
+#include <cstring>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "Lz4Codec.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+constexpr size_t MessageCompressor::HEADER_LENGTH;
+constexpr uint8_t MessageCompressor::COMPRESSED_PART;
+
+namespace {
+
+// a part is its length, its type byte and its payload
+constexpr size_t PART_HEADER_LENGTH = 5;
+constexpr size_t MESSAGE_LENGTH_OFFSET = 4;
+
+inline size_t readLength(const char* p) {
+  auto bytes = reinterpret_cast<const uint8_t*>(p);
+  return (static_cast<size_t>(bytes[0]) << 24) |
+         (static_cast<size_t>(bytes[1]) << 16) |
+         (static_cast<size_t>(bytes[2]) << 8) | static_cast<size_t>(bytes[3]);
+}
+
+inline void writeLength(char* p, size_t length) {
+  p[0] = static_cast<char>(length >> 24);
+  p[1] = static_cast<char>(length >> 16);
+  p[2] = static_cast<char>(length >> 8);
+  p[3] = static_cast<char>(length);
+}
+
+inline size_t readPartHeader(const char* parts, size_t offset, size_t length,
+                             uint8_t& type) {
+  if (length - offset < PART_HEADER_LENGTH) {
+    throw MessageException("MessageCompressor: truncated part header");
+  }
+  const auto partLength = readLength(parts + offset);
+  if (partLength > length - offset - PART_HEADER_LENGTH) {
+    throw MessageException("MessageCompressor: truncated part");
+  }
+  type = static_cast<uint8_t>(parts[offset + 4]);
+  return partLength;
+}
+
+inline size_t readExpandedLength(const char* payload, size_t length) {
+  if (length < 4) {
+    throw MessageException("MessageCompressor: truncated compressed part");
+  }
+  const auto expandedLength = readLength(payload);
+  if (expandedLength > static_cast<size_t>(INT32_MAX)) {
+    throw MessageException("MessageCompressor: compressed part is too large");
+  }
+  return expandedLength;
+}
+
+}  // namespace
+
+bool MessageCompressor::compress(const char* message, size_t length,
+                                 std::vector<char>& out,
+                                 Totals& totals) const {
+  if (length < HEADER_LENGTH + PART_HEADER_LENGTH + m_threshold) {
+    return false;
+  }
+
+  const auto parts = message + HEADER_LENGTH;
+  const auto partsLength = length - HEADER_LENGTH;
+  std::vector<char> result;
+  std::vector<char> compressed;
+  Totals partTotals;
+  size_t copied = 0;
+  for (size_t offset = 0; offset < partsLength;) {
+    if (partsLength - offset < PART_HEADER_LENGTH) {
+      return false;
+    }
+    const auto partLength = readLength(parts + offset);
+    const auto type = static_cast<uint8_t>(parts[offset + 4]);
+    if (partLength > partsLength - offset - PART_HEADER_LENGTH) {
+      // not framed as expected, so leave it to the server to complain
+      return false;
+    }
+    const auto payload = parts + offset + PART_HEADER_LENGTH;
+    const auto next = offset + PART_HEADER_LENGTH + partLength;
+    if (partLength < m_threshold || (type & COMPRESSED_PART)) {
+      offset = next;
+      continue;
+    }
+
+    compressed.resize(4 + Lz4Codec::compressBound(partLength));
+    const auto blockLength = Lz4Codec::compress(
+        reinterpret_cast<const uint8_t*>(payload), partLength,
+        reinterpret_cast<uint8_t*>(compressed.data() + 4));
+    if (4 + blockLength >= partLength) {
+      offset = next;
+      continue;
+    }
+
+    if (result.empty()) {
+      result.reserve(length);
+      result.assign(message, message + HEADER_LENGTH);
+    }
+    result.insert(result.end(), parts + copied, parts + offset);
+    char partHeader[PART_HEADER_LENGTH];
+    writeLength(partHeader, 4 + blockLength);
+    partHeader[4] = static_cast<char>(type | COMPRESSED_PART);
+    result.insert(result.end(), partHeader, partHeader + PART_HEADER_LENGTH);
+    writeLength(compressed.data(), partLength);
+    result.insert(result.end(), compressed.data(),
+                  compressed.data() + 4 + blockLength);
+    copied = next;
+
+    ++partTotals.parts;
+    partTotals.inputBytes += partLength;
+    partTotals.outputBytes += 4 + blockLength;
+    offset = next;
+  }
+
+  if (result.empty()) {
+    return false;
+  }
+  result.insert(result.end(), parts + copied, parts + partsLength);
+  setMessageLength(result.data(), result.size() - HEADER_LENGTH);
+  out.swap(result);
+  totals.parts += partTotals.parts;
+  totals.inputBytes += partTotals.inputBytes;
+  totals.outputBytes += partTotals.outputBytes;
+  return true;
+}
+
+bool MessageCompressor::isCompressed(const char* parts, size_t length,
+                                     size_t& expandedLength) {
+  bool compressed = false;
+  expandedLength = 0;
+  for (size_t offset = 0; offset < length;) {
+    uint8_t type;
+    const auto partLength = readPartHeader(parts, offset, length, type);
+    const auto payload = parts + offset + PART_HEADER_LENGTH;
+    if (type & COMPRESSED_PART) {
+      compressed = true;
+      expandedLength +=
+          PART_HEADER_LENGTH + readExpandedLength(payload, partLength);
+    } else {
+      expandedLength += PART_HEADER_LENGTH + partLength;
+    }
+    offset += PART_HEADER_LENGTH + partLength;
+  }
+  return compressed;
+}
+
+void MessageCompressor::expand(const char* parts, size_t length, char* out,
+                               Totals& totals) {
+  for (size_t offset = 0; offset < length;) {
+    uint8_t type;
+    const auto partLength = readPartHeader(parts, offset, length, type);
+    const auto payload = parts + offset + PART_HEADER_LENGTH;
+    if (type & COMPRESSED_PART) {
+      const auto expandedLength = readExpandedLength(payload, partLength);
+      writeLength(out, expandedLength);
+      out[4] = static_cast<char>(type & ~COMPRESSED_PART);
+      out += PART_HEADER_LENGTH;
+      if (!Lz4Codec::expand(reinterpret_cast<const uint8_t*>(payload + 4),
+                            partLength - 4, reinterpret_cast<uint8_t*>(out),
+                            expandedLength)) {
+        throw MessageException("MessageCompressor: corrupt compressed part");
+      }
+      out += expandedLength;
+
+      ++totals.parts;
+      totals.inputBytes += partLength;
+      totals.outputBytes += expandedLength;
+    } else {
+      std::memcpy(out, parts + offset, PART_HEADER_LENGTH + partLength);
+      out += PART_HEADER_LENGTH + partLength;
+    }
+    offset += PART_HEADER_LENGTH + partLength;
+  }
+}
+
+void MessageCompressor::setMessageLength(char* header, size_t length) {
+  writeLength(header + MESSAGE_LENGTH_OFFSET, length);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_MESSAGECOMPRESSOR_H_
+#define GEODE_MESSAGECOMPRESSOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @brief Compresses the large parts of the messages a connection exchanges
+ * with a server that accepted compression in the handshake.
+ *
+ * A part is framed as usual by its length and type byte. A compressed part
+ * has COMPRESSED_PART set in its type byte, and its payload is the length of
+ * the original payload followed by the payload as an LZ4 block. Only
+ * payloads of at least the threshold that shrink are compressed, so small
+ * requests go out unchanged.
+ */
+class APACHE_GEODE_EXPORT MessageCompressor {
+ public:
+  /** Length of the header that precedes the parts of a request or reply. */
+  static constexpr size_t HEADER_LENGTH = 17;
+
+  /** Set in the type byte of a compressed part. */
+  static constexpr uint8_t COMPRESSED_PART = 0x80;
+
+  /** What was done to the parts of one message. */
+  struct Totals {
+    Totals() : parts(0), inputBytes(0), outputBytes(0) {}
+
+    size_t parts;
+    size_t inputBytes;
+    size_t outputBytes;
+  };
+
+  explicit MessageCompressor(size_t threshold) : m_threshold(threshold) {}
+
+  inline size_t getThreshold() const { return m_threshold; }
+
+  /**
+   * Writes message, a request with its header, to out with its large parts
+   * compressed and the message length in the header updated. Returns false,
+   * leaving out alone, if no part was worth compressing.
+   */
+  bool compress(const char* message, size_t length, std::vector<char>& out,
+                Totals& totals) const;
+
+  /**
+   * Returns true, setting expandedLength to the length they expand to, if
+   * any of the parts in length bytes of parts is compressed. Throws
+   * MessageException if the parts are not framed properly.
+   */
+  static bool isCompressed(const char* parts, size_t length,
+                           size_t& expandedLength);
+
+  /**
+   * Expands the compressed parts in length bytes of parts into out, which
+   * must have room for the length isCompressed() returned. Throws
+   * MessageException if a part does not expand.
+   */
+  static void expand(const char* parts, size_t length, char* out,
+                     Totals& totals);
+
+  /** Sets the message length field of header. */
+  static void setMessageLength(char* header, size_t length);
+
+ private:
+  const size_t m_threshold;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_MESSAGECOMPRESSOR_H_
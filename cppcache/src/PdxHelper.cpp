@@ -110,24 +110,40 @@ void PdxHelper::serializePdx(
     // so we don't know whether user has used those or not;; Can we do some
     // trick here?
 
-    auto createPdxRemoteWriter = [&]() -> PdxRemoteWriter {
-      if (auto pd = pdxTypeRegistry->getPreserveData(pdxObject)) {
-        auto mergedPdxType = pdxTypeRegistry->getPdxType(pd->getMergedTypeId());
-        return PdxRemoteWriter(output, mergedPdxType, pd, pdxTypeRegistry);
-      } else {
-        return PdxRemoteWriter(output, className, pdxTypeRegistry);
-      }
-    };
+    auto preservedData = pdxTypeRegistry->getPreserveData(pdxObject);
+    int32_t startPositionOffset;
+    auto layout =
+        dynamic_cast<const internal::PdxFieldLayout*>(pdxObject.get());
+    if (layout != nullptr && preservedData == nullptr) {
+      // fields laid out at compile time go straight to the output, as the
+      // remote writer would write them without preserved data
+      PdxLocalWriter plw(output, localPdxType, pdxTypeRegistry);
+      plw.writeFields(*layout);
+      plw.endObjectWriting();
+      startPositionOffset = plw.getStartPositionOffset();
+    } else {
+      auto createPdxRemoteWriter = [&]() -> PdxRemoteWriter {
+        if (preservedData != nullptr) {
+          auto mergedPdxType =
+              pdxTypeRegistry->getPdxType(preservedData->getMergedTypeId());
+          return PdxRemoteWriter(output, mergedPdxType, preservedData,
+                                 pdxTypeRegistry);
+        } else {
+          return PdxRemoteWriter(output, className, pdxTypeRegistry);
+        }
+      };
 
-    PdxRemoteWriter prw = createPdxRemoteWriter();
+      PdxRemoteWriter prw = createPdxRemoteWriter();
 
-    pdxObject->toData(prw);
-    prw.endObjectWriting();
+      pdxObject->toData(prw);
+      prw.endObjectWriting();
+      startPositionOffset = prw.getStartPositionOffset();
+    }
 
     //[ToDo] need to write bytes for stats
     if (cacheImpl != nullptr) {
-      uint8_t* stPos = const_cast<uint8_t*>(output.getBuffer()) +
-                       prw.getStartPositionOffset();
+      uint8_t* stPos =
+          const_cast<uint8_t*>(output.getBuffer()) + startPositionOffset;
       int pdxLen = PdxHelper::readInt32(stPos);
       cachePerfStats.incPdxSerialization(
           pdxLen + 1 + 2 * 4);  // pdxLen + 93 DSID + len + typeID
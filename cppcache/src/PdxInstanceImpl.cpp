@@ -18,6 +18,7 @@
 #include "PdxInstanceImpl.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 #include <geode/Cache.hpp>
 #include <geode/PdxFieldTypes.hpp>
@@ -49,16 +50,6 @@ std::shared_ptr<PdxFieldType> PdxInstanceImpl::m_DefaultPdxFieldType(
     new PdxFieldType("default", "default", PdxFieldTypes::UNKNOWN,
                      -1 /*field index*/, false, 1, -1 /*var len field idx*/));
 
-bool sortFunc(std::shared_ptr<PdxFieldType> field1,
-              std::shared_ptr<PdxFieldType> field2) {
-  const auto diff = field1->getFieldName().compare(field2->getFieldName());
-  if (diff < 0) {
-    return true;
-  } else {
-    return false;
-  }
-}
-
 PdxInstanceImpl::~PdxInstanceImpl() noexcept {
   _GEODE_SAFE_DELETE_ARRAY(m_buffer);
 }
@@ -75,7 +66,8 @@ PdxInstanceImpl::PdxInstanceImpl(uint8_t* buffer, int length, int typeId,
       m_cacheStats(cacheStats),
       m_pdxTypeRegistry(pdxTypeRegistry),
       m_cacheImpl(cacheImpl),
-      m_enableTimeStatistics(enableTimeStatistics) {
+      m_enableTimeStatistics(enableTimeStatistics),
+      m_hashcode(0) {
   LOGDEBUG("PdxInstanceImpl::m_bufferLength = %d ", m_bufferLength);
 }
 
@@ -93,7 +85,8 @@ PdxInstanceImpl::PdxInstanceImpl(FieldVsValues fieldVsValue,
       m_cacheStats(cacheStats),
       m_pdxTypeRegistry(pdxTypeRegistry),
       m_cacheImpl(cacheImpl),
-      m_enableTimeStatistics(enableTimeStatistics) {
+      m_enableTimeStatistics(enableTimeStatistics),
+      m_hashcode(0) {
   m_pdxType->InitializeType();  // to generate static position map
 }
 
@@ -641,16 +634,26 @@ int PdxInstanceImpl::deepArrayHashCode(std::shared_ptr<Cacheable> obj) {
 }
 
 int32_t PdxInstanceImpl::hashcode() const {
+  // instances used as keys are hashed on every map operation, and their
+  // identity fields only change when the stream is replaced
+  auto hashCode = m_hashcode.load(std::memory_order_relaxed);
+  if (hashCode == 0) {
+    hashCode = computeHashcode();
+    m_hashcode.store(hashCode, std::memory_order_relaxed);
+  }
+  return hashCode;
+}
+
+int32_t PdxInstanceImpl::computeHashcode() const {
   int hashCode = 1;
 
   auto pt = getPdxType();
 
-  auto pdxIdentityFieldList = getIdentityPdxFields(pt);
+  auto pdxIdentityFieldList = pt->getIdentityPdxFields();
 
   auto dataInput = m_cacheImpl.createDataInput(m_buffer, m_bufferLength);
 
-  for (uint32_t i = 0; i < pdxIdentityFieldList.size(); i++) {
-    auto pField = pdxIdentityFieldList.at(i);
+  for (const auto& pField : *pdxIdentityFieldList) {
 
     LOGDEBUG("hashcode for pdxfield %s  hashcode is %d ",
              pField->getFieldName().c_str(), hashCode);
@@ -711,6 +714,7 @@ int32_t PdxInstanceImpl::hashcode() const {
 void PdxInstanceImpl::updatePdxStream(uint8_t* newPdxStream, int len) {
   m_buffer = DataInput::getBufferCopy(newPdxStream, len);
   m_bufferLength = len;
+  m_hashcode.store(0, std::memory_order_relaxed);
 }
 std::shared_ptr<PdxType> PdxInstanceImpl::getPdxType() const {
   if (m_typeId == 0) {
@@ -1127,20 +1131,43 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
     return false;
   }
 
-  auto myPdxIdentityFieldList = getIdentityPdxFields(myPdxType);
-  auto otherPdxIdentityFieldList = otherPdx->getIdentityPdxFields(otherPdxType);
+  // Instances of the same type share their field layout, so the identity
+  // fields line up without equating them.
+  auto identityFields = myPdxType->getIdentityPdxFields();
+  auto myPdxIdentityFieldList = identityFields.get();
+  auto otherPdxIdentityFieldList = identityFields.get();
+  std::vector<std::shared_ptr<PdxFieldType>> myEquatedFields;
+  std::vector<std::shared_ptr<PdxFieldType>> otherEquatedFields;
+  if (myPdxType == otherPdxType) {
+    if (m_buffer != nullptr && otherPdx->m_buffer != nullptr &&
+        m_bufferLength == otherPdx->m_bufferLength &&
+        std::memcmp(m_buffer, otherPdx->m_buffer, m_bufferLength) == 0) {
+      return true;
+    }
+    const auto myHashcode = m_hashcode.load(std::memory_order_relaxed);
+    const auto otherHashcode =
+        otherPdx->m_hashcode.load(std::memory_order_relaxed);
+    if (myHashcode != 0 && otherHashcode != 0 && myHashcode != otherHashcode) {
+      return false;
+    }
+  } else {
+    myEquatedFields = getIdentityPdxFields(myPdxType);
+    otherEquatedFields = otherPdx->getIdentityPdxFields(otherPdxType);
 
-  equatePdxFields(myPdxIdentityFieldList, otherPdxIdentityFieldList);
-  equatePdxFields(otherPdxIdentityFieldList, myPdxIdentityFieldList);
+    equatePdxFields(myEquatedFields, otherEquatedFields);
+    equatePdxFields(otherEquatedFields, myEquatedFields);
+    myPdxIdentityFieldList = &myEquatedFields;
+    otherPdxIdentityFieldList = &otherEquatedFields;
+  }
 
   auto myDataInput = m_cacheImpl.createDataInput(m_buffer, m_bufferLength);
   auto otherDataInput =
       m_cacheImpl.createDataInput(otherPdx->m_buffer, otherPdx->m_bufferLength);
 
   PdxFieldTypes fieldTypeId;
-  for (size_t i = 0; i < myPdxIdentityFieldList.size(); i++) {
-    auto myPFT = myPdxIdentityFieldList.at(i);
-    auto otherPFT = otherPdxIdentityFieldList.at(i);
+  for (size_t i = 0; i < myPdxIdentityFieldList->size(); i++) {
+    const auto& myPFT = (*myPdxIdentityFieldList)[i];
+    const auto& otherPFT = (*otherPdxIdentityFieldList)[i];
 
     LOGDEBUG("pdxfield %s ",
              ((myPFT != m_DefaultPdxFieldType) ? myPFT->getFieldName()
@@ -1234,7 +1261,7 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
   return true;
 }
 
-bool PdxInstanceImpl::compareRawBytes(PdxInstanceImpl& other,
+bool PdxInstanceImpl::compareRawBytes(const PdxInstanceImpl& other,
                                       std::shared_ptr<PdxType> myPT,
                                       std::shared_ptr<PdxFieldType> myF,
                                       DataInput& myDataInput,
@@ -1246,27 +1273,19 @@ bool PdxInstanceImpl::compareRawBytes(PdxInstanceImpl& other,
     int pos = getOffset(myDataInput, myPT, myF->getSequenceId());
     int nextpos =
         getNextFieldPosition(myDataInput, myF->getSequenceId() + 1, myPT);
-    myDataInput.reset();
-    myDataInput.advanceCursor(pos);
 
     int otherPos =
         other.getOffset(otherDataInput, otherPT, otherF->getSequenceId());
     int otherNextpos = other.getNextFieldPosition(
         otherDataInput, otherF->getSequenceId() + 1, otherPT);
-    otherDataInput.reset();
-    otherDataInput.advanceCursor(otherPos);
 
     if ((nextpos - pos) != (otherNextpos - otherPos)) {
       return false;
     }
 
-    for (int i = pos; i < nextpos; i++) {
-      if (myDataInput.read() != otherDataInput.read()) {
-        return false;
-      }
-    }
-
-    return true;
+    // positions are relative to the start of the buffers
+    return std::memcmp(m_buffer + pos, other.m_buffer + otherPos,
+                       nextpos - pos) == 0;
   } else {
     if (myF->equals(m_DefaultPdxFieldType)) {
       int otherPos =
@@ -1408,28 +1427,7 @@ void PdxInstanceImpl::setPdxId(int32_t typeId) {
 
 std::vector<std::shared_ptr<PdxFieldType>>
 PdxInstanceImpl::getIdentityPdxFields(std::shared_ptr<PdxType> pt) const {
-  std::vector<std::shared_ptr<PdxFieldType>>* pdxFieldList =
-      pt->getPdxFieldTypes();
-  std::vector<std::shared_ptr<PdxFieldType>> retList;
-  int size = static_cast<int>(pdxFieldList->size());
-  for (int i = 0; i < size; i++) {
-    auto pft = pdxFieldList->at(i);
-    if (pft->getIdentityField()) retList.push_back(pft);
-  }
-
-  if (retList.size() > 0) {
-    std::sort(retList.begin(), retList.end(), sortFunc);
-    return retList;
-  }
-
-  for (int i = 0; i < size; i++) {
-    auto pft = pdxFieldList->at(i);
-    retList.push_back(pft);
-  }
-
-  std::sort(retList.begin(), retList.end(), sortFunc);
-
-  return retList;
+  return *pt->getIdentityPdxFields();
 }
 
 int PdxInstanceImpl::getOffset(DataInput& dataInput,
@@ -1477,14 +1475,10 @@ int PdxInstanceImpl::getRawHashCode(std::shared_ptr<PdxType> pt,
     return 0;  // matched default bytes
   }
 
-  dataInput.reset();
-  dataInput.advanceCursor(nextpos - 1);
-
+  // positions are relative to the start of the buffer
   int h = 1;
   for (int i = nextpos - 1; i >= pos; i--) {
-    h = 31 * h + static_cast<int>(dataInput.read());
-    dataInput.reset();
-    dataInput.advanceCursor(i - 1);
+    h = 31 * h + static_cast<int>(static_cast<int8_t>(m_buffer[i]));
   }
   LOGDEBUG("getRawHashCode nbytes = %d, final hashcode = %d ", (nextpos - pos),
            h);
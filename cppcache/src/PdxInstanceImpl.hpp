@@ -20,6 +20,7 @@
 #ifndef GEODE_PDXINSTANCEIMPL_H_
 #define GEODE_PDXINSTANCEIMPL_H_
 
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -225,10 +226,15 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   PdxTypeRegistry& m_pdxTypeRegistry;
   const CacheImpl& m_cacheImpl;
   bool m_enableTimeStatistics;
+  // hashcode of m_buffer, or 0 until computed; an instance whose hashcode is
+  // 0 just recomputes it on each call
+  mutable std::atomic<int32_t> m_hashcode;
 
   std::vector<std::shared_ptr<PdxFieldType>> getIdentityPdxFields(
       std::shared_ptr<PdxType> pt) const;
 
+  int32_t computeHashcode() const;
+
   int getOffset(DataInput& dataInput, std::shared_ptr<PdxType> pt,
                 int sequenceId) const;
 
@@ -257,7 +263,8 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   void setOffsetForObject(DataInput& dataInput, std::shared_ptr<PdxType> pt,
                           int sequenceId) const;
 
-  bool compareRawBytes(PdxInstanceImpl& other, std::shared_ptr<PdxType> myPT,
+  bool compareRawBytes(const PdxInstanceImpl& other,
+                       std::shared_ptr<PdxType> myPT,
                        std::shared_ptr<PdxFieldType> myF,
                        DataInput& myDataInput, std::shared_ptr<PdxType> otherPT,
                        std::shared_ptr<PdxFieldType> otherF,
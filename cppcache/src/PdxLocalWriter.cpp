@@ -341,6 +341,12 @@ uint8_t* PdxLocalWriter::getPdxStream(int& pdxLen) {
 
 void PdxLocalWriter::writeByte(int8_t byte) { m_dataOutput->write(byte); }
 
+void PdxLocalWriter::writeFields(const internal::PdxFieldLayout& layout) {
+  layout.writePdxFields(*m_dataOutput,
+                        m_startPositionOffset + PdxHelper::PdxHeader,
+                        m_offsets);
+}
+
 std::shared_ptr<PdxTypeRegistry> PdxLocalWriter::getPdxTypeRegistry() const {
   return m_pdxTypeRegistry;
 }
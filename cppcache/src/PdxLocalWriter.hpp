@@ -25,6 +25,8 @@
 #include <geode/CacheableObjectArray.hpp>
 #include <geode/DataOutput.hpp>
 #include <geode/PdxWriter.hpp>
+#include <geode/Serializer.hpp>
+#include <geode/internal/PdxFieldLayout.hpp>
 
 #include "PdxRemotePreservedData.hpp"
 #include "PdxType.hpp"
@@ -111,11 +113,8 @@ class PdxLocalWriter : public PdxWriter {
   }
 
   template <typename mType>
-  void writeArrayObject(std::vector<mType> array) {
-    m_dataOutput->writeArrayLen(static_cast<int32_t>(array.size()));
-    for (auto&& obj : array) {
-      writeObject(obj);
-    }
+  void writeArrayObject(const std::vector<mType>& array) {
+    apache::geode::client::serializer::writeArrayObject(*m_dataOutput, array);
   }
 
   virtual PdxWriter& writeChar(const std::string& fieldName,
@@ -202,6 +201,12 @@ class PdxLocalWriter : public PdxWriter {
 
   void writeByte(int8_t byte);
 
+  /**
+   * Writes all the fields of an object whose layout is fixed at compile
+   * time, in place of the per field write calls.
+   */
+  void writeFields(const internal::PdxFieldLayout& layout);
+
   inline int32_t getStartPositionOffset() { return m_startPositionOffset; }
 
  private:
@@ -23,6 +23,8 @@
 
 #include "PdxType.hpp"
 
+#include <algorithm>
+
 #include "PdxFieldType.hpp"
 #include "PdxHelper.hpp"
 #include "PdxTypeRegistry.hpp"
@@ -284,6 +286,32 @@ void PdxType::initLocalToRemote() {
   }
 }
 
+std::shared_ptr<const std::vector<std::shared_ptr<PdxFieldType>>>
+PdxType::getIdentityPdxFields() const {
+  auto identityFields = std::atomic_load(&m_identityFields);
+  if (identityFields) {
+    return identityFields;
+  }
+
+  auto fields = std::make_shared<std::vector<std::shared_ptr<PdxFieldType>>>();
+  for (const auto& pft : *m_pdxFieldTypes) {
+    if (pft->getIdentityField()) fields->push_back(pft);
+  }
+  if (fields->empty()) {
+    *fields = *m_pdxFieldTypes;
+  }
+  std::sort(fields->begin(), fields->end(),
+            [](const std::shared_ptr<PdxFieldType>& field1,
+               const std::shared_ptr<PdxFieldType>& field2) {
+              return field1->getFieldName() < field2->getFieldName();
+            });
+
+  // racing threads compute the same list, so the last store wins harmlessly
+  identityFields = std::move(fields);
+  std::atomic_store(&m_identityFields, identityFields);
+  return identityFields;
+}
+
 void PdxType::InitializeType() {
   initRemoteToLocal();  // for writing
   initLocalToRemote();  // for reading
@@ -22,6 +22,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,10 @@ class PdxType : public internal::DataSerializableInternal,
 
   bool m_noJavaClass;
 
+  // computed on first use, once the type is complete
+  mutable std::shared_ptr<const std::vector<std::shared_ptr<PdxFieldType>>>
+      m_identityFields;
+
   PdxTypeRegistry& m_pdxTypeRegistry;
 
   void initRemoteToLocal();
@@ -174,6 +179,14 @@ class PdxType : public internal::DataSerializableInternal,
     return nullptr;
   }
 
+  /**
+   * Returns the fields that make up the identity of instances of this type,
+   * sorted by name: those marked as identity fields, or all fields if none
+   * is.
+   */
+  std::shared_ptr<const std::vector<std::shared_ptr<PdxFieldType>>>
+  getIdentityPdxFields() const;
+
   bool isLocal() const { return m_isLocal; }
 
   void setLocal(bool local) { m_isLocal = local; }
@@ -43,7 +43,7 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (statsType == nullptr) {
-    auto stats = new StatisticDescriptor*[27];
+    auto stats = new StatisticDescriptor*[37];
 
     stats[0] = factory->createIntGauge(
         "locators", "Current number of locators discovered", "locators");
@@ -98,10 +98,10 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
     stats[15] = factory->createIntGauge(
         "clientOpsInProgress", "Current number of clientOps being executed",
         "clientOps");
-    stats[16] = factory->createIntCounter(
+    stats[16] = factory->createStripedIntCounter(
         "clientOps", "Total number of clientOps completed successfully",
         "clientOps");
-    stats[17] = factory->createLongCounter(
+    stats[17] = factory->createStripedLongCounter(
         "clientOpTime",
         "Total amount of time, in nanoseconds spent doing clientOps",
         "nanoseconds");
@@ -111,7 +111,7 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
     stats[19] = factory->createIntCounter(
         "clientOpTimeouts",
         "Total number of clientOp attempts that have timed out", "clientOps");
-    stats[20] = factory->createLongCounter(
+    stats[20] = factory->createStripedLongCounter(
         "receivedBytes", "Total number of bytes received from the server.",
         "bytes");
     stats[21] = factory->createLongCounter(
@@ -132,8 +132,43 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
     stats[26] = factory->createLongCounter(
         "queryExecutionTime",
         "Total time spent while processing queryExecution", "nanoseconds");
+    stats[27] = factory->createIntCounter(
+        "sslFullHandshakes",
+        "Total number of SSL connections that did a full handshake",
+        "handshakes");
+    stats[28] = factory->createIntCounter(
+        "sslResumedHandshakes",
+        "Total number of SSL connections that resumed a cached session",
+        "handshakes");
+    stats[29] = factory->createLongCounter(
+        "compressedParts",
+        "Total number of message parts compressed before being sent", "parts");
+    stats[30] = factory->createLongCounter(
+        "compressionInputBytes",
+        "Total size of the message parts compressed, before compression",
+        "bytes");
+    stats[31] = factory->createLongCounter(
+        "compressionOutputBytes",
+        "Total size of the message parts compressed, after compression",
+        "bytes");
+    stats[32] = factory->createLongCounter(
+        "compressionTime",
+        "Total time spent compressing message parts", "nanoseconds");
+    stats[33] = factory->createLongCounter(
+        "decompressedParts",
+        "Total number of compressed message parts received", "parts");
+    stats[34] = factory->createLongCounter(
+        "decompressionInputBytes",
+        "Total size of the compressed message parts received", "bytes");
+    stats[35] = factory->createLongCounter(
+        "decompressionOutputBytes",
+        "Total size of the compressed message parts received, expanded",
+        "bytes");
+    stats[36] = factory->createLongCounter(
+        "decompressionTime",
+        "Total time spent expanding compressed message parts", "nanoseconds");
 
-    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 27);
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 37);
   }
   m_locatorsId = statsType->nameToId("locators");
   m_serversId = statsType->nameToId("servers");
@@ -163,6 +198,17 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
       statsType->nameToId("processedDeltaMessagesTime");
   m_queryExecutionsId = statsType->nameToId("queryExecutions");
   m_queryExecutionTimeId = statsType->nameToId("queryExecutionTime");
+  m_sslFullHandshakesId = statsType->nameToId("sslFullHandshakes");
+  m_sslResumedHandshakesId = statsType->nameToId("sslResumedHandshakes");
+  m_compressedPartsId = statsType->nameToId("compressedParts");
+  m_compressionInputBytesId = statsType->nameToId("compressionInputBytes");
+  m_compressionOutputBytesId = statsType->nameToId("compressionOutputBytes");
+  m_compressionTimeId = statsType->nameToId("compressionTime");
+  m_decompressedPartsId = statsType->nameToId("decompressedParts");
+  m_decompressionInputBytesId = statsType->nameToId("decompressionInputBytes");
+  m_decompressionOutputBytesId =
+      statsType->nameToId("decompressionOutputBytes");
+  m_decompressionTimeId = statsType->nameToId("decompressionTime");
 
   m_poolStats = factory->createAtomicStatistics(statsType, poolName.c_str());
 
@@ -193,6 +239,16 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   getStats()->setInt(m_processedDeltaMessagesTimeId, 0);
   getStats()->setInt(m_queryExecutionsId, 0);
   getStats()->setLong(m_queryExecutionTimeId, 0);
+  getStats()->setInt(m_sslFullHandshakesId, 0);
+  getStats()->setInt(m_sslResumedHandshakesId, 0);
+  getStats()->setLong(m_compressedPartsId, 0);
+  getStats()->setLong(m_compressionInputBytesId, 0);
+  getStats()->setLong(m_compressionOutputBytesId, 0);
+  getStats()->setLong(m_compressionTimeId, 0);
+  getStats()->setLong(m_decompressedPartsId, 0);
+  getStats()->setLong(m_decompressionInputBytesId, 0);
+  getStats()->setLong(m_decompressionOutputBytesId, 0);
+  getStats()->setLong(m_decompressionTimeId, 0);
 }
 
 PoolStats::~PoolStats() {
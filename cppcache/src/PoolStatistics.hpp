@@ -128,6 +128,26 @@ class PoolStats {
   void incQueryExecutionTimeId(int64_t value) {  // counter
     getStats()->incLong(m_queryExecutionTimeId, value);
   }
+  void incSslFullHandshakes() {  // counter
+    getStats()->incInt(m_sslFullHandshakesId, 1);
+  }
+  void incSslResumedHandshakes() {  // counter
+    getStats()->incInt(m_sslResumedHandshakesId, 1);
+  }
+  void incCompressedParts(int64_t parts, int64_t inputBytes,
+                          int64_t outputBytes, int64_t time) {  // counters
+    getStats()->incLong(m_compressedPartsId, parts);
+    getStats()->incLong(m_compressionInputBytesId, inputBytes);
+    getStats()->incLong(m_compressionOutputBytesId, outputBytes);
+    getStats()->incLong(m_compressionTimeId, time);
+  }
+  void incDecompressedParts(int64_t parts, int64_t inputBytes,
+                            int64_t outputBytes, int64_t time) {  // counters
+    getStats()->incLong(m_decompressedPartsId, parts);
+    getStats()->incLong(m_decompressionInputBytesId, inputBytes);
+    getStats()->incLong(m_decompressionOutputBytesId, outputBytes);
+    getStats()->incLong(m_decompressionTimeId, time);
+  }
   inline apache::geode::statistics::Statistics* getStats() {
     return m_poolStats;
   }
@@ -168,6 +188,16 @@ class PoolStats {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_sslFullHandshakesId;
+  int32_t m_sslResumedHandshakesId;
+  int32_t m_compressedPartsId;
+  int32_t m_compressionInputBytesId;
+  int32_t m_compressionOutputBytesId;
+  int32_t m_compressionTimeId;
+  int32_t m_decompressedPartsId;
+  int32_t m_decompressionInputBytesId;
+  int32_t m_decompressionOutputBytesId;
+  int32_t m_decompressionTimeId;
 
   static constexpr const char* STATS_NAME = "PoolStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this pool";
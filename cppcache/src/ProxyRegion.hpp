@@ -552,6 +552,15 @@ class APACHE_GEODE_EXPORT ProxyRegion final : public Region {
     return m_realRegion->selectValue(predicate, timeout);
   }
 
+  void createIndex(const std::string&, const std::string&,
+                   IndexType = IndexType::HASH) final {
+    throw UnsupportedOperationException("Region.createIndex()");
+  }
+
+  bool removeIndex(const std::string&) final {
+    throw UnsupportedOperationException("Region.removeIndex()");
+  }
+
   void removeAll(
       const std::vector<std::shared_ptr<CacheableKey>>& keys,
       const std::shared_ptr<Serializable>& aCallbackArgument = nullptr) final {
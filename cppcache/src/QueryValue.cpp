@@ -0,0 +1,329 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryValue.hpp"
+
+#include <cmath>
+#include <functional>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableDate.hpp>
+#include <geode/CacheableEnum.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/PdxInstance.hpp>
+
+#include "util/string.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+const double kTwoToThe63 = 9223372036854775808.0;
+
+// Compares an integer with a double without rounding either, so that the
+// order stays transitive across integers that doubles cannot represent.
+int compareMixed(int64_t integer, double value) {
+  if (std::isnan(value) || value >= kTwoToThe63) {
+    return -1;
+  }
+  if (value < -kTwoToThe63) {
+    return 1;
+  }
+  const auto whole = std::trunc(value);
+  const auto wholeInteger = static_cast<int64_t>(whole);
+  if (integer != wholeInteger) {
+    return integer < wholeInteger ? -1 : 1;
+  }
+  const auto fraction = value - whole;
+  return fraction > 0 ? -1 : (fraction < 0 ? 1 : 0);
+}
+
+// NaN sorts after, and is equal only to, itself.
+int compareDoubles(double lhs, double rhs) {
+  if (std::isnan(lhs) || std::isnan(rhs)) {
+    return std::isnan(lhs) - std::isnan(rhs);
+  }
+  return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+int rank(QueryValue::Kind kind) { return static_cast<int>(kind); }
+
+}  // namespace
+
+QueryValue::QueryValue()
+    : m_kind(Kind::UNDEFINED),
+      m_isInteger(false),
+      m_boolean(false),
+      m_integer(0),
+      m_double(0) {}
+
+QueryValue QueryValue::ofNull() {
+  QueryValue result;
+  result.m_kind = Kind::NIL;
+  return result;
+}
+
+QueryValue QueryValue::ofBoolean(bool value) {
+  QueryValue result;
+  result.m_kind = Kind::BOOLEAN;
+  result.m_boolean = value;
+  return result;
+}
+
+QueryValue QueryValue::ofInteger(int64_t value) {
+  QueryValue result;
+  result.m_kind = Kind::NUMBER;
+  result.m_isInteger = true;
+  result.m_integer = value;
+  return result;
+}
+
+QueryValue QueryValue::ofDouble(double value) {
+  QueryValue result;
+  result.m_kind = Kind::NUMBER;
+  result.m_double = value;
+  return result;
+}
+
+QueryValue QueryValue::ofString(std::string value) {
+  QueryValue result;
+  result.m_kind = Kind::STRING;
+  result.m_string = std::move(value);
+  return result;
+}
+
+QueryValue QueryValue::of(const std::shared_ptr<Cacheable>& value) {
+  if (value == nullptr) {
+    return ofNull();
+  }
+
+  const auto object = value.get();
+  if (auto string = dynamic_cast<const CacheableString*>(object)) {
+    return ofString(string->value());
+  } else if (auto int32 = dynamic_cast<const CacheableInt32*>(object)) {
+    return ofInteger(int32->value());
+  } else if (auto int64 = dynamic_cast<const CacheableInt64*>(object)) {
+    return ofInteger(int64->value());
+  } else if (auto int16 = dynamic_cast<const CacheableInt16*>(object)) {
+    return ofInteger(int16->value());
+  } else if (auto byte = dynamic_cast<const CacheableByte*>(object)) {
+    return ofInteger(byte->value());
+  } else if (auto boolean = dynamic_cast<const CacheableBoolean*>(object)) {
+    return ofBoolean(boolean->value());
+  } else if (auto dbl = dynamic_cast<const CacheableDouble*>(object)) {
+    return ofDouble(dbl->value());
+  } else if (auto flt = dynamic_cast<const CacheableFloat*>(object)) {
+    return ofDouble(flt->value());
+  } else if (auto date = dynamic_cast<const CacheableDate*>(object)) {
+    return ofInteger(date->milliseconds());
+  } else if (auto enm = dynamic_cast<const CacheableEnum*>(object)) {
+    return ofString(enm->getEnumName());
+  } else if (auto chr = dynamic_cast<const CacheableCharacter*>(object)) {
+    return ofString(to_utf8(std::u16string(1, chr->value())));
+  }
+
+  throw QueryException("Values of type " + value->toString() +
+                       " cannot be compared by the local query engine");
+}
+
+int QueryValue::compareTo(const QueryValue& other) const {
+  switch (m_kind) {
+    case Kind::BOOLEAN:
+      return static_cast<int>(m_boolean) - static_cast<int>(other.m_boolean);
+    case Kind::NUMBER:
+      if (m_isInteger && other.m_isInteger) {
+        return m_integer < other.m_integer
+                   ? -1
+                   : (m_integer > other.m_integer ? 1 : 0);
+      } else if (m_isInteger) {
+        return compareMixed(m_integer, other.m_double);
+      } else if (other.m_isInteger) {
+        return -compareMixed(other.m_integer, m_double);
+      }
+      return compareDoubles(m_double, other.m_double);
+    case Kind::STRING:
+      return m_string.compare(other.m_string);
+    default:
+      return 0;
+  }
+}
+
+bool QueryValue::satisfies(QueryOperator op, const QueryValue& other) const {
+  if (m_kind == Kind::UNDEFINED || other.m_kind == Kind::UNDEFINED) {
+    return false;
+  }
+  if (m_kind != other.m_kind || m_kind == Kind::NIL) {
+    const auto same = m_kind == other.m_kind;
+    return op == QueryOperator::EQ ? same : (op == QueryOperator::NE && !same);
+  }
+
+  const auto comparison = compareTo(other);
+  switch (op) {
+    case QueryOperator::EQ:
+      return comparison == 0;
+    case QueryOperator::NE:
+      return comparison != 0;
+    case QueryOperator::LT:
+      return comparison < 0;
+    case QueryOperator::LE:
+      return comparison <= 0;
+    case QueryOperator::GT:
+      return comparison > 0;
+    case QueryOperator::GE:
+      return comparison >= 0;
+  }
+  return false;
+}
+
+bool QueryValue::operator<(const QueryValue& other) const {
+  if (m_kind != other.m_kind) {
+    return rank(m_kind) < rank(other.m_kind);
+  }
+  return compareTo(other) < 0;
+}
+
+bool QueryValue::operator==(const QueryValue& other) const {
+  return m_kind == other.m_kind && compareTo(other) == 0;
+}
+
+size_t QueryValue::hash() const {
+  switch (m_kind) {
+    case Kind::BOOLEAN:
+      return std::hash<bool>{}(m_boolean);
+    case Kind::NUMBER:
+      if (m_isInteger) {
+        return std::hash<int64_t>{}(m_integer);
+      } else if (std::isnan(m_double)) {
+        return 0;
+      } else if (std::trunc(m_double) == m_double &&
+                 m_double >= -kTwoToThe63 && m_double < kTwoToThe63) {
+        // equal to an integer, so must hash like one
+        return std::hash<int64_t>{}(static_cast<int64_t>(m_double));
+      }
+      return std::hash<double>{}(m_double);
+    case Kind::STRING:
+      return std::hash<std::string>{}(m_string);
+    default:
+      return static_cast<size_t>(m_kind);
+  }
+}
+
+std::string QueryValue::toString() const {
+  switch (m_kind) {
+    case Kind::UNDEFINED:
+      return "UNDEFINED";
+    case Kind::NIL:
+      return "null";
+    case Kind::BOOLEAN:
+      return m_boolean ? "true" : "false";
+    case Kind::NUMBER:
+      return m_isInteger ? std::to_string(m_integer)
+                         : std::to_string(m_double);
+    case Kind::STRING:
+      return "'" + m_string + "'";
+  }
+  return "";
+}
+
+QueryPath::QueryPath(std::vector<std::string> attributes)
+    : m_attributes(std::move(attributes)) {}
+
+std::shared_ptr<Cacheable> QueryPath::resolve(
+    const std::shared_ptr<Cacheable>& value, bool& defined) const {
+  defined = true;
+  auto current = value;
+  for (const auto& attribute : m_attributes) {
+    if (current == nullptr) {
+      defined = false;
+      return nullptr;
+    }
+
+    auto pdx = std::dynamic_pointer_cast<PdxInstance>(current);
+    if (pdx == nullptr) {
+      throw QueryException("Attribute " + attribute +
+                           " cannot be read locally from " +
+                           current->toString());
+    }
+    if (!pdx->hasField(attribute)) {
+      defined = false;
+      return nullptr;
+    }
+
+    switch (pdx->getFieldType(attribute)) {
+      case PdxFieldTypes::BOOLEAN:
+        current = CacheableBoolean::create(pdx->getBooleanField(attribute));
+        break;
+      case PdxFieldTypes::BYTE:
+        current = CacheableByte::create(pdx->getByteField(attribute));
+        break;
+      case PdxFieldTypes::CHAR:
+        current = CacheableCharacter::create(pdx->getCharField(attribute));
+        break;
+      case PdxFieldTypes::SHORT:
+        current = CacheableInt16::create(pdx->getShortField(attribute));
+        break;
+      case PdxFieldTypes::INT:
+        current = CacheableInt32::create(pdx->getIntField(attribute));
+        break;
+      case PdxFieldTypes::LONG:
+        current = CacheableInt64::create(pdx->getLongField(attribute));
+        break;
+      case PdxFieldTypes::FLOAT:
+        current = CacheableFloat::create(pdx->getFloatField(attribute));
+        break;
+      case PdxFieldTypes::DOUBLE:
+        current = CacheableDouble::create(pdx->getDoubleField(attribute));
+        break;
+      case PdxFieldTypes::DATE:
+        current = pdx->getCacheableDateField(attribute);
+        break;
+      case PdxFieldTypes::STRING:
+        current = CacheableString::create(pdx->getStringField(attribute));
+        break;
+      case PdxFieldTypes::OBJECT:
+        current = pdx->getCacheableField(attribute);
+        break;
+      default:
+        throw QueryException("Attribute " + attribute +
+                             " has a type the local query engine does not "
+                             "support");
+    }
+  }
+  return current;
+}
+
+QueryValue QueryPath::evaluate(const std::shared_ptr<Cacheable>& value) const {
+  bool defined;
+  auto attribute = resolve(value, defined);
+  return defined ? QueryValue::of(attribute) : QueryValue();
+}
+
+std::string QueryPath::toString() const {
+  std::string result = "this";
+  for (const auto& attribute : m_attributes) {
+    result += '.';
+    result += attribute;
+  }
+  return result;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
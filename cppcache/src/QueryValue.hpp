@@ -0,0 +1,150 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERYVALUE_H_
+#define GEODE_QUERYVALUE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/Serializable.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/** Comparison operators of the locally evaluated query subset. */
+enum class QueryOperator { EQ, NE, LT, LE, GT, GE };
+
+/**
+ * A scalar taken from a cached value while evaluating a query locally.
+ *
+ * All integral types, dates (as milliseconds) and floating point types
+ * compare as numbers; strings and enums (by name) compare as strings.
+ * Values of different kinds are never equal, and UNDEFINED, the value of an
+ * attribute that does not exist, satisfies no comparison at all.
+ */
+class APACHE_GEODE_EXPORT QueryValue {
+ public:
+  enum class Kind { UNDEFINED, NIL, BOOLEAN, NUMBER, STRING };
+
+  /** Constructs an UNDEFINED value. */
+  QueryValue();
+
+  static QueryValue ofNull();
+
+  static QueryValue ofBoolean(bool value);
+
+  static QueryValue ofInteger(int64_t value);
+
+  static QueryValue ofDouble(double value);
+
+  static QueryValue ofString(std::string value);
+
+  /**
+   * Converts a builtin cacheable to a query value. Throws QueryException for
+   * types the local query engine cannot compare.
+   */
+  static QueryValue of(const std::shared_ptr<Cacheable>& value);
+
+  inline Kind getKind() const { return m_kind; }
+
+  inline bool isDefined() const { return m_kind != Kind::UNDEFINED; }
+
+  /** Returns true if this value op other holds. */
+  bool satisfies(QueryOperator op, const QueryValue& other) const;
+
+  /**
+   * Orders values first by kind, then by value; defines the order of
+   * range indexes.
+   */
+  bool operator<(const QueryValue& other) const;
+
+  bool operator==(const QueryValue& other) const;
+
+  size_t hash() const;
+
+  std::string toString() const;
+
+  struct Hash {
+    inline size_t operator()(const QueryValue& value) const {
+      return value.hash();
+    }
+  };
+
+ private:
+  // compares values of the same kind
+  int compareTo(const QueryValue& other) const;
+
+  Kind m_kind;
+  bool m_isInteger;
+  bool m_boolean;
+  int64_t m_integer;
+  double m_double;
+  std::string m_string;
+};
+
+/**
+ * A dotted attribute path such as <code>address.city</code>, evaluated
+ * against region values. Attributes are read from PdxInstance values; any
+ * other value has no attributes the local engine can see.
+ */
+class APACHE_GEODE_EXPORT QueryPath {
+ public:
+  /** The empty path, which evaluates to the value itself. */
+  QueryPath() = default;
+
+  explicit QueryPath(std::vector<std::string> attributes);
+
+  /**
+   * Returns the attribute of value named by this path, or nullptr with
+   * defined set to false if some attribute along the path does not exist.
+   * Throws QueryException if the path reaches a value whose attributes
+   * cannot be read locally, such as a domain object or an array.
+   */
+  std::shared_ptr<Cacheable> resolve(const std::shared_ptr<Cacheable>& value,
+                                     bool& defined) const;
+
+  /** Shorthand for QueryValue::of(resolve(value)). */
+  QueryValue evaluate(const std::shared_ptr<Cacheable>& value) const;
+
+  inline const std::vector<std::string>& getAttributes() const {
+    return m_attributes;
+  }
+
+  inline bool isEmpty() const { return m_attributes.empty(); }
+
+  inline bool operator==(const QueryPath& other) const {
+    return m_attributes == other.m_attributes;
+  }
+
+  std::string toString() const;
+
+ private:
+  std::vector<std::string> m_attributes;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERYVALUE_H_
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReceiveBufferPool.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <string>
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Sits in front of every buffer; sized to keep the payload aligned as
+// operator new would.
+union BufferHeader {
+  size_t m_sizeClass;
+  std::max_align_t m_align;
+};
+
+const size_t kUnpooled = ReceiveBufferPool::kNumClasses;
+
+inline size_t sizeClassOf(size_t size) {
+  size_t sizeClass = 0;
+  while ((size_t{1} << (sizeClass + ReceiveBufferPool::kMinClassShift)) <
+         size) {
+    if (++sizeClass == ReceiveBufferPool::kNumClasses) {
+      return kUnpooled;
+    }
+  }
+  return sizeClass;
+}
+
+inline size_t classBytes(size_t sizeClass) {
+  return size_t{1} << (sizeClass + ReceiveBufferPool::kMinClassShift);
+}
+
+inline BufferHeader* headerOf(const void* buffer) {
+  return reinterpret_cast<BufferHeader*>(
+             const_cast<uint8_t*>(static_cast<const uint8_t*>(buffer))) -
+         1;
+}
+
+uint8_t* newBuffer(size_t sizeClass, size_t size) {
+  void* memory;
+  try {
+    memory = ::operator new(sizeof(BufferHeader) + size);
+  } catch (const std::bad_alloc&) {
+    throw OutOfMemoryException(
+        "Out of Memory while allocating receive buffer of " +
+        std::to_string(size) + " bytes");
+  }
+  auto header = static_cast<BufferHeader*>(memory);
+  header->m_sizeClass = sizeClass;
+  return reinterpret_cast<uint8_t*>(header + 1);
+}
+
+}  // namespace
+
+const size_t ReceiveBufferPool::kMinClassShift;
+const size_t ReceiveBufferPool::kMaxClassShift;
+const size_t ReceiveBufferPool::kNumClasses;
+const size_t ReceiveBufferPool::kMaxFreeBytesPerClass;
+
+ReceiveBufferPool& ReceiveBufferPool::instance() {
+  // never destroyed so that buffers released during static destruction,
+  // e.g. by a chunk processor still winding down, have somewhere to go
+  static auto pool = new ReceiveBufferPool();
+  return *pool;
+}
+
+uint8_t* ReceiveBufferPool::allocate(size_t size) {
+  const auto sizeClass = sizeClassOf(size);
+  if (sizeClass == kUnpooled) {
+    return newBuffer(sizeClass, size);
+  }
+
+  auto& freeList = instance().m_freeLists[sizeClass];
+  {
+    std::lock_guard<spinlock_mutex> guard(freeList.m_lock);
+    if (!freeList.m_buffers.empty()) {
+      auto buffer = freeList.m_buffers.back();
+      freeList.m_buffers.pop_back();
+      return buffer;
+    }
+  }
+  return newBuffer(sizeClass, classBytes(sizeClass));
+}
+
+void ReceiveBufferPool::release(const void* buffer) {
+  if (buffer == nullptr) {
+    return;
+  }
+
+  auto header = headerOf(buffer);
+  const auto sizeClass = header->m_sizeClass;
+  if (sizeClass != kUnpooled) {
+    const auto maxBuffers =
+        std::max<size_t>(kMaxFreeBytesPerClass / classBytes(sizeClass), 2);
+    auto& freeList = instance().m_freeLists[sizeClass];
+    std::lock_guard<spinlock_mutex> guard(freeList.m_lock);
+    if (freeList.m_buffers.size() < maxBuffers) {
+      freeList.m_buffers.push_back(reinterpret_cast<uint8_t*>(header + 1));
+      return;
+    }
+  }
+  ::operator delete(header);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
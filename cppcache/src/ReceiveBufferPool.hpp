@@ -0,0 +1,95 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_RECEIVEBUFFERPOOL_H_
+#define GEODE_RECEIVEBUFFERPOOL_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using util::concurrent::spinlock_mutex;
+
+/**
+ * @brief Recycles the buffers that replies and reply chunks are read into.
+ *
+ * Buffers are rounded up to power of two size classes between 256 bytes and
+ * 1 MiB and kept on a free list per class when released, so steady traffic
+ * reuses the same few buffers instead of allocating one per reply. Larger
+ * buffers go straight to the heap. Each buffer carries its size class in a
+ * small header, so release() only needs the pointer and may be called from
+ * any thread, as the chunk processing thread does.
+ */
+class APACHE_GEODE_EXPORT ReceiveBufferPool {
+ public:
+  /**
+   * Returns a buffer of at least size bytes. Throws OutOfMemoryException if
+   * the heap is exhausted.
+   */
+  static uint8_t* allocate(size_t size);
+
+  /** Returns a buffer obtained from allocate(); nullptr is ignored. */
+  static void release(const void* buffer);
+
+  /** Deleter for holding a buffer in a <code>std::unique_ptr</code>. */
+  struct Deleter {
+    inline void operator()(const void* buffer) const { release(buffer); }
+  };
+
+  static const size_t kMinClassShift = 8;
+  static const size_t kMaxClassShift = 20;
+  static const size_t kNumClasses = kMaxClassShift - kMinClassShift + 1;
+  /** Upper bound on the bytes held on the free list of each class. */
+  static const size_t kMaxFreeBytesPerClass = 1 << 20;
+
+ private:
+  struct FreeList {
+    spinlock_mutex m_lock;
+    std::vector<uint8_t*> m_buffers;
+  };
+
+  ReceiveBufferPool() = default;
+
+  static ReceiveBufferPool& instance();
+
+  std::array<FreeList, kNumClasses> m_freeLists;
+};
+
+/**
+ * A received buffer released back to the ReceiveBufferPool when it goes out
+ * of scope.
+ */
+template <class T>
+using ReceiveBufferPtr = std::unique_ptr<T, ReceiveBufferPool::Deleter>;
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RECEIVEBUFFERPOOL_H_
@@ -55,7 +55,8 @@ RegionAttributes::RegionAttributes()
       m_persistenceProperties(nullptr),
       m_persistenceManager(nullptr),
       m_isClonable(false),
-      m_isConcurrencyChecksEnabled(true) {}
+      m_isConcurrencyChecksEnabled(true),
+      m_storeSerializedValues(false) {}
 
 RegionAttributes::~RegionAttributes() noexcept = default;
 
@@ -454,6 +455,9 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_isConcurrencyChecksEnabled != other.m_isConcurrencyChecksEnabled) {
     return false;
   }
+  if (m_storeSerializedValues != other.m_storeSerializedValues) {
+    return false;
+  }
 
   return true;
 }
@@ -550,6 +554,10 @@ void RegionAttributes::setConcurrencyChecksEnabled(bool enable) {
   m_isConcurrencyChecksEnabled = enable;
 }
 
+void RegionAttributes::setStoreSerializedValues(bool enable) {
+  m_storeSerializedValues = enable;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -232,6 +232,12 @@ RegionAttributesFactory& RegionAttributesFactory::setConcurrencyChecksEnabled(
   return *this;
 }
 
+RegionAttributesFactory& RegionAttributesFactory::setStoreSerializedValues(
+    bool storeSerializedValues) {
+  m_regionAttributes.setStoreSerializedValues(storeSerializedValues);
+  return *this;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -173,6 +173,12 @@ RegionFactory& RegionFactory::setConcurrencyChecksEnabled(bool enable) {
   m_regionAttributesFactory->setConcurrencyChecksEnabled(enable);
   return *this;
 }
+
+RegionFactory& RegionFactory::setStoreSerializedValues(bool enable) {
+  m_regionAttributesFactory->setStoreSerializedValues(enable);
+  return *this;
+}
+
 RegionFactory& RegionFactory::setLruEntriesLimit(const uint32_t entriesLimit) {
   m_regionAttributesFactory->setLruEntriesLimit(entriesLimit);
   return *this;
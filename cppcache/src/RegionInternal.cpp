@@ -19,6 +19,8 @@
 
 #include <geode/RegionEntry.hpp>
 
+#include "CacheableToken.hpp"
+#include "SerializedCacheable.hpp"
 #include "TombstoneList.hpp"
 
 namespace apache {
@@ -96,15 +98,49 @@ std::shared_ptr<Serializable> RegionInternal::selectValue(
       "selectValue only supported by Thin Client Region.");
 }
 
+void RegionInternal::createIndex(const std::string&, const std::string&,
+                                 IndexType) {
+  throw UnsupportedOperationException(
+      "createIndex only supported by caching regions.");
+}
+
+bool RegionInternal::removeIndex(const std::string&) {
+  throw UnsupportedOperationException(
+      "removeIndex only supported by caching regions.");
+}
+
 std::shared_ptr<TombstoneList> RegionInternal::getTombstoneList() {
   throw UnsupportedOperationException(
       "getTombstoneList only supported by LocalRegion.");
 }
 
+LocalIndexes* RegionInternal::getLocalIndexes() { return nullptr; }
+
 std::shared_ptr<RegionEntry> RegionInternal::createRegionEntry(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Cacheable>& value) {
-  return std::make_shared<RegionEntry>(shared_from_this(), key, value);
+  return std::make_shared<RegionEntry>(shared_from_this(), key,
+                                       fromStoredValue(value));
+}
+
+std::shared_ptr<Cacheable> RegionInternal::toStoredValue(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (!m_regionAttributes.getStoreSerializedValues() || value == nullptr ||
+      CacheableToken::isToken(value) ||
+      dynamic_cast<SerializedCacheable*>(value.get()) != nullptr) {
+    return value;
+  }
+  return SerializedCacheable::create(value, *getCacheImpl(), getPool().get());
+}
+
+std::shared_ptr<Cacheable> RegionInternal::fromStoredValue(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (m_regionAttributes.getStoreSerializedValues()) {
+    if (auto serialized = dynamic_cast<SerializedCacheable*>(value.get())) {
+      return serialized->deserialize(*getCacheImpl(), getPool().get());
+    }
+  }
+  return value;
 }
 
 void RegionInternal::setLruEntriesLimit(uint32_t limit) {
@@ -130,6 +130,7 @@ class CacheEventFlags {
   }
 };
 
+class LocalIndexes;
 class TombstoneList;
 class VersionTag;
 class MapEntryImpl;
@@ -177,6 +178,12 @@ class RegionInternal : public Region {
       std::chrono::milliseconds timeout =
           DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
 
+  virtual void createIndex(const std::string& name,
+                           const std::string& expression,
+                           IndexType type = IndexType::HASH) override;
+
+  virtual bool removeIndex(const std::string& name) override;
+
   /** @brief Public Methods
    */
   virtual std::shared_ptr<PersistenceManager> getPersistenceManager() = 0;
@@ -268,6 +275,12 @@ class RegionInternal : public Region {
   virtual CacheImpl* getCacheImpl() const = 0;
   virtual std::shared_ptr<TombstoneList> getTombstoneList();
 
+  /**
+   * Returns the indexes the entries map keeps up to date, or nullptr if the
+   * region cannot be indexed.
+   */
+  virtual LocalIndexes* getLocalIndexes();
+
   // KN: added now.
   virtual void updateAccessAndModifiedTime(bool modified) = 0;
   virtual void updateAccessAndModifiedTimeForEntry(
@@ -275,6 +288,20 @@ class RegionInternal : public Region {
   std::shared_ptr<RegionEntry> createRegionEntry(
       const std::shared_ptr<CacheableKey>& key,
       const std::shared_ptr<Cacheable>& value);
+
+  /**
+   * Returns value in the form it is kept in the entries map, which is a
+   * SerializedCacheable when the region stores serialized values.
+   */
+  std::shared_ptr<Cacheable> toStoredValue(
+      const std::shared_ptr<Cacheable>& value) const;
+
+  /**
+   * Returns a value taken from the entries map in the form handed to the
+   * application, deserializing it if it is stored serialized.
+   */
+  std::shared_ptr<Cacheable> fromStoredValue(
+      const std::shared_ptr<Cacheable>& value) const;
   virtual void addDisMessToQueue(){};
 
   virtual void txDestroy(const std::shared_ptr<CacheableKey>& key,
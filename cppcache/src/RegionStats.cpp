@@ -40,7 +40,7 @@ RegionStats::RegionStats(StatisticsFactory* factory,
 
   if (!statsType) {
     const bool largerIsBetter = true;
-    auto stats = new StatisticDescriptor*[25];
+    auto stats = new StatisticDescriptor*[28];
     stats[0] = factory->createIntCounter(
         "creates", "The total number of cache creates for this region",
         "entries", largerIsBetter);
@@ -135,7 +135,22 @@ RegionStats::RegionStats(StatisticsFactory* factory,
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
-    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 25);
+    stats[25] = factory->createIntCounter(
+        "registerInterestBatches",
+        "The total number of key batches registered for interest for this "
+        "region",
+        "operations", largerIsBetter);
+    stats[26] = factory->createIntCounter(
+        "registerInterestInitialValues",
+        "The total number of initial values received on registering interest "
+        "put in this region",
+        "entries", largerIsBetter);
+    stats[27] = factory->createLongCounter(
+        "registerInterestInitialValuesTime",
+        "Total time spent putting initial values received on registering "
+        "interest in this region",
+        "Nanoseconds", !largerIsBetter);
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 28);
   }
 
   m_destroysId = statsType->nameToId("destroys");
@@ -164,6 +179,12 @@ RegionStats::RegionStats(StatisticsFactory* factory,
       statsType->nameToId("cacheListenerCallsCompleted");
   m_ListenerCallTimeId = statsType->nameToId("cacheListenerCallTime");
   m_clearsId = statsType->nameToId("clears");
+  m_registerInterestBatchesId =
+      statsType->nameToId("registerInterestBatches");
+  m_registerInterestInitialValuesId =
+      statsType->nameToId("registerInterestInitialValues");
+  m_registerInterestInitialValuesTimeId =
+      statsType->nameToId("registerInterestInitialValuesTime");
 
   m_regionStats = factory->createAtomicStatistics(
       statsType, const_cast<char*>(regionName.c_str()));
@@ -193,6 +214,9 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_ListenerCallsCompletedId, 0);
   m_regionStats->setInt(m_ListenerCallTimeId, 0);
   m_regionStats->setInt(m_clearsId, 0);
+  m_regionStats->setInt(m_registerInterestBatchesId, 0);
+  m_regionStats->setInt(m_registerInterestInitialValuesId, 0);
+  m_regionStats->setLong(m_registerInterestInitialValuesTimeId, 0);
 }
 
 RegionStats::~RegionStats() {
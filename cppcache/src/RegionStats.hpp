@@ -48,9 +48,13 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline void incDestroys() { m_regionStats->incInt(m_destroysId, 1); }
 
-  inline void incCreates() { m_regionStats->incInt(m_createsId, 1); }
+  inline void incCreates(int32_t count = 1) {
+    m_regionStats->incInt(m_createsId, count);
+  }
 
-  inline void incPuts() { m_regionStats->incInt(m_putsId, 1); }
+  inline void incPuts(int32_t count = 1) {
+    m_regionStats->incInt(m_putsId, count);
+  }
 
   inline void incGets() { m_regionStats->incInt(m_getsId, 1); }
 
@@ -90,6 +94,14 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline void incClears() { m_regionStats->incInt(m_clearsId, 1); }
 
+  inline void incRegisterInterestBatches() {
+    m_regionStats->incInt(m_registerInterestBatchesId, 1);
+  }
+
+  inline void incRegisterInterestInitialValues(int32_t count) {
+    m_regionStats->incInt(m_registerInterestInitialValuesId, count);
+  }
+
   inline void updateGetTime() { m_regionStats->incInt(m_clearsId, 1); }
 
   inline apache::geode::statistics::Statistics* getStat() {
@@ -114,6 +126,10 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline int32_t getClearsId() { return m_clearsId; }
 
+  inline int32_t getRegisterInterestInitialValuesTimeId() {
+    return m_registerInterestInitialValuesTimeId;
+  }
+
  private:
   apache::geode::statistics::Statistics* m_regionStats;
 
@@ -142,6 +158,9 @@ class APACHE_GEODE_EXPORT RegionStats {
   int32_t m_ListenerCallsCompletedId;
   int32_t m_ListenerCallTimeId;
   int32_t m_clearsId;
+  int32_t m_registerInterestBatchesId;
+  int32_t m_registerInterestInitialValuesId;
+  int32_t m_registerInterestInitialValuesTimeId;
 
   static constexpr const char* STATS_NAME = "RegionStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this region";
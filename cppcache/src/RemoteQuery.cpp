@@ -18,6 +18,7 @@
 #include "RemoteQuery.hpp"
 
 #include "ResultSetImpl.hpp"
+#include "ResultStreamImpl.hpp"
 #include "StructSetImpl.hpp"
 #include "TcrConnectionManager.hpp"
 #include "ThinClientPoolDM.hpp"
@@ -62,6 +63,32 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
   return execute(timeout, "Query::execute", m_tccdm, paramList);
 }
 
+std::shared_ptr<ResultStream> RemoteQuery::stream(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout, size_t maxBufferedResults) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  auto query = shared_from_this();
+  auto& streams =
+      m_tccdm->getConnectionManager().getCacheImpl()->getResultStreams();
+  return streams.start(
+      maxBufferedResults, [query, paramList, timeout](
+                              const std::shared_ptr<ResultStreamImpl>& stream) {
+        GuardUserAttributes gua;
+        if (query->m_authenticatedView != nullptr) {
+          gua.setAuthenticatedView(query->m_authenticatedView);
+        }
+        if (auto pool = dynamic_cast<ThinClientPoolDM*>(query->m_tccdm)) {
+          pool->getStats().incQueryExecutionId();
+        }
+        TcrMessageReply reply(true, query->m_tccdm);
+        ChunkedQueryResponse response(reply, stream.get());
+        reply.setChunkedResultHandler(&response);
+        GfErrType err = query->executeNoThrow(timeout, reply, "Query::stream",
+                                              query->m_tccdm, paramList);
+        GfErrTypeToException("Query::stream", err);
+      });
+}
+
 std::shared_ptr<SelectResults> RemoteQuery::execute(
     std::chrono::milliseconds timeout, const char* func, ThinClientBaseDM* tcdm,
     std::shared_ptr<CacheableVector> paramList) {
@@ -70,15 +97,16 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
     pool->getStats().incQueryExecutionId();
   }
   /*get the start time for QueryExecutionTime stat*/
-  bool enableTimeStatistics = tcdm->getConnectionManager()
-                                  .getCacheImpl()
-                                  ->getDistributedSystem()
-                                  .getSystemProperties()
-                                  .getEnableTimeStatistics();
+  const auto& sysProps = tcdm->getConnectionManager()
+                             .getCacheImpl()
+                             ->getDistributedSystem()
+                             .getSystemProperties();
+  bool enableTimeStatistics = sysProps.getEnableTimeStatistics();
   int64_t sampleStartNanos =
       enableTimeStatistics ? Utils::startStatOpTime() : 0;
   TcrMessageReply reply(true, tcdm);
   auto* resultCollector = (new ChunkedQueryResponse(reply));
+  resultCollector->setColumnar(sysProps.queryColumnarResults());
   reply.setChunkedResultHandler(
       static_cast<TcrChunkedResult*>(resultCollector));
   GfErrType err = executeNoThrow(timeout, reply, func, tcdm, paramList);
@@ -94,6 +122,21 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
     LOGFINEST("%s: creating ResultSet for query: %s", func,
               m_queryString.c_str());
     sr = std::make_shared<ResultSetImpl>(values);
+  } else if (!resultCollector->getColumns().empty()) {
+    auto&& columns = resultCollector->getColumns();
+    for (auto&& column : columns) {
+      if (column->size() != columns.front()->size()) {
+        char exMsg[1024];
+        std::snprintf(exMsg, 1023,
+                      "%s: Number of values coming from "
+                      "server has to be the same for every field",
+                      func);
+        throw MessageException(exMsg);
+      }
+    }
+    LOGFINEST("%s: creating columnar StructSet for query: %s", func,
+              m_queryString.c_str());
+    sr = std::make_shared<StructSetImpl>(columns, fieldNameVec);
   } else {
     if (values->size() % fieldNameVec.size() != 0) {
       char exMsg[1024];
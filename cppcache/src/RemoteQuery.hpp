@@ -39,7 +39,9 @@ namespace client {
 
 class ThinClientBaseDM;
 
-class APACHE_GEODE_EXPORT RemoteQuery : public Query {
+class APACHE_GEODE_EXPORT RemoteQuery
+    : public Query,
+      public std::enable_shared_from_this<RemoteQuery> {
   std::string m_queryString;
   std::shared_ptr<RemoteQueryService> m_queryService;
   ThinClientBaseDM* m_tccdm;
@@ -62,6 +64,12 @@ class APACHE_GEODE_EXPORT RemoteQuery : public Query {
       std::chrono::milliseconds timeout =
           DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
 
+  std::shared_ptr<ResultStream> stream(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t maxBufferedResults =
+          ResultStream::DEFAULT_MAX_BUFFERED_RESULTS) override;
+
   /**
    * executes a query using a given distribution manager
    * used by Region.query() and Region.getAll()
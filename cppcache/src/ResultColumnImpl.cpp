@@ -0,0 +1,285 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ResultColumnImpl.hpp"
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/internal/DataSerializablePrimitive.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+template <class TPrimitive>
+int64_t integralValue(const std::shared_ptr<Serializable>& value) {
+  return std::dynamic_pointer_cast<TPrimitive>(value)->value();
+}
+
+template <class TPrimitive>
+double floatingPointValue(const std::shared_ptr<Serializable>& value) {
+  return std::dynamic_pointer_cast<TPrimitive>(value)->value();
+}
+
+}  // namespace
+
+ResultColumnImpl::ResultColumnImpl()
+    : m_type(Type::OBJECT),
+      m_typed(false),
+      m_code(DSCode::NullObj),
+      m_size(0) {}
+
+void ResultColumnImpl::read(DataInput& input) {
+  const auto code = static_cast<DSCode>(input.read());
+  switch (code) {
+    case DSCode::NullObj:
+      addNull();
+      break;
+    case DSCode::CacheableBoolean:
+      addIntegral(code, input.readBoolean());
+      break;
+    case DSCode::CacheableCharacter:
+      addIntegral(code, static_cast<uint16_t>(input.readInt16()));
+      break;
+    case DSCode::CacheableByte:
+      addIntegral(code, input.read());
+      break;
+    case DSCode::CacheableInt16:
+      addIntegral(code, input.readInt16());
+      break;
+    case DSCode::CacheableInt32:
+      addIntegral(code, input.readInt32());
+      break;
+    case DSCode::CacheableInt64:
+      addIntegral(code, input.readInt64());
+      break;
+    case DSCode::CacheableFloat:
+      addFloatingPoint(code, input.readFloat());
+      break;
+    case DSCode::CacheableDouble:
+      addFloatingPoint(code, input.readDouble());
+      break;
+    default: {
+      input.rewindCursor(1);
+      std::shared_ptr<Serializable> value;
+      input.readObject(value);
+      addObject(value);
+    }
+  }
+}
+
+void ResultColumnImpl::add(const std::shared_ptr<Serializable>& value) {
+  const auto primitive =
+      std::dynamic_pointer_cast<internal::DataSerializablePrimitive>(value);
+  if (primitive == nullptr) {
+    addObject(value);
+    return;
+  }
+
+  const auto code = primitive->getDsCode();
+  switch (code) {
+    case DSCode::CacheableBoolean:
+      addIntegral(code, integralValue<CacheableBoolean>(value));
+      break;
+    case DSCode::CacheableCharacter:
+      addIntegral(code, integralValue<CacheableCharacter>(value));
+      break;
+    case DSCode::CacheableByte:
+      addIntegral(code, integralValue<CacheableByte>(value));
+      break;
+    case DSCode::CacheableInt16:
+      addIntegral(code, integralValue<CacheableInt16>(value));
+      break;
+    case DSCode::CacheableInt32:
+      addIntegral(code, integralValue<CacheableInt32>(value));
+      break;
+    case DSCode::CacheableInt64:
+      addIntegral(code, integralValue<CacheableInt64>(value));
+      break;
+    case DSCode::CacheableFloat:
+      addFloatingPoint(code, floatingPointValue<CacheableFloat>(value));
+      break;
+    case DSCode::CacheableDouble:
+      addFloatingPoint(code, floatingPointValue<CacheableDouble>(value));
+      break;
+    default:
+      addObject(value);
+  }
+}
+
+void ResultColumnImpl::reserve(size_t rows) {
+  m_nulls.reserve((rows + 63) / 64);
+  if (m_type == Type::INTEGRAL) {
+    m_integralValues.reserve(rows);
+  } else if (m_type == Type::FLOATING_POINT) {
+    m_floatingPointValues.reserve(rows);
+  } else if (m_typed) {
+    m_objects.reserve(rows);
+  }
+}
+
+ResultColumn::Type ResultColumnImpl::getType() const { return m_type; }
+
+size_t ResultColumnImpl::size() const { return m_size; }
+
+bool ResultColumnImpl::isNull(size_t row) const {
+  const auto word = row / 64;
+  return word < m_nulls.size() &&
+         (m_nulls[word] & (uint64_t{1} << (row % 64))) != 0;
+}
+
+const int64_t* ResultColumnImpl::getIntegralValues() const {
+  return m_type == Type::INTEGRAL ? m_integralValues.data() : nullptr;
+}
+
+const double* ResultColumnImpl::getFloatingPointValues() const {
+  return m_type == Type::FLOATING_POINT ? m_floatingPointValues.data()
+                                        : nullptr;
+}
+
+std::shared_ptr<Serializable> ResultColumnImpl::getObject(size_t row) const {
+  if (row >= m_size) {
+    throw IllegalArgumentException("Index out of bounds");
+  }
+  if (isNull(row)) {
+    return nullptr;
+  }
+
+  switch (m_type) {
+    case Type::INTEGRAL: {
+      const auto value = m_integralValues[row];
+      switch (m_code) {
+        case DSCode::CacheableBoolean:
+          return CacheableBoolean::create(value != 0);
+        case DSCode::CacheableCharacter:
+          return CacheableCharacter::create(static_cast<char16_t>(value));
+        case DSCode::CacheableByte:
+          return CacheableByte::create(static_cast<int8_t>(value));
+        case DSCode::CacheableInt16:
+          return CacheableInt16::create(static_cast<int16_t>(value));
+        case DSCode::CacheableInt32:
+          return CacheableInt32::create(static_cast<int32_t>(value));
+        default:
+          return CacheableInt64::create(value);
+      }
+    }
+    case Type::FLOATING_POINT: {
+      const auto value = m_floatingPointValues[row];
+      if (m_code == DSCode::CacheableFloat) {
+        return CacheableFloat::create(static_cast<float>(value));
+      }
+      return CacheableDouble::create(value);
+    }
+    default:
+      return m_objects[row];
+  }
+}
+
+void ResultColumnImpl::addNull() {
+  if (m_nulls.size() <= m_size / 64) {
+    m_nulls.resize(m_size / 64 + 1);
+  }
+  m_nulls[m_size / 64] |= uint64_t{1} << (m_size % 64);
+
+  if (m_type == Type::INTEGRAL) {
+    m_integralValues.push_back(0);
+  } else if (m_type == Type::FLOATING_POINT) {
+    m_floatingPointValues.push_back(0);
+  } else if (m_typed) {
+    m_objects.push_back(nullptr);
+  }
+  ++m_size;
+}
+
+void ResultColumnImpl::addIntegral(DSCode code, int64_t value) {
+  if (!accepts(code, Type::INTEGRAL)) {
+    box();
+  }
+  if (m_type == Type::INTEGRAL) {
+    m_integralValues.push_back(value);
+    ++m_size;
+  } else {
+    // box the value through a single-row column of its own type
+    ResultColumnImpl single;
+    single.addIntegral(code, value);
+    addObject(single.getObject(0));
+  }
+}
+
+void ResultColumnImpl::addFloatingPoint(DSCode code, double value) {
+  if (!accepts(code, Type::FLOATING_POINT)) {
+    box();
+  }
+  if (m_type == Type::FLOATING_POINT) {
+    m_floatingPointValues.push_back(value);
+    ++m_size;
+  } else {
+    ResultColumnImpl single;
+    single.addFloatingPoint(code, value);
+    addObject(single.getObject(0));
+  }
+}
+
+void ResultColumnImpl::addObject(const std::shared_ptr<Serializable>& value) {
+  if (value == nullptr) {
+    addNull();
+    return;
+  }
+  if (!accepts(DSCode::NullObj, Type::OBJECT)) {
+    box();
+  }
+  m_objects.push_back(value);
+  ++m_size;
+}
+
+bool ResultColumnImpl::accepts(DSCode code, Type type) {
+  if (!m_typed) {
+    m_typed = true;
+    m_type = type;
+    m_code = code;
+    if (type == Type::INTEGRAL) {
+      m_integralValues.assign(m_size, 0);
+    } else if (type == Type::FLOATING_POINT) {
+      m_floatingPointValues.assign(m_size, 0);
+    } else {
+      m_objects.assign(m_size, nullptr);
+    }
+    return true;
+  }
+  return m_type == type && (type == Type::OBJECT || m_code == code);
+}
+
+void ResultColumnImpl::box() {
+  if (m_type == Type::OBJECT) {
+    return;
+  }
+
+  std::vector<std::shared_ptr<Serializable>> objects;
+  objects.reserve(m_size);
+  for (size_t row = 0; row < m_size; row++) {
+    objects.push_back(getObject(row));
+  }
+  m_objects.swap(objects);
+  m_integralValues = std::vector<int64_t>();
+  m_floatingPointValues = std::vector<double>();
+  m_type = Type::OBJECT;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
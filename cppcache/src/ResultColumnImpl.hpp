@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_RESULTCOLUMNIMPL_H_
+#define GEODE_RESULTCOLUMNIMPL_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <geode/DataInput.hpp>
+#include <geode/ResultColumn.hpp>
+#include <geode/internal/DSCode.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using internal::DSCode;
+
+/**
+ * A ResultColumn built one value at a time. The column stays unboxed as
+ * long as its values share one numeric or boolean type; the first value of
+ * another type turns it into a column of objects.
+ */
+class APACHE_GEODE_EXPORT ResultColumnImpl : public ResultColumn {
+ public:
+  ResultColumnImpl();
+
+  ~ResultColumnImpl() noexcept override = default;
+
+  /**
+   * Reads the next value from its serialized form. Numeric and boolean
+   * values are read straight into the column, without being boxed.
+   */
+  void read(DataInput& input);
+
+  /** Appends value, unboxing it if it is numeric or boolean. */
+  void add(const std::shared_ptr<Serializable>& value);
+
+  void reserve(size_t rows);
+
+  Type getType() const override;
+
+  size_t size() const override;
+
+  bool isNull(size_t row) const override;
+
+  const int64_t* getIntegralValues() const override;
+
+  const double* getFloatingPointValues() const override;
+
+  std::shared_ptr<Serializable> getObject(size_t row) const override;
+
+ private:
+  void addNull();
+
+  void addIntegral(DSCode code, int64_t value);
+
+  void addFloatingPoint(DSCode code, double value);
+
+  void addObject(const std::shared_ptr<Serializable>& value);
+
+  /**
+   * Returns true if a value of the given code can be stored alongside the
+   * previous ones as type, which the first non-null value decides.
+   */
+  bool accepts(DSCode code, Type type);
+
+  /** Turns the column into a column of objects. */
+  void box();
+
+  Type m_type;
+  bool m_typed;
+  DSCode m_code;
+  size_t m_size;
+  std::vector<int64_t> m_integralValues;
+  std::vector<double> m_floatingPointValues;
+  std::vector<std::shared_ptr<Serializable>> m_objects;
+  std::vector<uint64_t> m_nulls;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RESULTCOLUMNIMPL_H_
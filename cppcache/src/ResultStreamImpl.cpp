@@ -0,0 +1,258 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ResultStreamImpl.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "ResultSetImpl.hpp"
+#include "StructSetImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+ResultStreamManager::ResultStreamManager() : m_cancelled(false) {}
+
+ResultStreamManager::~ResultStreamManager() noexcept {
+  cancel();
+  join();
+}
+
+std::shared_ptr<ResultStream> ResultStreamManager::start(
+    size_t maxBufferedResults, ResultStreamImpl::Producer produce) {
+  auto stream = std::make_shared<ResultStreamImpl>(maxBufferedResults);
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_cancelled) {
+      throw CacheClosedException("ResultStream: Cache is closed");
+    }
+    joinFinished();
+
+    m_producers.emplace_back();
+    auto producer = std::prev(m_producers.end());
+    producer->m_stream = stream;
+    producer->m_finished = false;
+    producer->m_thread = std::thread([this, producer, stream, produce] {
+      try {
+        produce(stream);
+        stream->end();
+      } catch (...) {
+        stream->fail(std::current_exception());
+      }
+      std::lock_guard<std::mutex> finishedGuard(m_mutex);
+      producer->m_finished = true;
+    });
+  }
+
+  // the producer holds its own reference, so releasing the consumer's
+  // handle closes the stream and lets a blocked producer finish
+  return std::shared_ptr<ResultStream>(
+      stream.get(), [stream](ResultStream*) { stream->close(); });
+}
+
+void ResultStreamManager::cancel() {
+  std::vector<std::shared_ptr<ResultStreamImpl>> streams;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_cancelled = true;
+    for (const auto& producer : m_producers) {
+      if (auto stream = producer.m_stream.lock()) {
+        streams.push_back(stream);
+      }
+    }
+  }
+  for (const auto& stream : streams) {
+    stream->fail(std::make_exception_ptr(
+        CacheClosedException("ResultStream: Cache is closed")));
+  }
+}
+
+void ResultStreamManager::join() {
+  std::list<ProducerThread> producers;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    producers.swap(m_producers);
+  }
+  // iterators survive the swap, so producers still mark their own entry
+  for (auto& producer : producers) {
+    producer.m_thread.join();
+  }
+}
+
+void ResultStreamManager::joinFinished() {
+  for (auto producer = m_producers.begin(); producer != m_producers.end();) {
+    if (producer->m_finished) {
+      producer->m_thread.join();
+      producer = m_producers.erase(producer);
+    } else {
+      ++producer;
+    }
+  }
+}
+
+ResultStreamImpl::ResultStreamImpl(size_t maxBufferedResults)
+    : m_maxBufferedResults(std::max<size_t>(1, maxBufferedResults)),
+      m_results(CacheableVector::create()),
+      m_taken(false),
+      m_ended(false),
+      m_closed(false) {}
+
+std::shared_ptr<SelectResults> ResultStreamImpl::next(
+    std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!m_resultsAvailable.wait_for(lock, timeout, [this] {
+        return m_closed || m_ended || m_error || bufferedRows() > 0;
+      })) {
+    throw TimeoutException("ResultStream::next: no result arrived in time");
+  }
+  if (m_closed) {
+    return nullptr;
+  }
+
+  const auto rows = bufferedRows();
+  if (rows == 0) {
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+    if (!m_results->empty()) {
+      throw MessageException(
+          "ResultStream::next: Number of values coming from server has to be "
+          "exactly divisible by field count");
+    }
+    return nullptr;
+  }
+
+  // hand out whole rows only; the rest of a struct stays for the next call
+  auto results = m_results;
+  const auto values = rows * std::max<size_t>(1, m_fieldNames.size());
+  if (values == m_results->size()) {
+    m_results = CacheableVector::create();
+  } else {
+    const auto split = m_results->begin() + values;
+    results = CacheableVector::create();
+    results->assign(m_results->begin(), split);
+    m_results->erase(m_results->begin(), split);
+  }
+  m_taken = true;
+  m_spaceAvailable.notify_all();
+
+  if (m_fieldNames.empty()) {
+    return std::make_shared<ResultSetImpl>(results);
+  }
+  return std::make_shared<StructSetImpl>(results, m_fieldNames);
+}
+
+void ResultStreamImpl::close() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_closed = true;
+  m_results->clear();
+  m_resultsAvailable.notify_all();
+  m_spaceAvailable.notify_all();
+}
+
+void ResultStreamImpl::add(const std::vector<std::string>& fieldNames,
+                           const std::shared_ptr<CacheableVector>& results) {
+  if (results->empty()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!waitForSpace(lock)) {
+    return;
+  }
+  if (m_fieldNames.empty()) {
+    m_fieldNames = fieldNames;
+  }
+  m_results->insert(m_results->end(), results->begin(), results->end());
+  m_resultsAvailable.notify_all();
+}
+
+void ResultStreamImpl::add(const std::shared_ptr<Cacheable>& result) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!waitForSpace(lock)) {
+    return;
+  }
+  m_results->push_back(result);
+  m_resultsAvailable.notify_all();
+}
+
+void ResultStreamImpl::restart() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_results->clear();
+  m_fieldNames.clear();
+  if (m_taken && !m_error) {
+    m_error = std::make_exception_ptr(IllegalStateException(
+        "ResultStream: execution was retried after some of its results were "
+        "taken"));
+  }
+  m_resultsAvailable.notify_all();
+  m_spaceAvailable.notify_all();
+}
+
+void ResultStreamImpl::end() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_ended = true;
+  m_resultsAvailable.notify_all();
+}
+
+void ResultStreamImpl::fail(std::exception_ptr error) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (!m_error) {
+    m_error = error;
+  }
+  m_resultsAvailable.notify_all();
+  m_spaceAvailable.notify_all();
+}
+
+size_t ResultStreamImpl::bufferedRows() const {
+  return m_results->size() / std::max<size_t>(1, m_fieldNames.size());
+}
+
+bool ResultStreamImpl::waitForSpace(std::unique_lock<std::mutex>& lock) {
+  m_spaceAvailable.wait(lock, [this] {
+    return m_closed || m_error || bufferedRows() < m_maxBufferedResults;
+  });
+  return !m_closed && !m_error;
+}
+
+StreamingResultCollector::StreamingResultCollector(
+    std::shared_ptr<ResultStreamImpl> stream)
+    : m_stream(std::move(stream)) {}
+
+std::shared_ptr<CacheableVector> StreamingResultCollector::getResult(
+    std::chrono::milliseconds) {
+  throw UnsupportedOperationException(
+      "StreamingResultCollector::getResult: results are taken from the "
+      "ResultStream");
+}
+
+void StreamingResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& resultOfSingleExecution) {
+  m_stream->add(resultOfSingleExecution);
+}
+
+void StreamingResultCollector::endResults() {
+  // the stream ends once the execution returns
+}
+
+void StreamingResultCollector::clearResults() { m_stream->restart(); }
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,171 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_RESULTSTREAMIMPL_H_
+#define GEODE_RESULTSTREAMIMPL_H_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ResultCollector.hpp>
+#include <geode/ResultStream.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The buffer between an execution producing results on its own thread and
+ * the consumer of its ResultStream.
+ */
+class APACHE_GEODE_EXPORT ResultStreamImpl : public ResultStream {
+ public:
+  typedef std::function<void(const std::shared_ptr<ResultStreamImpl>&)>
+      Producer;
+
+  explicit ResultStreamImpl(size_t maxBufferedResults);
+
+  ~ResultStreamImpl() noexcept override = default;
+
+  std::shared_ptr<SelectResults> next(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void close() override;
+
+  /**
+   * Appends results, which are the flattened fields of structs if
+   * fieldNames is not empty. Waits while the buffer is full, so it may hold
+   * one call's results beyond its bound. Results are dropped once the
+   * stream is closed.
+   */
+  void add(const std::vector<std::string>& fieldNames,
+           const std::shared_ptr<CacheableVector>& results);
+
+  void add(const std::shared_ptr<Cacheable>& result);
+
+  /**
+   * Drops the buffered results before the execution is retried. Fails the
+   * stream if some were taken already, since they would be repeated.
+   */
+  void restart();
+
+  void end();
+
+  void fail(std::exception_ptr error);
+
+ private:
+  size_t bufferedRows() const;
+
+  bool waitForSpace(std::unique_lock<std::mutex>& lock);
+
+  const size_t m_maxBufferedResults;
+  std::mutex m_mutex;
+  std::condition_variable m_resultsAvailable;
+  std::condition_variable m_spaceAvailable;
+  std::shared_ptr<CacheableVector> m_results;
+  std::vector<std::string> m_fieldNames;
+  std::exception_ptr m_error;
+  bool m_taken;
+  bool m_ended;
+  bool m_closed;
+};
+
+/**
+ * Runs the producers of a cache's result streams and stops them when the
+ * cache closes, so none is left waiting on a stream nobody drains.
+ */
+class APACHE_GEODE_EXPORT ResultStreamManager {
+ public:
+  ResultStreamManager();
+
+  ~ResultStreamManager() noexcept;
+
+  ResultStreamManager(const ResultStreamManager&) = delete;
+  ResultStreamManager& operator=(const ResultStreamManager&) = delete;
+
+  /**
+   * Runs produce on a new thread, feeding the stream it returns. The stream
+   * ends when produce returns, or fails with whatever it throws. Throws
+   * CacheClosedException once cancel() was called.
+   */
+  std::shared_ptr<ResultStream> start(size_t maxBufferedResults,
+                                      ResultStreamImpl::Producer produce);
+
+  /**
+   * Fails every stream still being produced with CacheClosedException,
+   * which releases producers waiting for space, and refuses new streams.
+   */
+  void cancel();
+
+  /** Waits for the producers of all streams started so far to finish. */
+  void join();
+
+ private:
+  struct ProducerThread {
+    std::weak_ptr<ResultStreamImpl> m_stream;
+    std::thread m_thread;
+    bool m_finished;
+  };
+
+  void joinFinished();
+
+  std::mutex m_mutex;
+  std::list<ProducerThread> m_producers;
+  bool m_cancelled;
+};
+
+/**
+ * Feeds function results to a ResultStreamImpl as they are received.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  explicit StreamingResultCollector(std::shared_ptr<ResultStreamImpl> stream);
+
+  ~StreamingResultCollector() noexcept override = default;
+
+  /** Throws UnsupportedOperationException; the results go to the stream. */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  void clearResults() override;
+
+ private:
+  std::shared_ptr<ResultStreamImpl> m_stream;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RESULTSTREAMIMPL_H_
@@ -192,15 +192,13 @@ std::shared_ptr<Serializable> SerializationRegistry::deserialize(
       break;
   }
 
-  TypeFactoryMethod createType = nullptr;
+  const auto createType = theTypeMap.findDataSerializablePrimitive(dsCode);
 
-  theTypeMap.findDataSerializablePrimitive(dsCode, createType);
-
-  if (createType == nullptr) {
+  if (createType == nullptr || !*createType) {
     throw IllegalStateException("Unregistered type in deserialization");
   }
 
-  std::shared_ptr<Serializable> obj(createType());
+  auto obj = (*createType)();
 
   deserialize(input, obj);
 
@@ -228,16 +226,14 @@ SerializationRegistry::deserializeDataSerializableFixedId(DataInput& input,
       throw IllegalStateException("Invalid fixed ID");
   }
 
-  TypeFactoryMethod createType = nullptr;
-
-  theTypeMap.findDataSerializableFixedId(static_cast<DSFid>(fixedId),
-                                         createType);
+  const auto createType =
+      theTypeMap.findDataSerializableFixedId(static_cast<DSFid>(fixedId));
 
-  if (createType == nullptr) {
+  if (createType == nullptr || !*createType) {
     throw IllegalStateException("Unregistered type in deserialization");
   }
 
-  std::shared_ptr<Serializable> obj(createType());
+  auto obj = (*createType)();
 
   deserialize(input, obj);
 
@@ -246,17 +242,18 @@ SerializationRegistry::deserializeDataSerializableFixedId(DataInput& input,
 
 void SerializationRegistry::deserialize(
     DataInput& input, const std::shared_ptr<Serializable>& obj) const {
+  // plain casts, to spare the reference count updates of pointer casts
   if (!obj) {
     // nothing to read
-  } else if (const auto&& dataSerializableInternal =
-                 std::dynamic_pointer_cast<DataSerializableInternal>(obj)) {
+  } else if (const auto dataSerializablePrimitive =
+                 dynamic_cast<DataSerializablePrimitive*>(obj.get())) {
+    dataSerializablePrimitive->fromData(input);
+  } else if (const auto dataSerializableInternal =
+                 dynamic_cast<DataSerializableInternal*>(obj.get())) {
     dataSerializableInternal->fromData(input);
-  } else if (const auto&& dataSerializableFixedId =
-                 std::dynamic_pointer_cast<DataSerializableFixedId>(obj)) {
+  } else if (const auto dataSerializableFixedId =
+                 dynamic_cast<DataSerializableFixedId*>(obj.get())) {
     dataSerializableFixedId->fromData(input);
-  } else if (const auto&& dataSerializablePrimitive =
-                 std::dynamic_pointer_cast<DataSerializablePrimitive>(obj)) {
-    dataSerializablePrimitive->fromData(input);
   } else {
     throw UnsupportedOperationException("Serialization type not implemented.");
   }
@@ -367,49 +364,14 @@ std::shared_ptr<Serializable> SerializationRegistry::GetEnum(
 }
 
 void TheTypeMap::clear() {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableMapLock);
-  m_dataSerializableMap.clear();
+  m_dataSerializables.clear();
+  m_dataSerializableFixedIds.clear();
 
-  std::lock_guard<util::concurrent::spinlock_mutex> guard2(
-      m_dataSerializableFixedIdMapLock);
-  m_dataSerializableFixedIdMap.clear();
-
-  std::lock_guard<util::concurrent::spinlock_mutex> guard3(
+  std::lock_guard<util::concurrent::spinlock_mutex> guard(
       m_pdxSerializableMapLock);
   m_pdxSerializableMap.clear();
 }
 
-void TheTypeMap::findDataSerializable(int32_t id,
-                                      TypeFactoryMethod& func) const {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableMapLock);
-  const auto& found = m_dataSerializableMap.find(id);
-  if (found != m_dataSerializableMap.end()) {
-    func = found->second;
-  }
-}
-
-void TheTypeMap::findDataSerializableFixedId(DSFid dsfid,
-                                             TypeFactoryMethod& func) const {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableFixedIdMapLock);
-  const auto& found = m_dataSerializableFixedIdMap.find(dsfid);
-  if (found != m_dataSerializableFixedIdMap.end()) {
-    func = found->second;
-  }
-}
-
-void TheTypeMap::findDataSerializablePrimitive(DSCode dsCode,
-                                               TypeFactoryMethod& func) const {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializablePrimitiveMapLock);
-  const auto& found = m_dataSerializablePrimitiveMap.find(dsCode);
-  if (found != m_dataSerializablePrimitiveMap.end()) {
-    func = found->second;
-  }
-}
-
 void TheTypeMap::bindDataSerializable(TypeFactoryMethod func, int32_t id) {
   auto obj = func();
 
@@ -421,33 +383,23 @@ void TheTypeMap::bindDataSerializable(TypeFactoryMethod func, int32_t id) {
         "TheTypeMap::bind: Serialization type not implemented.");
   }
 
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableMapLock);
-  const auto& result = m_dataSerializableMap.emplace(id, func);
-  if (!result.second) {
+  if (!m_dataSerializables.bind(id, std::move(func))) {
     LOGERROR("A class with ID %d is already registered.", id);
     throw IllegalStateException("A class with given ID is already registered.");
   }
 }
 
 void TheTypeMap::rebindDataSerializable(int32_t id, TypeFactoryMethod func) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableMapLock);
-  m_dataSerializableMap[id] = func;
+  m_dataSerializables.rebind(id, std::move(func));
 }
 
 void TheTypeMap::unbindDataSerializable(int32_t id) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableMapLock);
-  m_dataSerializableMap.erase(id);
+  m_dataSerializables.unbind(id);
 }
 
 void TheTypeMap::bindDataSerializablePrimitive(TypeFactoryMethod func,
                                                DSCode dsCode) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializablePrimitiveMapLock);
-  const auto& result = m_dataSerializablePrimitiveMap.emplace(dsCode, func);
-  if (!result.second) {
+  if (!m_dataSerializablePrimitives.bind(dsCode, std::move(func))) {
     LOGERROR("A class with DSCode %d is already registered.", dsCode);
     throw IllegalStateException(
         "A class with given DSCode is already registered.");
@@ -456,9 +408,7 @@ void TheTypeMap::bindDataSerializablePrimitive(TypeFactoryMethod func,
 
 void TheTypeMap::rebindDataSerializablePrimitive(DSCode dsCode,
                                                  TypeFactoryMethod func) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializablePrimitiveMapLock);
-  m_dataSerializablePrimitiveMap[dsCode] = func;
+  m_dataSerializablePrimitives.rebind(dsCode, std::move(func));
 }
 
 void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
@@ -474,10 +424,7 @@ void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
         "type.");
   }
 
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableFixedIdMapLock);
-  const auto& result = m_dataSerializableFixedIdMap.emplace(id, func);
-  if (!result.second) {
+  if (!m_dataSerializableFixedIds.bind(id, std::move(func))) {
     LOGERROR("A fixed class with ID %d is already registered.", id);
     throw IllegalStateException(
         "A fixed class with given ID is already registered.");
@@ -486,15 +433,11 @@ void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
 
 void TheTypeMap::rebindDataSerializableFixedId(internal::DSFid id,
                                                TypeFactoryMethod func) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableFixedIdMapLock);
-  m_dataSerializableFixedIdMap[id] = func;
+  m_dataSerializableFixedIds.rebind(id, std::move(func));
 }
 
 void TheTypeMap::unbindDataSerializableFixedId(internal::DSFid id) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(
-      m_dataSerializableFixedIdMapLock);
-  m_dataSerializableFixedIdMap.erase(id);
+  m_dataSerializableFixedIds.unbind(id);
 }
 
 void TheTypeMap::bindPdxSerializable(TypeFactoryMethodPdx func) {
@@ -41,6 +41,7 @@
 
 #include "MemberListForVersionStamp.hpp"
 #include "NonCopyable.hpp"
+#include "TypeDispatchTable.hpp"
 #include "config.h"
 #include "util/concurrent/spinlock_mutex.hpp"
 
@@ -75,15 +76,12 @@ using internal::DataSerializablePrimitive;
 
 class TheTypeMap : private NonCopyable {
  private:
-  std::unordered_map<internal::DSCode, TypeFactoryMethod>
-      m_dataSerializablePrimitiveMap;
-  std::unordered_map<int32_t, TypeFactoryMethod> m_dataSerializableMap;
-  std::unordered_map<internal::DSFid, TypeFactoryMethod>
-      m_dataSerializableFixedIdMap;
+  // builtin types are all in the dense part of the tables; so are user types
+  // with one byte ids, the common case
+  TypeDispatchTable<DSCode, 0, 128> m_dataSerializablePrimitives;
+  TypeDispatchTable<int32_t, -128, 128> m_dataSerializables;
+  TypeDispatchTable<internal::DSFid, -128, 128> m_dataSerializableFixedIds;
   std::unordered_map<std::string, TypeFactoryMethodPdx> m_pdxSerializableMap;
-  mutable util::concurrent::spinlock_mutex m_dataSerializablePrimitiveMapLock;
-  mutable util::concurrent::spinlock_mutex m_dataSerializableMapLock;
-  mutable util::concurrent::spinlock_mutex m_dataSerializableFixedIdMapLock;
   mutable util::concurrent::spinlock_mutex m_pdxSerializableMapLock;
 
  public:
@@ -98,7 +96,9 @@ class TheTypeMap : private NonCopyable {
 
   void clear();
 
-  void findDataSerializable(int32_t id, TypeFactoryMethod& func) const;
+  inline const TypeFactoryMethod* findDataSerializable(int32_t id) const {
+    return m_dataSerializables.find(id);
+  }
 
   void bindDataSerializable(TypeFactoryMethod func, int32_t id);
 
@@ -106,8 +106,10 @@ class TheTypeMap : private NonCopyable {
 
   void unbindDataSerializable(int32_t id);
 
-  void findDataSerializableFixedId(internal::DSFid id,
-                                   TypeFactoryMethod& func) const;
+  inline const TypeFactoryMethod* findDataSerializableFixedId(
+      internal::DSFid id) const {
+    return m_dataSerializableFixedIds.find(id);
+  }
 
   void bindDataSerializableFixedId(TypeFactoryMethod func);
 
@@ -126,8 +128,10 @@ class TheTypeMap : private NonCopyable {
   void rebindPdxSerializable(std::string objFullName,
                              TypeFactoryMethodPdx func);
 
-  void findDataSerializablePrimitive(DSCode dsCode,
-                                     TypeFactoryMethod& func) const;
+  inline const TypeFactoryMethod* findDataSerializablePrimitive(
+      DSCode dsCode) const {
+    return m_dataSerializablePrimitives.find(dsCode);
+  }
 
   void bindDataSerializablePrimitive(TypeFactoryMethod func, DSCode id);
 
@@ -277,9 +281,8 @@ class APACHE_GEODE_EXPORT SerializationRegistry {
   }
 
   TypeFactoryMethod getDataSerializableCreationMethod(int32_t objectId) {
-    TypeFactoryMethod createType;
-    theTypeMap.findDataSerializable(objectId, createType);
-    return createType;
+    const auto createType = theTypeMap.findDataSerializable(objectId);
+    return createType ? *createType : TypeFactoryMethod();
   }
 
   int32_t getIdForDataSerializableType(std::type_index objectType) const {
@@ -0,0 +1,97 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SerializedCacheable.hpp"
+
+#include <cstring>
+
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "CacheImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+SerializedCacheable::SerializedCacheable(std::unique_ptr<uint8_t[]> bytes,
+                                         size_t length)
+    : m_bytes(std::move(bytes)), m_length(length) {}
+
+std::shared_ptr<SerializedCacheable> SerializedCacheable::read(
+    DataInput& input, size_t length) {
+  std::unique_ptr<uint8_t[]> bytes(new uint8_t[length]);
+  input.readBytesOnly(bytes.get(), length);
+  return std::make_shared<SerializedCacheable>(std::move(bytes), length);
+}
+
+std::shared_ptr<SerializedCacheable> SerializedCacheable::create(
+    const std::shared_ptr<Cacheable>& value, const CacheImpl& cache,
+    Pool* pool) {
+  auto output = cache.createDataOutput(pool);
+  output.writeObject(value);
+
+  const auto length = output.getBufferLength();
+  std::unique_ptr<uint8_t[]> bytes(new uint8_t[length]);
+  std::memcpy(bytes.get(), output.getBuffer(), length);
+  auto serialized =
+      std::make_shared<SerializedCacheable>(std::move(bytes), length);
+  serialized->m_deserialized = value;
+  return serialized;
+}
+
+std::shared_ptr<Cacheable> SerializedCacheable::deserialize(
+    const CacheImpl& cache, Pool* pool) const {
+  {
+    std::lock_guard<util::concurrent::spinlock_mutex> guard(
+        m_deserializedLock);
+    if (auto value = m_deserialized.lock()) {
+      return value;
+    }
+  }
+
+  auto input = cache.createDataInput(m_bytes.get(), m_length, pool);
+  std::shared_ptr<Cacheable> value;
+  input.readObject(value);
+
+  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_deserializedLock);
+  m_deserialized = value;
+  return value;
+}
+
+void SerializedCacheable::toData(DataOutput& output) const {
+  output.writeBytesOnly(m_bytes.get(), m_length);
+}
+
+void SerializedCacheable::fromData(DataInput&) {
+  throw UnsupportedOperationException(
+      "SerializedCacheable::fromData: serialized values are created with "
+      "SerializedCacheable::read");
+}
+
+std::string SerializedCacheable::toString() const {
+  return "SerializedCacheable(" + std::to_string(m_length) + " bytes)";
+}
+
+size_t SerializedCacheable::objectSize() const {
+  return sizeof(SerializedCacheable) + m_length;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
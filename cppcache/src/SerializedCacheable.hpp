@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SERIALIZEDCACHEABLE_H_
+#define GEODE_SERIALIZEDCACHEABLE_H_
+
+#include <memory>
+#include <mutex>
+
+#include <geode/Serializable.hpp>
+#include <geode/internal/DataSerializableInternal.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class DataInput;
+class DataOutput;
+class Pool;
+
+/**
+ * Holds a cached value in its serialized form for regions that have
+ * RegionAttributes::getStoreSerializedValues() set. The bytes, including
+ * the leading type code, are kept in a single exact-size block and are
+ * written back out unchanged, so a stored value can be sent to the server
+ * without being deserialized first.
+ *
+ * The value is deserialized on demand. The resulting object is remembered
+ * only for as long as somebody else holds a reference to it, so repeated
+ * reads share one instance without the entry keeping the object graph
+ * alive.
+ */
+class SerializedCacheable : public internal::DataSerializableInternal {
+ public:
+  SerializedCacheable(std::unique_ptr<uint8_t[]> bytes, size_t length);
+
+  ~SerializedCacheable() noexcept override = default;
+
+  /**
+   * Reads length bytes of an already serialized object from input without
+   * deserializing them.
+   */
+  static std::shared_ptr<SerializedCacheable> read(DataInput& input,
+                                                   size_t length);
+
+  /** Serializes value, remembering value as its deserialized form. */
+  static std::shared_ptr<SerializedCacheable> create(
+      const std::shared_ptr<Cacheable>& value, const CacheImpl& cache,
+      Pool* pool);
+
+  /** Returns the deserialized object, deserializing it if needed. */
+  std::shared_ptr<Cacheable> deserialize(const CacheImpl& cache,
+                                         Pool* pool) const;
+
+  inline const uint8_t* data() const { return m_bytes.get(); }
+
+  inline size_t length() const { return m_length; }
+
+  void toData(DataOutput& output) const override;
+
+  void fromData(DataInput& input) override;
+
+  std::string toString() const override;
+
+  size_t objectSize() const override;
+
+ private:
+  const std::unique_ptr<uint8_t[]> m_bytes;
+  const size_t m_length;
+  mutable std::weak_ptr<Cacheable> m_deserialized;
+  mutable util::concurrent::spinlock_mutex m_deserializedLock;
+
+  SerializedCacheable(const SerializedCacheable&) = delete;
+  SerializedCacheable& operator=(const SerializedCacheable&) = delete;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SERIALIZEDCACHEABLE_H_
@@ -27,7 +27,8 @@ namespace geode {
 namespace client {
 
 StructSetImpl::StructSetImpl(const std::shared_ptr<CacheableVector>& response,
-                             const std::vector<std::string>& fieldNames) {
+                             const std::vector<std::string>& fieldNames)
+    : m_rows(0) {
   int32_t i = 0;
   for (auto&& fieldName : fieldNames) {
     LOGDEBUG("StructSetImpl: pushing fieldName = %s with index = %d",
@@ -47,17 +48,32 @@ StructSetImpl::StructSetImpl(const std::shared_ptr<CacheableVector>& response,
     }
     m_structVector.push_back(std::make_shared<Struct>(this, tmpVec));
   }
+  m_rows = m_structVector.size();
 }
 
-size_t StructSetImpl::size() const { return m_structVector.size(); }
+StructSetImpl::StructSetImpl(
+    std::vector<std::shared_ptr<ResultColumnImpl>> columns,
+    const std::vector<std::string>& fieldNames)
+    : m_columns(std::move(columns)),
+      m_rows(m_columns.empty() ? 0 : m_columns.front()->size()) {
+  int32_t i = 0;
+  for (auto&& fieldName : fieldNames) {
+    m_fieldNameIndexMap.emplace(fieldName, i++);
+  }
+}
+
+size_t StructSetImpl::size() const { return m_rows; }
 
 const std::shared_ptr<Serializable> StructSetImpl::operator[](
     size_t index) const {
-  if (index >= m_structVector.size()) {
+  if (index >= m_rows) {
     throw IllegalArgumentException("Index out of bounds");
   }
 
-  return m_structVector.operator[](index);
+  if (index < m_structVector.size()) {
+    return m_structVector.operator[](index);
+  }
+  return createStruct(index);
 }
 
 int32_t StructSetImpl::getFieldIndex(const std::string& fieldname) {
@@ -77,11 +93,49 @@ const std::string& StructSetImpl::getFieldName(int32_t index) {
   throw std::out_of_range("Struct: fieldName not found.");
 }
 
+std::shared_ptr<ResultColumn> StructSetImpl::getColumn(int32_t index) {
+  if (index < 0 || static_cast<size_t>(index) >= m_fieldNameIndexMap.size()) {
+    throw std::out_of_range("StructSet: column not found.");
+  }
+  if (!m_columns.empty()) {
+    return m_columns[index];
+  }
+
+  auto column = std::make_shared<ResultColumnImpl>();
+  for (const auto& row : m_structVector) {
+    column->add((*std::dynamic_pointer_cast<Struct>(row))[index]);
+  }
+  return column;
+}
+
 SelectResults::iterator StructSetImpl::begin() {
+  createStructs();
   return m_structVector.begin();
 }
 
-SelectResults::iterator StructSetImpl::end() { return m_structVector.end(); }
+SelectResults::iterator StructSetImpl::end() {
+  createStructs();
+  return m_structVector.end();
+}
+
+std::shared_ptr<Struct> StructSetImpl::createStruct(size_t row) const {
+  std::vector<std::shared_ptr<Serializable>> values;
+  values.reserve(m_columns.size());
+  for (const auto& column : m_columns) {
+    values.push_back(column->getObject(row));
+  }
+  return std::make_shared<Struct>(const_cast<StructSetImpl*>(this), values);
+}
+
+void StructSetImpl::createStructs() {
+  if (m_structVector.size() == m_rows) {
+    return;
+  }
+  m_structVector.reserve(m_rows);
+  for (auto row = m_structVector.size(); row < m_rows; row++) {
+    m_structVector.push_back(createStruct(row));
+  }
+}
 
 }  // namespace client
 }  // namespace geode
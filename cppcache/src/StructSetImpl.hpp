@@ -23,12 +23,15 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <geode/CacheableBuiltins.hpp>
 #include <geode/Struct.hpp>
 #include <geode/StructSet.hpp>
 #include <geode/internal/geode_globals.hpp>
 
+#include "ResultColumnImpl.hpp"
+
 namespace apache {
 namespace geode {
 namespace client {
@@ -38,6 +41,14 @@ class APACHE_GEODE_EXPORT StructSetImpl : public StructSet {
   StructSetImpl(const std::shared_ptr<CacheableVector>& values,
                 const std::vector<std::string>& fieldNames);
 
+  /**
+   * Creates a StructSet over one column per field, all of the same size.
+   * Structs are built only when rows are accessed; iterating builds all of
+   * them.
+   */
+  StructSetImpl(std::vector<std::shared_ptr<ResultColumnImpl>> columns,
+                const std::vector<std::string>& fieldNames);
+
   ~StructSetImpl() noexcept override = default;
 
   size_t size() const override;
@@ -48,13 +59,22 @@ class APACHE_GEODE_EXPORT StructSetImpl : public StructSet {
 
   const std::string& getFieldName(int32_t index) override;
 
+  std::shared_ptr<ResultColumn> getColumn(int32_t index) override;
+
   SelectResults::iterator begin() override;
 
   SelectResults::iterator end() override;
 
  private:
+  std::shared_ptr<Struct> createStruct(size_t row) const;
+
+  void createStructs();
+
   std::vector<std::shared_ptr<Serializable>> m_structVector;
 
+  std::vector<std::shared_ptr<ResultColumnImpl>> m_columns;
+  size_t m_rows;
+
   std::unordered_map<std::string, int32_t> m_fieldNameIndexMap;
 };
 
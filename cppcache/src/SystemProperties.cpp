@@ -48,11 +48,15 @@ const char ConnectionPoolSize[] = "connection-pool-size";
 const char CacheXMLFile[] = "cache-xml-file";
 const char LogFileSizeLimit[] = "log-file-size-limit";
 const char LogDiskSpaceLimit[] = "log-disk-space-limit";
+const char LogAsync[] = "log-async";
+const char LogAsyncQueueSize[] = "log-async-queue-size";
+const char LogAsyncBlockWhenFull[] = "log-async-block-when-full";
 const char StatsFileSizeLimit[] = "archive-file-size-limit";
 const char StatsDiskSpaceLimit[] = "archive-disk-space-limit";
 const char HeapLRULimit[] = "heap-lru-limit";
 const char HeapLRUDelta[] = "heap-lru-delta";
 const char MaxSocketBufferSize[] = "max-socket-buffer-size";
+const char MessageCompressionThreshold[] = "message-compression-threshold";
 const char PingInterval[] = "ping-interval";
 const char RedundancyMonitorInterval[] = "redundancy-monitor-interval";
 const char DisableShufflingEndpoint[] = "disable-shuffling-of-endpoints";
@@ -78,6 +82,7 @@ const char EnableChunkHandlerThread[] = "enable-chunk-handler-thread";
 const char OnClientDisconnectClearPdxTypeIds[] =
     "on-client-disconnect-clear-pdxType-Ids";
 const char TombstoneTimeoutInMSec[] = "tombstone-timeout";
+const char QueryColumnarResults[] = "query-columnar-results";
 const char DefaultConflateEvents[] = "server";
 
 const char DefaultDurableClientId[] = "";
@@ -109,6 +114,9 @@ const char DefaultName[] = "";
 const char DefaultCacheXMLFile[] = "";
 const uint32_t DefaultLogFileSizeLimit = 0;     // = unlimited
 const uint32_t DefaultLogDiskSpaceLimit = 0;    // = unlimited
+const bool DefaultLogAsync = false;
+const uint32_t DefaultLogAsyncQueueSize = 8192;
+const bool DefaultLogAsyncBlockWhenFull = false;
 const uint32_t DefaultStatsFileSizeLimit = 0;   // = unlimited
 const uint32_t DefaultStatsDiskSpaceLimit = 0;  // = unlimited
 
@@ -116,6 +124,7 @@ const size_t DefaultHeapLRULimit = 0;    // = unlimited, disabled when it is 0
 const int32_t DefaultHeapLRUDelta = 10;  // = unlimited, disabled when it is 0
 
 const int32_t DefaultMaxSocketBufferSize = 65 * 1024;
+const int32_t DefaultMessageCompressionThreshold = 0;  // = disabled
 constexpr auto DefaultPingInterval = std::chrono::seconds(10);
 constexpr auto DefaultRedundancyMonitorInterval = std::chrono::seconds(10);
 constexpr auto DefaultNotifyAckInterval = std::chrono::seconds(1);
@@ -127,6 +136,7 @@ constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
 const bool DefaultEnableChunkHandlerThread = false;
 const bool DefaultOnClientDisconnectClearPdxTypeIds = false;
+const bool DefaultQueryColumnarResults = false;
 
 }  // namespace
 
@@ -154,12 +164,16 @@ SystemProperties::SystemProperties(
       m_cacheXMLFile(DefaultCacheXMLFile),
       m_logFileSizeLimit(DefaultLogFileSizeLimit),
       m_logDiskSpaceLimit(DefaultLogDiskSpaceLimit),
+      m_logAsync(DefaultLogAsync),
+      m_logAsyncQueueSize(DefaultLogAsyncQueueSize),
+      m_logAsyncBlockWhenFull(DefaultLogAsyncBlockWhenFull),
       m_statsFileSizeLimit(DefaultStatsFileSizeLimit),
       m_statsDiskSpaceLimit(DefaultStatsDiskSpaceLimit),
       m_connectionPoolSize(DefaultConnectionPoolSize),
       m_heapLRULimit(DefaultHeapLRULimit),
       m_heapLRUDelta(DefaultHeapLRUDelta),
       m_maxSocketBufferSize(DefaultMaxSocketBufferSize),
+      m_messageCompressionThreshold(DefaultMessageCompressionThreshold),
       m_pingInterval(DefaultPingInterval),
       m_redundancyMonitorInterval(DefaultRedundancyMonitorInterval),
       m_notifyAckInterval(DefaultNotifyAckInterval),
@@ -183,7 +197,8 @@ SystemProperties::SystemProperties(
       m_tombstoneTimeout(DefaultTombstoneTimeout),
       m_enableChunkHandlerThread(DefaultEnableChunkHandlerThread),
       m_onClientDisconnectClearPdxTypeIds(
-          DefaultOnClientDisconnectClearPdxTypeIds) {
+          DefaultOnClientDisconnectClearPdxTypeIds),
+      m_queryColumnarResults(DefaultQueryColumnarResults) {
   // now that defaults are set, consume files and override the defaults.
   class ProcessPropsVisitor : public Properties::Visitor {
     SystemProperties* m_sysProps;
@@ -280,6 +295,8 @@ void SystemProperties::processProperty(const std::string& property,
     m_threadPoolSize = std::stoul(value);
   } else if (property == MaxSocketBufferSize) {
     m_maxSocketBufferSize = std::stol(value);
+  } else if (property == MessageCompressionThreshold) {
+    m_messageCompressionThreshold = std::stol(value);
   } else if (property == PingInterval) {
     parseDurationProperty(property, std::string(value), m_pingInterval);
   } else if (property == RedundancyMonitorInterval) {
@@ -341,6 +358,12 @@ void SystemProperties::processProperty(const std::string& property,
     m_logFileSizeLimit = std::stol(value);
   } else if (property == LogDiskSpaceLimit) {
     m_logDiskSpaceLimit = std::stol(value);
+  } else if (property == LogAsync) {
+    m_logAsync = parseBooleanProperty(property, value);
+  } else if (property == LogAsyncQueueSize) {
+    m_logAsyncQueueSize = std::stol(value);
+  } else if (property == LogAsyncBlockWhenFull) {
+    m_logAsyncBlockWhenFull = parseBooleanProperty(property, value);
   } else if (property == StatsFileSizeLimit) {
     m_statsFileSizeLimit = std::stol(value);
   } else if (property == StatsDiskSpaceLimit) {
@@ -357,6 +380,8 @@ void SystemProperties::processProperty(const std::string& property,
     m_enableChunkHandlerThread = parseBooleanProperty(property, value);
   } else if (property == OnClientDisconnectClearPdxTypeIds) {
     m_onClientDisconnectClearPdxTypeIds = parseBooleanProperty(property, value);
+  } else if (property == QueryColumnarResults) {
+    m_queryColumnarResults = parseBooleanProperty(property, value);
   } else {
     throwError("SystemProperties: unknown property: " + property + "=" + value);
   }
@@ -419,6 +444,15 @@ void SystemProperties::logSettings() {
   settings += "\n  heap-lru-limit = ";
   settings += std::to_string(heapLRULimit());
 
+  settings += "\n  log-async = ";
+  settings += logAsync() ? "true" : "false";
+
+  settings += "\n  log-async-block-when-full = ";
+  settings += logAsyncBlockWhenFull() ? "true" : "false";
+
+  settings += "\n  log-async-queue-size = ";
+  settings += std::to_string(logAsyncQueueSize());
+
   settings += "\n  log-disk-space-limit = ";
   settings += std::to_string(logDiskSpaceLimit());
 
@@ -437,6 +471,9 @@ void SystemProperties::logSettings() {
   settings += "\n  max-socket-buffer-size = ";
   settings += std::to_string(maxSocketBufferSize());
 
+  settings += "\n  message-compression-threshold = ";
+  settings += std::to_string(messageCompressionThreshold());
+
   settings += "\n  notify-ack-interval = ";
   settings += to_string(notifyAckInterval());
 
@@ -451,6 +488,9 @@ void SystemProperties::logSettings() {
   settings += "\n  ping-interval = ";
   settings += to_string(pingInterval());
 
+  settings += "\n  query-columnar-results = ";
+  settings += queryColumnarResults() ? "true" : "false";
+
   settings += "\n  redundancy-monitor-interval = ";
   settings += to_string(redundancyMonitorInterval());
 
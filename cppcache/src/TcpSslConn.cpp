@@ -197,6 +197,12 @@ size_t TcpSslConn::socketOp(TcpConn::SockOp op, char* buff, size_t len,
   }
 }
 
+bool TcpSslConn::isSessionReused() {
+  GF_DEV_ASSERT(m_ssl != nullptr);
+
+  return m_ssl->isSessionReused();
+}
+
 uint16_t TcpSslConn::getPort() {
   GF_DEV_ASSERT(m_ssl != nullptr);
 
@@ -97,6 +97,9 @@ class TcpSslConn : public TcpConn {
   }
 
   uint16_t getPort() override;
+
+  // true if the TLS handshake resumed a cached session
+  bool isSessionReused();
 };
 }  // namespace client
 }  // namespace geode
@@ -26,6 +26,7 @@
 #include <ace/Semaphore.h>
 
 #include "AppDomainContext.hpp"
+#include "ReceiveBufferPool.hpp"
 #include "Utils.hpp"
 
 namespace apache {
@@ -68,6 +69,13 @@ class TcrChunkedResult {
    */
   virtual void reset() = 0;
 
+  /**
+   * Streaming results may block in handleChunk until their consumer catches
+   * up, so their chunks are handled on the thread reading them: blocking it
+   * stops reading from the socket instead of filling the chunk queue.
+   */
+  virtual bool isStreaming() const { return false; }
+
   void fireHandleChunk(const uint8_t* bytes, int32_t len,
                        uint8_t isLastChunkWithSecurity,
                        const CacheImpl* cacheImpl) {
@@ -136,12 +144,14 @@ class TcrChunkedContext {
         m_cache(cacheImpl),
         m_result(result) {}
 
-  inline ~TcrChunkedContext() { _GEODE_SAFE_DELETE_ARRAY(m_bytes); }
+  inline ~TcrChunkedContext() { ReceiveBufferPool::release(m_bytes); }
 
   inline const uint8_t* getBytes() const { return m_bytes; }
 
   inline int32_t getLen() const { return m_len; }
 
+  inline bool isStreaming() const { return m_result->isStreaming(); }
+
   void handleChunk(bool inSameThread) {
     if (m_bytes == nullptr) {
       // this is the last chunk for some set of chunks
@@ -29,6 +29,8 @@
 #include "Connector.hpp"
 #include "DiffieHellman.hpp"
 #include "DistributedSystemImpl.hpp"
+#include "MessageCompressor.hpp"
+#include "ReceiveBufferPool.hpp"
 #include "TcpSslConn.hpp"
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
@@ -43,6 +45,10 @@ namespace client {
 
 const int HEADER_LENGTH = 17;
 const int64_t INITIAL_CONNECTION_ID = 26739;
+// the client offers compression in its overrides byte and the server accepts
+// it in the byte that says whether delta propagation is enabled
+const uint8_t COMPRESSION_OFFERED = 0x04;
+const uint8_t COMPRESSION_ACCEPTED = 0x02;
 
 #define throwException(ex)                            \
   {                                                   \
@@ -186,7 +192,7 @@ bool TcrConnection::InitTcrConnection(
   std::shared_ptr<Properties> credentials;
   std::shared_ptr<CacheableBytes> serverChallenge;
 
-  // Write overrides (just conflation for now)
+  // Write overrides (conflation and compression)
   handShakeMsg.write(getOverrides(&sysProp));
 
   bool tmpIsSecurityOn = nullptr != cacheImpl->getAuthInitialize();
@@ -469,9 +475,16 @@ bool TcrConnection::InitTcrConnection(
 
     if (!isClientNotification) {
       auto deltaEnabledMsg = readHandshakeData(1, connectTimeout);
-      auto di = m_connectionManager->getCacheImpl()->createDataInput(
-          reinterpret_cast<const uint8_t*>(deltaEnabledMsg.data()), 1);
-      ThinClientBaseDM::setDeltaEnabledOnServer(di.readBoolean());
+      auto deltaEnabled = static_cast<uint8_t>(deltaEnabledMsg[0]);
+      const auto compressionThreshold = sysProp.messageCompressionThreshold();
+      if (compressionThreshold > 0 && (deltaEnabled & COMPRESSION_ACCEPTED)) {
+        deltaEnabled &= ~COMPRESSION_ACCEPTED;
+        m_compressionThreshold = static_cast<size_t>(compressionThreshold);
+        LOGFINE(
+            "Handshake: server %s accepted compression of parts from %d bytes",
+            m_endpoint, compressionThreshold);
+      }
+      ThinClientBaseDM::setDeltaEnabledOnServer(deltaEnabled == 1);
     }
 
     switch (acceptanceCode[0]) {
@@ -566,17 +579,26 @@ Connector* TcrConnection::createConnection(
   auto& systemProperties = m_connectionManager->getCacheImpl()
                                ->getDistributedSystem()
                                .getSystemProperties();
+  TcpSslConn* sslSocket = nullptr;
   if (systemProperties.sslEnabled()) {
-    socket = new TcpSslConn(endpoint, connectTimeout, maxBuffSizePool,
-                            systemProperties.sslKeystorePassword().c_str(),
-                            systemProperties.sslTrustStore().c_str(),
-                            systemProperties.sslKeyStore().c_str());
+    socket = sslSocket =
+        new TcpSslConn(endpoint, connectTimeout, maxBuffSizePool,
+                       systemProperties.sslKeystorePassword().c_str(),
+                       systemProperties.sslTrustStore().c_str(),
+                       systemProperties.sslKeyStore().c_str());
   } else {
     socket = new TcpConn(endpoint, connectTimeout, maxBuffSizePool);
   }
   // as socket.init() calls throws exception...
   m_conn = socket;
   socket->init();
+  if (sslSocket && m_poolDM) {
+    if (sslSocket->isSessionReused()) {
+      m_poolDM->getStats().incSslResumedHandshakes();
+    } else {
+      m_poolDM->getStats().incSslFullHandshakes();
+    }
+  }
   return socket;
 }
 
@@ -765,6 +787,11 @@ void TcrConnection::send(std::chrono::microseconds& timeSpent,
                          std::chrono::microseconds sendTimeoutSec, bool) {
   GF_DEV_ASSERT(m_conn != nullptr);
 
+  std::vector<char> compressed;
+  if (m_compressionThreshold > 0) {
+    compressRequest(buffer, len, compressed);
+  }
+
   // LOGINFO("TcrConnection::send: [%p] sending request to endpoint %s;",
   //:  this, m_endpoint);
 
@@ -858,19 +885,19 @@ char* TcrConnection::readMessage(size_t* recvLen,
   msgLen = input.readInt32();
   //  check that message length is valid.
   if (!(msgLen > 0) && request == TcrMessage::GET_CLIENT_PR_METADATA) {
-    char* fullMessage;
     *recvLen = HEADER_LENGTH + msgLen;
-    _GEODE_NEW(fullMessage, char[HEADER_LENGTH + msgLen]);
+    auto fullMessage = reinterpret_cast<char*>(
+        ReceiveBufferPool::allocate(HEADER_LENGTH + msgLen));
     std::memcpy(fullMessage, msg_header, HEADER_LENGTH);
     return fullMessage;
     // exit(0);
   }
   // GF_DEV_ASSERT(msgLen > 0);
 
-  // user has to delete this pointer
-  char* fullMessage;
+  // user has to release this buffer to the ReceiveBufferPool
   *recvLen = HEADER_LENGTH + msgLen;
-  _GEODE_NEW(fullMessage, char[HEADER_LENGTH + msgLen]);
+  auto fullMessage = reinterpret_cast<char*>(
+      ReceiveBufferPool::allocate(HEADER_LENGTH + msgLen));
   std::memcpy(fullMessage, msg_header, HEADER_LENGTH);
 
   std::chrono::microseconds mesgBodyTimeout = receiveTimeoutSec;
@@ -880,7 +907,7 @@ char* TcrConnection::readMessage(size_t* recvLen,
   error = receiveData(fullMessage + HEADER_LENGTH, msgLen, mesgBodyTimeout,
                       true, isNotificationMessage);
   if (error != CONN_NOERR) {
-    delete[] fullMessage;
+    ReceiveBufferPool::release(fullMessage);
     //  the !isNotificationMessage ensures that notification channel
     // gets the GeodeIOException and not TimeoutException;
     // this is required since header has already been read meaning there could
@@ -907,6 +934,11 @@ char* TcrConnection::readMessage(size_t* recvLen,
       m_endpoint,
       Utils::convertBytesToString(fullMessage + HEADER_LENGTH, msgLen).c_str());
 
+  if (m_compressionThreshold > 0) {
+    fullMessage = reinterpret_cast<char*>(expandReply(
+        reinterpret_cast<uint8_t*>(fullMessage), HEADER_LENGTH, *recvLen));
+  }
+
   return fullMessage;
 }
 
@@ -1021,12 +1053,11 @@ void TcrConnection::readMessageChunked(
     GF_DEV_ASSERT(chunkLen > 0);
     isLastChunk = input.read();
 
-    uint8_t* chunk_body;
-    _GEODE_NEW(chunk_body, uint8_t[chunkLen]);
+    auto chunk_body = ReceiveBufferPool::allocate(chunkLen);
     error = receiveData(reinterpret_cast<char*>(chunk_body), chunkLen,
                         receiveTimeoutSec, true, false);
     if (error != CONN_NOERR) {
-      delete[] chunk_body;
+      ReceiveBufferPool::release(chunk_body);
       if (error & CONN_TIMEOUT) {
         throwException(TimeoutException(
             "TcrConnection::readMessageChunked: "
@@ -1043,6 +1074,12 @@ void TcrConnection::readMessageChunked(
         "from endpoint %s; bytes: %s",
         chunkNum, m_endpoint,
         Utils::convertBytesToString(chunk_body, chunkLen).c_str());
+    if (m_compressionThreshold > 0) {
+      size_t length = static_cast<size_t>(chunkLen);
+      chunk_body = expandReply(chunk_body, 0, length);
+      chunkLen = static_cast<int32_t>(length);
+    }
+
     // Process the chunk; the actual processing is done by a separate thread
     // ThinClientBaseDM::m_chunkProcessor.
 
@@ -1056,6 +1093,66 @@ void TcrConnection::readMessageChunked(
       m_endpoint);
 }
 
+void TcrConnection::compressRequest(const char*& buffer, size_t& length,
+                                    std::vector<char>& compressed) {
+  const auto start = std::chrono::steady_clock::now();
+  MessageCompressor::Totals totals;
+  if (!MessageCompressor(m_compressionThreshold)
+           .compress(buffer, length, compressed, totals)) {
+    return;
+  }
+  const auto time = std::chrono::steady_clock::now() - start;
+
+  LOGDEBUG(
+      "TcrConnection::compressRequest: compressed %zu parts from %zu to %zu "
+      "bytes",
+      totals.parts, totals.inputBytes, totals.outputBytes);
+  if (m_poolDM != nullptr) {
+    m_poolDM->getStats().incCompressedParts(
+        static_cast<int64_t>(totals.parts),
+        static_cast<int64_t>(totals.inputBytes),
+        static_cast<int64_t>(totals.outputBytes),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+  }
+  buffer = compressed.data();
+  length = compressed.size();
+}
+
+uint8_t* TcrConnection::expandReply(uint8_t* buffer, size_t offset,
+                                    size_t& length) {
+  ReceiveBufferPtr<uint8_t> received(buffer);
+  const auto parts = reinterpret_cast<const char*>(buffer + offset);
+  size_t expandedLength;
+  if (!MessageCompressor::isCompressed(parts, length - offset,
+                                       expandedLength)) {
+    return received.release();
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  ReceiveBufferPtr<uint8_t> expanded(
+      ReceiveBufferPool::allocate(offset + expandedLength));
+  std::memcpy(expanded.get(), buffer, offset);
+  MessageCompressor::Totals totals;
+  MessageCompressor::expand(parts, length - offset,
+                            reinterpret_cast<char*>(expanded.get()) + offset,
+                            totals);
+  if (offset > 0) {
+    MessageCompressor::setMessageLength(
+        reinterpret_cast<char*>(expanded.get()), expandedLength);
+  }
+  const auto time = std::chrono::steady_clock::now() - start;
+
+  if (m_poolDM != nullptr) {
+    m_poolDM->getStats().incDecompressedParts(
+        static_cast<int64_t>(totals.parts),
+        static_cast<int64_t>(totals.inputBytes),
+        static_cast<int64_t>(totals.outputBytes),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+  }
+  length = offset + expandedLength;
+  return expanded.release();
+}
+
 void TcrConnection::close() {
   TcrMessage* closeMsg = TcrMessage::getCloseConnMessage(
       m_poolDM->getConnectionManager().getCacheImpl());
@@ -1371,6 +1468,10 @@ uint8_t TcrConnection::getOverrides(const SystemProperties* props) {
     conflateByte = 2;
   }
 
+  if (props->messageCompressionThreshold() > 0) {
+    conflateByte |= COMPRESSION_OFFERED;
+  }
+
   return conflateByte;
 }
 
@@ -22,6 +22,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <vector>
 
 #include <ace/Semaphore.h>
 
@@ -134,7 +135,8 @@ class APACHE_GEODE_EXPORT TcrConnection {
         m_chunksProcessSema(0),
         m_isBeingUsed(false),
         m_isUsed(0),
-        m_poolDM(nullptr) {}
+        m_poolDM(nullptr),
+        m_compressionThreshold(0) {}
 
   /* destroy the connection */
   ~TcrConnection();
@@ -326,7 +328,7 @@ class APACHE_GEODE_EXPORT TcrConnection {
 
   /**
    * Packs the override settings bits into bytes - currently a single byte for
-   * conflation, remove-unresponsive-client and notify-by-subscription.
+   * conflation and the offer to compress message parts.
    */
   uint8_t getOverrides(const SystemProperties* props);
 
@@ -397,6 +399,20 @@ class APACHE_GEODE_EXPORT TcrConnection {
                           bool checkConnected = true,
                           bool isNotificationMessage = false);
 
+  /**
+   * Points buffer at a copy of the request with its large parts compressed,
+   * held in compressed, if the server accepted compression.
+   */
+  void compressRequest(const char*& buffer, size_t& length,
+                       std::vector<char>& compressed);
+
+  /**
+   * Returns buffer, or a replacement for it taken from the ReceiveBufferPool
+   * if the parts following the first offset bytes include compressed ones,
+   * with the parts expanded and length updated.
+   */
+  uint8_t* expandReply(uint8_t* buffer, size_t offset, size_t& length);
+
   const char* m_endpoint;
   TcrEndpoint* m_endpointObj;
   volatile const bool& m_connected;
@@ -417,6 +433,8 @@ class APACHE_GEODE_EXPORT TcrConnection {
   volatile bool m_isBeingUsed;
   std::atomic<uint32_t> m_isUsed;
   ThinClientPoolDM* m_poolDM;
+  // 0 unless the server accepted compression in the handshake
+  size_t m_compressionThreshold;
 };
 }  // namespace client
 }  // namespace geode
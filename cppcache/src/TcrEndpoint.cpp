@@ -27,6 +27,7 @@
 
 #include "CacheImpl.hpp"
 #include "DistributedSystemImpl.hpp"
+#include "DurableEventReplay.hpp"
 #include "StackTrace.hpp"
 #include "TcrConnectionManager.hpp"
 #include "ThinClientPoolHADM.hpp"
@@ -582,6 +583,23 @@ bool TcrEndpoint::checkDupAndAdd(std::shared_ptr<EventId> eventid) {
 
 void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
   LOGFINE("Started subscription channel for endpoint %s", m_name.c_str());
+  const auto& sysProps =
+      m_cacheImpl->getDistributedSystem().getSystemProperties();
+  // a durable client first receives the events queued while it was away, up
+  // to a marker, and applies those in batches
+  bool replayQueuedEvents = !sysProps.durableClientId().empty();
+  std::unique_ptr<DurableEventReplay> replay;
+  // a secondary or a failed server may never send the marker, so replay mode
+  // also ends when this channel goes quiet or is lost
+  auto lastReceived = std::chrono::steady_clock::now();
+  auto endReplay = [&](const char* reason) {
+    if (replayQueuedEvents) {
+      LOGFINE("Ending queued event replay on endpoint %s: %s", m_name.c_str(),
+              reason);
+      replay = nullptr;
+      replayQueuedEvents = false;
+    }
+  };
   while (isRunning) {
     TcrMessageReply* msg = nullptr;
     try {
@@ -595,6 +613,7 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
         LOGFINER(
             "IO exception while receiving subscription event for endpoint %d",
             opErr);
+        endReplay("endpoint lost");
         if (isRunning) {
           setConnectionStatus(false);
           // close notification channel
@@ -608,7 +627,14 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
         break;
       }
 
-      if (data) {
+      if (data == nullptr) {
+        if (replayQueuedEvents &&
+            std::chrono::steady_clock::now() - lastReceived >=
+                DurableEventReplay::IdleTimeout) {
+          endReplay("no marker received");
+        }
+      } else {
+        lastReceived = std::chrono::steady_clock::now();
         msg = new TcrMessageReply(true, m_baseDM);
         msg->initCqMap();
         msg->setData(data, static_cast<int32_t>(dataLen),
@@ -664,32 +690,23 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
 
         if (isMarker) {
           LOGFINE("Got a marker message on endpont %s", m_name.c_str());
+          // the queued events are all in before the region goes live
+          endReplay("marker received");
           m_cacheImpl->processMarker();
           processMarker();
           _GEODE_SAFE_DELETE(msg);
-        } else {
-          if (!msg->hasCqPart())  // || msg->isInterestListPassed())
-          {
-            const std::string& regionFullPath = msg->getRegionName();
-            auto region = m_cacheImpl->getRegion(regionFullPath);
-
-            if (region != nullptr) {
-              static_cast<ThinClientRegion*>(region.get())
-                  ->receiveNotification(msg);
-            } else {
-              LOGWARN(
-                  "Notification for region %s that does not exist in "
-                  "client cacheImpl.",
-                  regionFullPath.c_str());
-            }
-          } else {
-            LOGDEBUG("receive cq notification %d", msg->getMessageType());
-            auto queryService = getQueryService();
-            if (queryService != nullptr) {
-              static_cast<RemoteQueryService*>(queryService.get())
-                  ->receiveNotification(msg);
-            }
+        } else if (replayQueuedEvents) {
+          if (replay == nullptr) {
+            replay = std::unique_ptr<DurableEventReplay>(new DurableEventReplay(
+                m_cacheImpl->getCachePerfStats(),
+                [this](TcrMessageReply* event) { dispatchNotification(event); },
+                DurableEventReplay::conflates(sysProps),
+                sysProps.getEnableTimeStatistics()));
           }
+          replay->add(msg);
+          msg = nullptr;
+        } else {
+          dispatchNotification(msg);
         }
       }
     } catch (const TimeoutException&) {
@@ -706,6 +723,7 @@ void TcrEndpoint::receiveNotification(std::atomic<bool>& isRunning) {
       LOGFINER(
           "IO exception while receiving subscription event for endpoint %s: %s",
           m_name.c_str(), e.what());
+      endReplay("endpoint lost");
       if (m_connected) {
         setConnectionStatus(false);
         // close notification channel
@@ -1325,6 +1343,30 @@ void TcrEndpoint::closeFailedConnection(TcrConnection*& conn) {
 
 void TcrEndpoint::handleNotificationStats(int64_t) {}
 
+void TcrEndpoint::dispatchNotification(TcrMessageReply* msg) {
+  if (!msg->hasCqPart())  // || msg->isInterestListPassed())
+  {
+    const std::string& regionFullPath = msg->getRegionName();
+    auto region = m_cacheImpl->getRegion(regionFullPath);
+
+    if (region != nullptr) {
+      static_cast<ThinClientRegion*>(region.get())->receiveNotification(msg);
+    } else {
+      LOGWARN(
+          "Notification for region %s that does not exist in "
+          "client cacheImpl.",
+          regionFullPath.c_str());
+    }
+  } else {
+    LOGDEBUG("receive cq notification %d", msg->getMessageType());
+    auto queryService = getQueryService();
+    if (queryService != nullptr) {
+      static_cast<RemoteQueryService*>(queryService.get())
+          ->receiveNotification(msg);
+    }
+  }
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -217,6 +217,8 @@ class TcrEndpoint {
   void closeConnection(TcrConnection*& conn);
   virtual void handleNotificationStats(int64_t byteLength);
   virtual void closeNotification();
+  // hands a subscription event to its region or to the query service
+  void dispatchNotification(TcrMessageReply* msg);
 
   virtual bool handleIOException(const std::string& message,
                                  TcrConnection*& conn, bool isBgThread = false);
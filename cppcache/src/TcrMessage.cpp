@@ -31,6 +31,8 @@
 #include "DiskStoreId.hpp"
 #include "DiskVersionTag.hpp"
 #include "DistributedSystem.hpp"
+#include "ReceiveBufferPool.hpp"
+#include "SerializedCacheable.hpp"
 #include "StackTrace.hpp"
 #include "TSSTXStateWrapper.hpp"
 #include "TXState.hpp"
@@ -198,30 +200,49 @@ void TcrMessage::readLongPart(DataInput& input, uint64_t* intValue) {
   *intValue = input.readInt64();
 }
 
+namespace {
+
+// Builds the string straight from the received buffer rather than copying
+// the bytes out first.
+std::string readBytesAsString(DataInput& input, int32_t length) {
+  if (length < 0 || static_cast<size_t>(length) > input.getBytesRemaining()) {
+    throw OutOfRangeException("TcrMessage: string part of length " +
+                              std::to_string(length) +
+                              " exceeds the remaining message bytes");
+  }
+  std::string str(reinterpret_cast<const char*>(input.currentBufferPosition()),
+                  length);
+  input.advanceCursor(length);
+  return str;
+}
+
+}  // namespace
+
 const std::string TcrMessage::readStringPart(DataInput& input) {
-  char* stringBuffer;
   int32_t stringLength = input.readInt32();
-  stringBuffer = new char[stringLength + 1];
-  stringBuffer[stringLength] = '\0';
   if (input.read()) {
     throw Exception("String is not an object");
   }
-  input.readBytesOnly(reinterpret_cast<int8_t*>(stringBuffer), stringLength);
-  std::string str = stringBuffer;
-  delete[] stringBuffer;
-  return str;
+  return readBytesAsString(input, stringLength);
+}
+
+void TcrMessage::readRegionPart(DataInput& input) {
+  int32_t regionLen = input.readInt32();
+  input.read();  // ignore byte
+  m_regionName = readBytesAsString(input, regionLen);
 }
 
 void TcrMessage::readCqsPart(DataInput& input) {
   m_cqs->clear();
   readIntPart(input, &m_numCqPart);
+  m_cqs->reserve(m_numCqPart / 2);
   for (uint32_t cqCnt = 0; cqCnt < m_numCqPart;) {
     auto cq = readStringPart(input);
     cqCnt++;
     int32_t cqOp;
     readIntPart(input, reinterpret_cast<uint32_t*>(&cqOp));
     cqCnt++;
-    (*m_cqs)[cq] = cqOp;
+    m_cqs->emplace_back(std::move(cq), cqOp);
   }
 }
 
@@ -262,6 +283,30 @@ inline void TcrMessage::readObjectPart(DataInput& input, bool defaultString) {
   }
 }
 
+void TcrMessage::readSerializedObjectPart(DataInput& input) {
+  int32_t lenObj = input.readInt32();
+  auto isObj = input.read();
+  if (lenObj > 0 && isObj == 1) {
+    m_value = SerializedCacheable::read(input, lenObj);
+  } else {
+    input.rewindCursor(5);
+    readObjectPart(input);
+  }
+}
+
+bool TcrMessage::regionStoresSerializedValues() const {
+  if (m_tcdm == nullptr) {
+    return false;
+  }
+  auto cacheImpl = m_tcdm->getConnectionManager().getCacheImpl();
+  if (!cacheImpl->hasSerializedValueRegions()) {
+    return false;
+  }
+  auto region = cacheImpl->getRegion(m_regionName);
+  return region != nullptr &&
+         region->getAttributes().getStoreSerializedValues();
+}
+
 void TcrMessage::readSecureObjectPart(DataInput& input, bool defaultString,
                                       bool isChunk,
                                       uint8_t isLastChunkWithSecurity) {
@@ -389,7 +434,7 @@ inline void TcrMessage::writeInt(uint8_t* buffer, uint32_t value) {
 }
 std::shared_ptr<Serializable> TcrMessage::readCacheableString(DataInput& input,
                                                               int lenObj) {
-  auto decoded = internal::JavaModifiedUtf8::decode(
+  auto decoded = internal::JavaModifiedUtf8::decodeToUtf8(
       reinterpret_cast<const char*>(input.currentBufferPosition()), lenObj);
   input.advanceCursor(lenObj);
 
@@ -494,7 +539,7 @@ void TcrMessage::writeObjectPart(
         m_request->write(static_cast<int8_t>(DSCode::Class));
         m_request->writeString("java.lang.Object");
         for (const auto& key : *getAllKeyList) {
-          m_request->writeObject(key);
+          writeKey(key);
         }
       } else {
         m_request->writeObject(se, isDelta);
@@ -513,6 +558,26 @@ void TcrMessage::writeObjectPart(
   m_request->advanceCursor(sizeOfSerializedObj + 1);
 }
 
+void TcrMessage::writeKeyPart(const std::shared_ptr<CacheableKey>& key) {
+  if (auto cacheableString = dynamic_cast<const CacheableString*>(key.get())) {
+    const auto& serialized = cacheableString->serializedForm();
+    m_request->writeInt(static_cast<int32_t>(serialized.size()));
+    m_request->write(static_cast<int8_t>(1));  // isObject
+    m_request->writeBytesOnly(serialized.data(), serialized.size());
+  } else {
+    writeObjectPart(key);
+  }
+}
+
+void TcrMessage::writeKey(const std::shared_ptr<CacheableKey>& key) {
+  if (auto cacheableString = dynamic_cast<const CacheableString*>(key.get())) {
+    const auto& serialized = cacheableString->serializedForm();
+    m_request->writeBytesOnly(serialized.data(), serialized.size());
+  } else {
+    m_request->writeObject(key);
+  }
+}
+
 void TcrMessage::readInt(uint8_t* buffer, uint16_t* value) {
   uint16_t tmp = *(buffer++);
   tmp = (tmp << 8) | *(buffer);
@@ -721,6 +786,10 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
       "%d m_msgType = %d",
       isLastChunkAndisSecurityHeader, len, m_msgType);
 
+  // released to the ReceiveBufferPool on return unless handed to a
+  // TcrChunkedContext
+  ReceiveBufferPtr<const uint8_t> chunkBytes(bytes);
+
   this->m_isLastChunkAndisSecurityHeader = isLastChunkAndisSecurityHeader;
   handleSpecialFECase();
 
@@ -748,7 +817,8 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
       } else if (m_msgTypeRequest == TcrMessage::PUTALL ||
                  m_msgTypeRequest == TcrMessage::PUT_ALL_WITH_CALLBACK) {
         TcrChunkedContext* chunk = new TcrChunkedContext(
-            bytes, len, m_chunkedResult, isLastChunkAndisSecurityHeader,
+            chunkBytes.release(), len, m_chunkedResult,
+            isLastChunkAndisSecurityHeader,
             m_tcdm->getConnectionManager().getCacheImpl());
         m_chunkedResult->setEndpointMemId(endpointmemId);
         m_tcdm->queueChunk(chunk);
@@ -772,7 +842,8 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
       if (m_chunkedResult != nullptr) {
         LOGDEBUG("tcrmessage in case22 ");
         TcrChunkedContext* chunk = new TcrChunkedContext(
-            bytes, len, m_chunkedResult, isLastChunkAndisSecurityHeader,
+            chunkBytes.release(), len, m_chunkedResult,
+            isLastChunkAndisSecurityHeader,
             m_tcdm->getConnectionManager().getCacheImpl());
         m_chunkedResult->setEndpointMemId(endpointmemId);
         m_tcdm->queueChunk(chunk);
@@ -796,7 +867,6 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
                  TcrMessage::GET_ALL_DATA_ERROR == m_msgType) {
         if (bytes != nullptr) {
           chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
-          _GEODE_SAFE_DELETE_ARRAY(bytes);
         }
       }
       break;
@@ -806,7 +876,6 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
     case EXECUTE_FUNCTION_ERROR:
     case EXECUTE_REGION_FUNCTION_ERROR: {
       if (bytes != nullptr) {
-        // DeleteArray<const uint8_t> delChunk(bytes);
         //  DataInput input(bytes, len);
         // TODO: this not send two part...
         // looks like this is our exception so only one part will come
@@ -814,13 +883,11 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
         // readSecureObjectPart(input, false, true,
         // isLastChunkAndisSecurityHeader );
         chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
-        _GEODE_SAFE_DELETE_ARRAY(bytes);
       }
       break;
     }
     case TcrMessage::EXCEPTION: {
       if (bytes != nullptr) {
-        DeleteArray<const uint8_t> delChunk(bytes);
         auto input =
             m_tcdm->getConnectionManager().getCacheImpl()->createDataInput(
                 bytes, len);
@@ -834,24 +901,18 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
       // TODO: how many parts
       chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
       if (bytes != nullptr) {
-        DeleteArray<const uint8_t> delChunk(bytes);
         LOGFINEST("processChunk - got response from secondary, ignoring.");
       }
       break;
     }
     case TcrMessage::GET_ALL_DATA_ERROR: {
       chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
-      if (bytes != nullptr) {
-        _GEODE_SAFE_DELETE_ARRAY(bytes);
-      }
       // nothing else to done since this will be taken care of at higher level
       break;
     }
     default: {
       // TODO: how many parts what should we do here
-      if (bytes != nullptr) {
-        _GEODE_SAFE_DELETE_ARRAY(bytes);
-      } else {
+      if (bytes == nullptr) {
         LOGWARN(
             "Got unhandled message type %d while processing response, possible "
             "serialization mismatch",
@@ -1089,14 +1150,7 @@ void TcrMessage::handleByteArrayResponse(
     }
     case TcrMessage::LOCAL_INVALIDATE:
     case TcrMessage::LOCAL_DESTROY: {
-      int32_t regionLen = input.readInt32();
-      input.advanceCursor(1);  // ignore byte
-      char* regname = nullptr;
-      regname = new char[regionLen + 1];
-      DeleteArray<char> delRegName(regname);
-      input.readBytesOnly(reinterpret_cast<int8_t*>(regname), regionLen);
-      regname[regionLen] = '\0';
-      m_regionName = regname;
+      readRegionPart(input);
 
       readKeyPart(input);
 
@@ -1124,14 +1178,7 @@ void TcrMessage::handleByteArrayResponse(
 
     case TcrMessage::LOCAL_CREATE:
     case TcrMessage::LOCAL_UPDATE: {
-      int32_t regionLen = input.readInt32();
-      input.advanceCursor(1);  // ignore byte
-      char* regname = nullptr;
-      regname = new char[regionLen + 1];
-      DeleteArray<char> delRegName(regname);
-      input.readBytesOnly(reinterpret_cast<int8_t*>(regname), regionLen);
-      regname[regionLen] = '\0';
-      m_regionName = regname;
+      readRegionPart(input);
 
       readKeyPart(input);
       //  Read delta flag
@@ -1147,6 +1194,9 @@ void TcrMessage::handleByteArrayResponse(
             m_tcdm->getConnectionManager().getCacheImpl()->createDataInput(
                 reinterpret_cast<const uint8_t*>(m_deltaBytes),
                 m_deltaBytesLen)));
+      } else if (regionStoresSerializedValues()) {
+        // kept as received and only deserialized when the region is read
+        readSerializedObjectPart(input);
       } else {
         readObjectPart(input);
       }
@@ -1162,11 +1212,17 @@ void TcrMessage::handleByteArrayResponse(
         // LOGINFO("got cq local_create/local_create");
         readCqsPart(input);
         m_msgTypeForCq = static_cast<uint32_t>(m_msgType);
+        // CQ listeners always receive the deserialized value
+        if (auto serialized =
+                std::dynamic_pointer_cast<SerializedCacheable>(m_value)) {
+          m_value = serialized->deserialize(
+              *m_tcdm->getConnectionManager().getCacheImpl(),
+              DataInputInternal::getPool(input));
+        }
       }
 
       // read eventid part
       readEventIdPart(input, false);
-      _GEODE_SAFE_DELETE_ARRAY(regname);  // COVERITY ---> 30299 Resource leak
 
       break;
     }
@@ -1178,14 +1234,7 @@ void TcrMessage::handleByteArrayResponse(
 
     case TcrMessage::LOCAL_DESTROY_REGION:
     case TcrMessage::CLEAR_REGION: {
-      int32_t regionLen = input.readInt32();
-      input.advanceCursor(1);  // ignore byte
-      char* regname = nullptr;
-      regname = new char[regionLen + 1];
-      DeleteArray<char> delRegName(regname);
-      input.readBytesOnly(reinterpret_cast<int8_t*>(regname), regionLen);
-      regname[regionLen] = '\0';
-      m_regionName = regname;
+      readRegionPart(input);
       // skip callbackarg part
       // skipParts(input, 1);
       readCallbackObjectPart(input);
@@ -1291,15 +1340,7 @@ void TcrMessage::handleByteArrayResponse(
     }
     case TcrMessage::TOMBSTONE_OPERATION: {
       uint32_t tombstoneOpType;
-      int32_t regionLen = input.readInt32();
-      input.read();
-      char* regname = nullptr;
-
-      regname = new char[regionLen + 1];
-      DeleteArray<char> delRegName(regname);
-      input.readBytesOnly(reinterpret_cast<int8_t*>(regname), regionLen);
-      regname[regionLen] = '\0';
-      m_regionName = regname;
+      readRegionPart(input);
       readIntPart(input, &tombstoneOpType);  // partlen;
       // read and ignore length
       input.readInt32();
@@ -1582,7 +1623,7 @@ TcrMessageContainsKey::TcrMessageContainsKey(
 
   writeHeader(m_msgType, numOfParts);
   writeRegionPart(m_regionName);
-  writeObjectPart(key);
+  writeKeyPart(key);
   // write 0 to indicate containskey (1 for containsvalueforkey)
   writeIntPart(isContainsKey ? 0 : 1);
   if (aCallbackArgument != nullptr) {
@@ -1634,7 +1675,7 @@ TcrMessageRequest::TcrMessageRequest(
   numOfParts--;  // no event id for request
   writeHeader(TcrMessage::REQUEST, numOfParts);
   writeRegionPart(m_regionName);
-  writeObjectPart(key);
+  writeKeyPart(key);
   if (aCallbackArgument != nullptr) {
     // set bool variable to true.
     m_isCallBackArguement = true;
@@ -1671,7 +1712,7 @@ TcrMessageInvalidate::TcrMessageInvalidate(
 
   writeHeader(TcrMessage::INVALIDATE, numOfParts);
   writeRegionPart(m_regionName);
-  writeObjectPart(key);
+  writeKeyPart(key);
   writeEventIdPart();
   if (aCallbackArgument != nullptr) {
     // set bool variable to true.
@@ -1711,7 +1752,7 @@ TcrMessageDestroy::TcrMessageDestroy(
     numOfParts += 2;  // for GFE Destroy65.java
     writeHeader(TcrMessage::DESTROY, numOfParts);
     writeRegionPart(m_regionName);
-    writeObjectPart(key);
+    writeKeyPart(key);
     writeObjectPart(value);  // expectedOldValue part
     uint8_t removeByte = 8;  // OP_TYPE_DESTROY value from Operation.java
     auto removeBytePart = CacheableByte::create(removeByte);
@@ -1725,7 +1766,7 @@ TcrMessageDestroy::TcrMessageDestroy(
     numOfParts += 2;  // for GFE Destroy65.java
     writeHeader(TcrMessage::DESTROY, numOfParts);
     writeRegionPart(m_regionName);
-    writeObjectPart(key);
+    writeKeyPart(key);
     writeObjectPart(nullptr);  // expectedOldValue part
     writeObjectPart(nullptr);  // operation part
     writeEventIdPart();
@@ -1772,7 +1813,7 @@ TcrMessagePut::TcrMessagePut(
   writeRegionPart(m_regionName);
   writeObjectPart(nullptr);  // operation = null
   writeIntPart(0);           // flags = 0
-  writeObjectPart(key);
+  writeKeyPart(key);
   writeObjectPart(CacheableBoolean::create(isDelta));
   writeObjectPart(value, isDelta);
   writeEventIdPart(0, fullValueAfterDeltaFail);
@@ -1923,7 +1964,7 @@ TcrMessageUnregisterInterestList::TcrMessageUnregisterInterestList(
       throw IllegalArgumentException(
           "keys in the interest list cannot be nullptr");
     }
-    writeObjectPart(keys[i]);
+    writeKeyPart(keys[i]);
   }
 
   writeMessageLength();
@@ -2154,7 +2195,7 @@ TcrMessagePutAll::TcrMessagePutAll(
   }
 
   for (const auto& iter : map) {
-    writeObjectPart(iter.first);
+    writeKeyPart(iter.first);
     writeObjectPart(iter.second);
   }
 
@@ -2205,7 +2246,7 @@ TcrMessageRemoveAll::TcrMessageRemoveAll(
   writeIntPart(static_cast<int32_t>(keys.size()));
 
   for (const auto& key : keys) {
-    writeObjectPart(key);
+    writeKeyPart(key);
   }
   writeMessageLength();
 }
@@ -2768,7 +2809,7 @@ void TcrMessage::setData(const char* bytearray, int32_t len, uint16_t memId,
             getPool())));
   }
   if (bytearray) {
-    DeleteArray<const char> delByteArr(bytearray);
+    ReceiveBufferPtr<const char> delByteArr(bytearray);
     handleByteArrayResponse(bytearray, len, memId, serializationRegistry,
                             memberListForVersionStamp);
   }
@@ -2797,7 +2838,9 @@ void TcrMessage::setMessageTypeRequest(int32_t msgType) {
 }
 int32_t TcrMessage::getMessageTypeRequest() const { return m_msgTypeRequest; }
 
-const std::map<std::string, int>* TcrMessage::getCqs() const { return m_cqs; }
+const TcrMessage::CqOperationList* TcrMessage::getCqs() const {
+  return m_cqs;
+}
 std::shared_ptr<CacheableKey> TcrMessage::getKey() const { return m_key; }
 
 const std::shared_ptr<CacheableKey>& TcrMessage::getKeyRef() const {
@@ -267,7 +267,11 @@ class APACHE_GEODE_EXPORT TcrMessage {
            m_msgType == TcrMessage::EXECUTE_REGION_FUNCTION;
   }
 
-  inline void initCqMap() { m_cqs = new std::map<std::string, int>(); }
+  // names of the CQs a notification matched with the CQ operation of each,
+  // in the order the server sent them
+  typedef std::vector<std::pair<std::string, int32_t>> CqOperationList;
+
+  inline void initCqMap() { m_cqs = new CqOperationList(); }
 
   inline bool forSingleHop() const {
     return m_msgType == TcrMessage::PUT || m_msgType == TcrMessage::DESTROY ||
@@ -323,7 +327,7 @@ class APACHE_GEODE_EXPORT TcrMessage {
   std::shared_ptr<Cacheable> getCallbackArgument() const;
   const std::shared_ptr<Cacheable>& getCallbackArgumentRef() const;
 
-  const std::map<std::string, int>* getCqs() const;
+  const CqOperationList* getCqs() const;
   bool getBoolValue() const { return m_boolValue; };
   inline const char* getException() {
     exceptionMessage = Utils::nullSafeToString(m_value);
@@ -541,6 +545,8 @@ class APACHE_GEODE_EXPORT TcrMessage {
       const SerializationRegistry& serializationRegistry,
       MemberListForVersionStamp& memberListForVersionStamp);
   void readObjectPart(DataInput& input, bool defaultString = false);
+  void readSerializedObjectPart(DataInput& input);
+  bool regionStoresSerializedValues() const;
   void readFailedNodePart(DataInput& input);
   void readCallbackObjectPart(DataInput& input, bool defaultString = false);
   void readKeyPart(DataInput& input);
@@ -557,6 +563,8 @@ class APACHE_GEODE_EXPORT TcrMessage {
                        bool isDelta = false, bool callToData = false,
                        const std::vector<std::shared_ptr<CacheableKey>>*
                            getAllKeyList = nullptr);
+  void writeKeyPart(const std::shared_ptr<CacheableKey>& key);
+  void writeKey(const std::shared_ptr<CacheableKey>& key);
   void writeHeader(uint32_t msgType, uint32_t numOfParts);
   void writeRegionPart(const std::string& regionName);
   void writeStringPart(const std::string& str);
@@ -577,6 +585,7 @@ class APACHE_GEODE_EXPORT TcrMessage {
 
   void skipParts(DataInput& input, int32_t numParts = 1);
   const std::string readStringPart(DataInput& input);
+  void readRegionPart(DataInput& input);
   void readCqsPart(DataInput& input);
   void readHashMapForGCVersions(apache::geode::client::DataInput& input,
                                 std::shared_ptr<CacheableHashMap>& value);
@@ -593,7 +602,7 @@ class APACHE_GEODE_EXPORT TcrMessage {
   const Region* m_region;
   std::chrono::milliseconds m_timeout;
   std::vector<std::vector<std::shared_ptr<BucketServerLocation>>>* m_metadata;
-  std::map<std::string, int>* m_cqs;
+  CqOperationList* m_cqs;
   std::chrono::milliseconds m_messageResponseTimeout;
   std::unique_ptr<DataInput> m_delta;
   int8_t* m_deltaBytes;
@@ -196,9 +196,10 @@ void ThinClientBaseDM::failover() {}
 
 void ThinClientBaseDM::queueChunk(TcrChunkedContext* chunk) {
   LOGDEBUG("ThinClientBaseDM::queueChunk");
-  if (m_chunkProcessor == nullptr) {
+  if (m_chunkProcessor == nullptr || chunk->isStreaming()) {
     LOGDEBUG("ThinClientBaseDM::queueChunk2");
-    // process in same thread if no chunk processor thread
+    // process in same thread if no chunk processor thread, or if the result
+    // relies on it for backpressure
     chunk->handleChunk(true);
     _GEODE_SAFE_DELETE(chunk);
   } else if (!m_chunks.putFor(chunk, std::chrono::seconds(1))) {
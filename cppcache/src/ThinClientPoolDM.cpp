@@ -113,6 +113,11 @@ class GetAllWork : public PooledWork<GfErrType>,
 
   TcrMessage* getReply() { return m_reply; }
 
+  const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>>& getKeys()
+      const {
+    return m_keys;
+  }
+
   void init() {}
   GfErrType execute(void) {
     GuardUserAttributes gua;
@@ -1285,11 +1290,23 @@ GfErrType ThinClientPoolDM::sendSyncRequest(TcrMessage& request,
     }
     reply.setMessageType(TcrMessage::RESPONSE);
 
+    std::vector<std::shared_ptr<GetAllWork>> failedWorkers;
     for (auto& worker : getAllWorkers) {
       GfErrType err = worker->getResult();
 
       if (err != GF_NOERR) {
-        error = err;
+        if (err == GF_NOTCON || err == GF_IOERR) {
+          if (err == GF_NOTCON) {
+            m_clientMetadataService->enqueueForMetadataRefresh(
+                region->getFullPath(), 0);
+          }
+          failedWorkers.push_back(worker);
+        } else {
+          // the server answered, possibly with part of the results already
+          // applied, so only a lost connection is worth another attempt
+          error = err;
+        }
+        continue;
       }
 
       TcrMessage* currentReply = worker->getReply();
@@ -1297,6 +1314,26 @@ GfErrType ThinClientPoolDM::sendSyncRequest(TcrMessage& request,
         reply.setMessageType(currentReply->getMessageType());
       }
     }
+
+    // The buckets of a server that could not be reached have likely moved,
+    // so retry its keys without a server location and let the pool pick any
+    // live server, as single-hop putAll does.
+    for (auto& failedWorker : failedWorkers) {
+      LOGDEBUG("Retrying getAll for %zu keys without single hop",
+               failedWorker->getKeys()->size());
+      GetAllWork retryWorker(this, region, nullptr, failedWorker->getKeys(),
+                             attemptFailover, isBGThread,
+                             responseHandler->getAddToLocalCache(),
+                             responseHandler, request.getCallbackArgument());
+      GfErrType err = retryWorker.execute();
+
+      if (err != GF_NOERR) {
+        error = err;
+      } else if (retryWorker.getReply()->getMessageType() !=
+                 TcrMessage::RESPONSE) {
+        reply.setMessageType(retryWorker.getReply()->getMessageType());
+      }
+    }
     return error;
   } else {
     if (type == TcrMessage::GET_ALL_70 ||
@@ -19,7 +19,6 @@
 
 #include <algorithm>
 #include <limits>
-#include <regex>
 
 #include <geode/PoolManager.hpp>
 #include <geode/Struct.hpp>
@@ -30,6 +29,7 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "DataInputInternal.hpp"
+#include "LocalQuery.hpp"
 #include "PutAllPartialResultServerException.hpp"
 #include "ReadWriteLock.hpp"
 #include "RegionGlobalLocks.hpp"
@@ -49,11 +49,16 @@ namespace apache {
 namespace geode {
 namespace client {
 
-static const std::regex PREDICATE_IS_FULL_QUERY_REGEX(
-    "^\\s*(?:select|import)\\b", std::regex::icase);
-
 void setThreadLocalExceptionMessage(const char* exMsg);
 
+namespace {
+
+// more keys than this are registered in batches of this size, bounding the
+// request and the initial-image reply the server builds for each message
+const size_t REGISTER_INTEREST_BATCH_SIZE = 64 * 1024;
+
+}  // namespace
+
 class PutAllWork : public PooledWork<GfErrType>,
                    private NonCopyable,
                    private NonAssignable {
@@ -341,6 +346,38 @@ class RemoveAllWork : public PooledWork<GfErrType>,
   }
 };
 
+class PutInitialValuesWork : public PooledWork<GfErrType>,
+                             private NonCopyable,
+                             private NonAssignable {
+  ThinClientRegion* m_region;
+  std::shared_ptr<MapPutBatch> m_puts;
+  int32_t m_destroyTracker;
+
+ public:
+  PutInitialValuesWork(ThinClientRegion* region,
+                       std::shared_ptr<MapPutBatch> puts,
+                       int32_t destroyTracker)
+      : m_region(region),
+        m_puts(std::move(puts)),
+        m_destroyTracker(destroyTracker) {}
+
+  ~PutInitialValuesWork() override = default;
+
+  GfErrType execute(void) override {
+    try {
+      m_region->putInitialValues(*m_puts, m_destroyTracker);
+    } catch (const Exception& ex) {
+      LOGERROR("Failed to put initial values of registered keys: %s: %s",
+               ex.getName().c_str(), ex.what());
+      return GF_EUNDEF;
+    } catch (...) {
+      LOGERROR("Failed to put initial values of registered keys");
+      return GF_EUNDEF;
+    }
+    return GF_NOERR;
+  }
+};
+
 ThinClientRegion::ThinClientRegion(
     const std::string& name, CacheImpl* cacheImpl,
     const std::shared_ptr<RegionInternal>& rPtr, RegionAttributes attributes,
@@ -616,14 +653,14 @@ std::shared_ptr<SelectResults> ThinClientRegion::query(
     throw IllegalArgumentException("Region query predicate string is empty");
   }
 
-  std::string squery;
-  if (std::regex_search(predicate, PREDICATE_IS_FULL_QUERY_REGEX)) {
-    squery = predicate;
-  } else {
-    squery = "select distinct * from ";
-    squery += getFullPath();
-    squery += " this where ";
-    squery += predicate;
+  const auto squery = LocalQuery::forPredicate(getFullPath(), predicate);
+
+  if (isLocallyComplete()) {
+    try {
+      return executeLocalQuery(LocalQuery(squery));
+    } catch (const QueryException& e) {
+      LOGFINE("Sending query to the server since %s", e.what());
+    }
   }
 
   std::shared_ptr<RemoteQuery> queryPtr;
@@ -642,6 +679,26 @@ std::shared_ptr<SelectResults> ThinClientRegion::query(
   return queryPtr->execute(timeout, "Region::query", m_tcrdm, nullptr);
 }
 
+bool ThinClientRegion::isLocallyComplete() {
+  if (!m_regionAttributes.getCachingEnabled() ||
+      m_regionAttributes.getLruEntriesLimit() > 0 ||
+      m_regionAttributes.getEntryTimeToLive() > std::chrono::seconds::zero() ||
+      m_regionAttributes.getEntryIdleTimeout() > std::chrono::seconds::zero()) {
+    return false;
+  }
+
+  std::lock_guard<decltype(m_keysLock)> keysGuard(m_keysLock);
+  for (const auto interestListRegex :
+       {&m_interestListRegex, &m_durableInterestListRegex}) {
+    const auto found = interestListRegex->find(".*");
+    if (found != interestListRegex->end() &&
+        found->second.ordinal == InterestResultPolicy::KEYS_VALUES.ordinal) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool ThinClientRegion::existsValue(const std::string& predicate,
                                    std::chrono::milliseconds timeout) {
   util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
@@ -2240,6 +2297,10 @@ GfErrType ThinClientRegion::registerKeysNoThrow(
   if (keys.empty()) {
     return err;
   }
+  if (reply == nullptr && keys.size() > REGISTER_INTEREST_BATCH_SIZE) {
+    return registerKeyBatchesNoThrow(keys, attemptFailover, endpoint,
+                                     isDurable, interestPolicy, receiveValues);
+  }
 
   TcrMessageReply replyLocal(true, m_tcrdm);
   bool needToCreateRC = true;
@@ -2300,6 +2361,144 @@ GfErrType ThinClientRegion::registerKeysNoThrow(
   return err;
 }
 
+GfErrType ThinClientRegion::registerKeyBatchesNoThrow(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys,
+    bool attemptFailover, TcrEndpoint* endpoint, bool isDurable,
+    InterestResultPolicy interestPolicy, bool receiveValues) {
+  const bool getValues =
+      interestPolicy.ordinal == InterestResultPolicy::KEYS_VALUES.ordinal;
+  const int32_t destroyTracker = 1;
+  GfErrType err = GF_NOERR;
+  auto& threadPool = m_cacheImpl->getThreadPool();
+  std::shared_ptr<PutInitialValuesWork> pendingPuts;
+  auto& interestList =
+      isDurable ? (receiveValues ? m_durableInterestList
+                                 : m_durableInterestListForUpdatesAsInvalidates)
+                : (receiveValues ? m_interestList
+                                 : m_interestListForUpdatesAsInvalidates);
+  // keys this call added to the interest list, unregistered again if a later
+  // batch fails so that registration stays all or nothing
+  std::vector<std::shared_ptr<CacheableKey>> addedKeys;
+
+  for (size_t start = 0; start < keys.size() && err == GF_NOERR;
+       start += REGISTER_INTEREST_BATCH_SIZE) {
+    const auto end =
+        std::min(keys.size(), start + REGISTER_INTEREST_BATCH_SIZE);
+    const std::vector<std::shared_ptr<CacheableKey>> batch(
+        keys.begin() + start, keys.begin() + end);
+
+    TcrMessageReply reply(true, m_tcrdm);
+    TcrMessageRegisterInterestList request(
+        new DataOutput(m_cacheImpl->createDataOutput()), this, batch,
+        isDurable, getAttributes().getCachingEnabled(), receiveValues,
+        interestPolicy, m_tcrdm);
+    std::recursive_mutex responseLock;
+    MapOfUpdateCounters trackers;
+    auto puts = std::make_shared<MapPutBatch>();
+    std::unique_ptr<TcrChunkedResult> resultCollector;
+    if (getValues) {
+      auto getAllResponse = new ChunkedGetAllResponse(
+          request, this, &batch, std::make_shared<HashMapOfCacheable>(),
+          std::make_shared<HashMapOfException>(), nullptr, trackers,
+          destroyTracker, true, responseLock);
+      getAllResponse->deferLocalPuts(puts.get());
+      resultCollector.reset(getAllResponse);
+    } else {
+      resultCollector.reset(
+          new ChunkedInterestResponse(request, nullptr, reply));
+    }
+    reply.setChunkedResultHandler(resultCollector.get());
+
+    err = m_tcrdm->sendSyncRequestRegisterInterest(
+        request, reply, attemptFailover, this, endpoint);
+    if (err != GF_NOERR) {
+      break;
+    }
+    m_regionStats->incRegisterInterestBatches();
+
+    // the previous batch's values must be in before this batch's go in, in
+    // case the key list repeats keys
+    if (pendingPuts) {
+      err = pendingPuts->getResult();
+      pendingPuts = nullptr;
+    }
+    if (!puts->keys.empty()) {
+      pendingPuts =
+          std::make_shared<PutInitialValuesWork>(this, puts, destroyTracker);
+      threadPool.perform(pendingPuts);
+    }
+
+    if (reply.getMessageType() == TcrMessage::RESPONSE_FROM_SECONDARY &&
+        endpoint) {
+      LOGFINER(
+          "registerKeyBatchesNoThrow - got response from secondary for "
+          "endpoint %s, ignoring.",
+          endpoint->name().c_str());
+    } else if (attemptFailover) {
+      for (const auto& key : batch) {
+        if (interestList.find(key) == interestList.end()) {
+          addedKeys.push_back(key);
+        }
+      }
+      addKeys(batch, isDurable, receiveValues, interestPolicy);
+      if (!getValues) {
+        localInvalidateForRegisterInterest(batch);
+      }
+    }
+  }
+
+  if (pendingPuts) {
+    const auto putsErr = pendingPuts->getResult();
+    err = err != GF_NOERR ? err : putsErr;
+  }
+
+  if (err != GF_NOERR && !addedKeys.empty()) {
+    TcrMessageReply reply(true, m_tcrdm);
+    TcrMessageUnregisterInterestList request(
+        new DataOutput(m_cacheImpl->createDataOutput()), this, addedKeys,
+        isDurable, receiveValues, InterestResultPolicy::NONE, m_tcrdm);
+    const auto undoErr =
+        m_tcrdm->sendSyncRequestRegisterInterest(request, reply);
+    if (undoErr == GF_NOERR) {
+      for (const auto& key : addedKeys) {
+        interestList.erase(key);
+      }
+    } else {
+      // the keys stay registered on the server, so keep them in the interest
+      // list too and let failover register them again
+      LOGWARN(
+          "registerKeyBatchesNoThrow - could not unregister %zu keys of a "
+          "failed registration on region %s, error %d",
+          addedKeys.size(), getFullPath().c_str(), undoErr);
+    }
+  }
+  return err;
+}
+
+void ThinClientRegion::putInitialValues(MapPutBatch& puts,
+                                        int32_t destroyTracker) {
+  if (m_entries == nullptr) {
+    return;
+  }
+  int64_t sampleStartNanos = startStatOpTime();
+
+  putLocalBatch("registerKeys", puts, destroyTracker);
+  for (size_t index = 0; index < puts.results.size(); ++index) {
+    if (puts.results[index].err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+      LOGDEBUG(
+          "ThinClientRegion::putInitialValues: cache already has a newer "
+          "version for key [%s]",
+          Utils::nullSafeToString(puts.keys[index]).c_str());
+    }
+  }
+
+  m_regionStats->incRegisterInterestInitialValues(
+      static_cast<int32_t>(puts.keys.size()));
+  updateStatOpTime(m_regionStats->getStat(),
+                   m_regionStats->getRegisterInterestInitialValuesTimeId(),
+                   sampleStartNanos);
+}
+
 GfErrType ThinClientRegion::unregisterKeysNoThrow(
     const std::vector<std::shared_ptr<CacheableKey>>& keys,
     bool attemptFailover) {
@@ -2816,29 +3015,25 @@ void ThinClientRegion::receiveNotification(TcrMessage* msg) {
 }
 
 void ThinClientRegion::localInvalidateRegion_internal() {
-  std::shared_ptr<MapEntryImpl> me;
-  std::shared_ptr<Cacheable> oldValue;
-
-  std::vector<std::shared_ptr<CacheableKey>> keysVec = keys_internal();
-  for (const auto& key : keysVec) {
-    std::shared_ptr<VersionTag> versionTag;
-    m_entries->invalidate(key, me, oldValue, versionTag);
+  if (!m_regionAttributes.getCachingEnabled()) {
+    return;
   }
+  std::vector<std::shared_ptr<MapEntryImpl>> invalidated;
+  m_entries->invalidateAll(invalidated);
 }
 
 void ThinClientRegion::invalidateInterestList(
     std::unordered_map<std::shared_ptr<CacheableKey>, InterestResultPolicy>&
         interestList) {
-  std::shared_ptr<MapEntryImpl> me;
-  std::shared_ptr<Cacheable> oldValue;
-
-  if (!m_regionAttributes.getCachingEnabled()) {
+  if (!m_regionAttributes.getCachingEnabled() || interestList.empty()) {
     return;
   }
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  keys.reserve(interestList.size());
   for (const auto& iter : interestList) {
-    std::shared_ptr<VersionTag> versionTag;
-    m_entries->invalidate(iter.first, me, oldValue, versionTag);
+    keys.push_back(iter.first);
   }
+  m_entries->invalidateKeys(keys);
 }
 
 void ThinClientRegion::localInvalidateFailover() {
@@ -3388,6 +3583,30 @@ void ChunkedKeySetResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
 void ChunkedQueryResponse::reset() {
   m_queryResults->clear();
   m_structFieldNames.clear();
+  m_columns.clear();
+  m_nextColumn = 0;
+  if (m_stream != nullptr) {
+    m_stream->restart();
+  }
+}
+
+void ChunkedQueryResponse::readValue(DataInput& input) {
+  if (m_columns.empty()) {
+    std::shared_ptr<Serializable> value;
+    input.readObject(value);
+    m_queryResults->push_back(value);
+  } else {
+    m_columns[m_nextColumn]->read(input);
+    m_nextColumn = (m_nextColumn + 1) % m_columns.size();
+  }
+}
+
+void ChunkedQueryResponse::streamResults() {
+  if (m_stream != nullptr) {
+    // blocks while the consumer is behind, which holds back the socket
+    m_stream->add(m_structFieldNames, m_queryResults);
+    m_queryResults->clear();
+  }
 }
 
 void ChunkedQueryResponse::readObjectPartList(DataInput& input,
@@ -3406,9 +3625,7 @@ void ChunkedQueryResponse::readObjectPartList(DataInput& input,
       throw IllegalStateException(exMsgPtr);
     } else {
       if (isResultSet) {
-        std::shared_ptr<Cacheable> value;
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readValue(input);
       } else {
         auto code = static_cast<DSCode>(input.read());
         if (code == DSCode::FixedIDByte) {
@@ -3461,6 +3678,7 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     auto intVal = std::dynamic_pointer_cast<CacheableInt32>(input.readObject());
     m_queryResults->push_back(intVal);
     m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
+    streamResults();
     return;
   }
 
@@ -3493,6 +3711,11 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
         m_structFieldNames.push_back(sptr);
       }
     }
+    if (m_columnar && m_columns.empty()) {
+      for (size_t i = 0; i < m_structFieldNames.size(); i++) {
+        m_columns.push_back(std::make_shared<ResultColumnImpl>());
+      }
+    }
   }
 
   // skip the remaining part
@@ -3519,17 +3742,14 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     int32_t arraySize = input.readArrayLength();
     skipClass(input);
     for (int32_t arrayItem = 0; arrayItem < arraySize; ++arrayItem) {
-      std::shared_ptr<Serializable> value;
       if (isResultSet) {
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readValue(input);
       } else {
         input.read();
         int32_t arraySize2 = input.readArrayLength();
         skipClass(input);
         for (int32_t index = 0; index < arraySize2; ++index) {
-          input.readObject(value);
-          m_queryResults->push_back(value);
+          readValue(input);
         }
       }
     }
@@ -3557,6 +3777,7 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
   }
 
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
+  streamResults();
 }
 
 void ChunkedQueryResponse::skipClass(DataInput& input) {
@@ -3733,6 +3954,7 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
       m_keys, &m_keysOffset, m_values, m_exceptions, m_resultKeys, m_region,
       &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
       m_responseLock);
+  objectList.deferLocalPuts(m_deferredPuts);
 
   objectList.fromData(input);
 
@@ -34,6 +34,8 @@
 #include "LocalRegion.hpp"
 #include "Queue.hpp"
 #include "RegionGlobalLocks.hpp"
+#include "ResultColumnImpl.hpp"
+#include "ResultStreamImpl.hpp"
 #include "TcrChunkedContext.hpp"
 #include "TcrMessage.hpp"
 
@@ -149,6 +151,10 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
 
   void localInvalidateFailover();
 
+  /** put initial values of registered keys in the local cache, segments in
+   * parallel */
+  void putInitialValues(MapPutBatch& puts, int32_t destroyTracker);
+
   inline ThinClientBaseDM* getDistMgr() const { return m_tcrdm; }
 
   std::shared_ptr<CacheableVector> reExecuteFunction(
@@ -312,6 +318,9 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
   virtual void setProcessedMarker(bool mark = true);
 
  private:
+  // true when the cache holds every entry of the region with its current
+  // value, so that queries can be answered locally
+  bool isLocallyComplete();
   bool isRegexRegistered(
       std::unordered_map<std::string, InterestResultPolicy>& interestListRegex,
       const std::string& regex, bool allKeys);
@@ -326,6 +335,13 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
   void invalidateInterestList(
       std::unordered_map<std::shared_ptr<CacheableKey>, InterestResultPolicy>&
           interestList);
+  // registers keys too many for one message in batches, putting the initial
+  // values of each batch in the local cache while the next one is sent; keys
+  // registered by earlier batches are unregistered if a later batch fails
+  GfErrType registerKeyBatchesNoThrow(
+      const std::vector<std::shared_ptr<CacheableKey>>& keys,
+      bool attemptFailover, TcrEndpoint* endpoint, bool isDurable,
+      InterestResultPolicy interestPolicy, bool receiveValues);
   GfErrType createOnServer(
       const std::shared_ptr<CacheableKey>& keyPtr,
       const std::shared_ptr<Cacheable>& cvalue,
@@ -428,18 +444,34 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   TcrMessage& m_msg;
   std::shared_ptr<CacheableVector> m_queryResults;
   std::vector<std::string> m_structFieldNames;
+  ResultStreamImpl* m_stream;
+  bool m_columnar;
+  std::vector<std::shared_ptr<ResultColumnImpl>> m_columns;
+  size_t m_nextColumn;
 
   void skipClass(DataInput& input);
 
+  void streamResults();
+
+  void readValue(DataInput& input);
+
   // disabled
   ChunkedQueryResponse(const ChunkedQueryResponse&);
   ChunkedQueryResponse& operator=(const ChunkedQueryResponse&);
 
  public:
-  inline explicit ChunkedQueryResponse(TcrMessage& msg)
+  /**
+   * Results are collected for getQueryResults(), or handed to stream as
+   * each chunk is read if there is one.
+   */
+  inline explicit ChunkedQueryResponse(TcrMessage& msg,
+                                       ResultStreamImpl* stream = nullptr)
       : TcrChunkedResult(),
         m_msg(msg),
-        m_queryResults(CacheableVector::create()) {}
+        m_queryResults(CacheableVector::create()),
+        m_stream(stream),
+        m_columnar(false),
+        m_nextColumn(0) {}
 
   inline const std::shared_ptr<CacheableVector>& getQueryResults() const {
     return m_queryResults;
@@ -449,11 +481,24 @@ class ChunkedQueryResponse : public TcrChunkedResult {
     return m_structFieldNames;
   }
 
+  /**
+   * Decodes the fields of struct results into one column per field rather
+   * than into getQueryResults().
+   */
+  inline void setColumnar(bool columnar) { m_columnar = columnar; }
+
+  inline const std::vector<std::shared_ptr<ResultColumnImpl>>& getColumns()
+      const {
+    return m_columns;
+  }
+
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl);
   virtual void reset();
 
+  virtual bool isStreaming() const { return m_stream != nullptr; }
+
   void readObjectPartList(DataInput& input, bool isResultSet);
 };
 
@@ -469,6 +514,7 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
   bool m_getResult;
   std::shared_ptr<ResultCollector> m_rc;
   std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
+  bool m_streaming;
 
   // disabled
   ChunkedFunctionExecutionResponse(const ChunkedFunctionExecutionResponse&);
@@ -478,7 +524,12 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
  public:
   inline ChunkedFunctionExecutionResponse(TcrMessage& msg, bool getResult,
                                           std::shared_ptr<ResultCollector> rc)
-      : TcrChunkedResult(), m_msg(msg), m_getResult(getResult), m_rc(rc) {}
+      : TcrChunkedResult(),
+        m_msg(msg),
+        m_getResult(getResult),
+        m_rc(rc),
+        m_streaming(std::dynamic_pointer_cast<StreamingResultCollector>(rc) !=
+                    nullptr) {}
 
   inline ChunkedFunctionExecutionResponse(
       TcrMessage& msg, bool getResult, std::shared_ptr<ResultCollector> rc,
@@ -487,7 +538,9 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
         m_msg(msg),
         m_getResult(getResult),
         m_rc(rc),
-        m_resultCollectorLock(resultCollectorLock) {}
+        m_resultCollectorLock(resultCollectorLock),
+        m_streaming(std::dynamic_pointer_cast<StreamingResultCollector>(rc) !=
+                    nullptr) {}
 
   /* inline const std::shared_ptr<CacheableVector>&
    getFunctionExecutionResults() const
@@ -505,6 +558,8 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl);
   virtual void reset();
+
+  virtual bool isStreaming() const { return m_streaming; }
 };
 
 /**
@@ -525,6 +580,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
   std::recursive_mutex& m_responseLock;
+  MapPutBatch* m_deferredPuts;
   // disabled
   ChunkedGetAllResponse(const ChunkedGetAllResponse&);
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&);
@@ -550,13 +606,20 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
         m_destroyTracker(destroyTracker),
         m_addToLocalCache(addToLocalCache),
         m_keysOffset(0),
-        m_responseLock(responseLock) {}
+        m_responseLock(responseLock),
+        m_deferredPuts(nullptr) {}
 
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl);
   virtual void reset();
 
+  /**
+   * Collect the values to be added to the local cache in puts, to be applied
+   * by the caller, rather than putting them as chunks arrive.
+   */
+  void deferLocalPuts(MapPutBatch* puts) { m_deferredPuts = puts; }
+
   void add(const ChunkedGetAllResponse* other);
   bool getAddToLocalCache() { return m_addToLocalCache; }
   std::shared_ptr<HashMapOfCacheable> getValues() { return m_values; }
@@ -33,68 +33,24 @@ namespace apache {
 namespace geode {
 namespace client {
 
-TombstoneExpiryHandler::TombstoneExpiryHandler(
-    std::shared_ptr<TombstoneEntry> entryPtr, TombstoneList* tombstoneList,
-    std::chrono::milliseconds duration, CacheImpl* cacheImpl)
-    : m_entryPtr(entryPtr),
-      m_duration(duration),
-      m_cacheImpl(cacheImpl),
-      m_tombstoneList(tombstoneList) {}
+TombstoneExpiryHandler::TombstoneExpiryHandler(TombstoneList* tombstoneList)
+    : m_tombstoneList(tombstoneList) {}
 
 int TombstoneExpiryHandler::handle_timeout(const ACE_Time_Value&, const void*) {
-  std::shared_ptr<CacheableKey> key;
-  m_entryPtr->getEntry()->getKeyI(key);
-  auto creationTime = m_entryPtr->getTombstoneCreationTime();
-  auto curr_time = TombstoneEntry::clock::now();
-  auto expiryTaskId = m_entryPtr->getExpiryTaskId();
-  auto sec = curr_time - creationTime - m_duration;
+  LOGDEBUG("Entered tombstone expiry task handler");
   try {
-    using apache::geode::internal::chrono::duration::to_string;
-    LOGDEBUG(
-        "Entered entry expiry task handler for tombstone of key [%s]: "
-        "%s,%s,%s,%s",
-        Utils::nullSafeToString(key).c_str(),
-        to_string(curr_time.time_since_epoch()).c_str(),
-        to_string(creationTime.time_since_epoch()).c_str(),
-        to_string(m_duration).c_str(), to_string(sec).c_str());
-    if (sec >= std::chrono::seconds::zero()) {
-      DoTheExpirationAction(key);
-    } else {
-      // reset the task after
-      // (lastAccessTime + entryExpiryDuration - curr_time) in seconds
-      LOGDEBUG(
-          "Resetting expiry task %s later for key "
-          "[%s]",
-          to_string(-sec).c_str(), Utils::nullSafeToString(key).c_str());
-      m_cacheImpl->getExpiryTaskManager().resetTask(
-          m_entryPtr->getExpiryTaskId(), -sec);
-      return 0;
-    }
+    m_tombstoneList->sweep();
   } catch (...) {
     // Ignore whatever exception comes
   }
-  LOGDEBUG("Removing expiry task for key [%s]",
-           Utils::nullSafeToString(key).c_str());
-  // we now delete the handler in GF_Timer_Heap_ImmediateReset_T
-  // and always return success.
-  m_cacheImpl->getExpiryTaskManager().resetTask(expiryTaskId, 0);
   return 0;
 }
 
 int TombstoneExpiryHandler::handle_close(ACE_HANDLE, ACE_Reactor_Mask) {
-  // we now delete the handler in GF_Timer_Heap_ImmediateReset_T
+  // deleted by the tombstone list once it has cancelled the task
   return 0;
 }
 
-inline void TombstoneExpiryHandler::DoTheExpirationAction(
-    const std::shared_ptr<CacheableKey>& key) {
-  LOGDEBUG(
-      "EntryExpiryHandler::DoTheExpirationAction LOCAL_DESTROY "
-      "for region entry with key %s",
-      Utils::nullSafeToString(key).c_str());
-  m_tombstoneList->removeEntryFromMapSegment(key);
-}
-
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
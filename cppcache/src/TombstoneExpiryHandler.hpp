@@ -34,36 +34,20 @@ namespace client {
 /**
  * @class TombstoneExpiryHandler TombstoneExpiryHandler.hpp
  *
- * The task object which contains the handler which gets triggered
- * when a tombstone expires.
+ * The periodic task object which reaps the expired generations of a
+ * tombstone list.
  *
  */
 class APACHE_GEODE_EXPORT TombstoneExpiryHandler : public ACE_Event_Handler {
  public:
-  TombstoneExpiryHandler(std::shared_ptr<TombstoneEntry> entryPtr,
-                         TombstoneList* tombstoneList,
-                         std::chrono::milliseconds duration,
-                         CacheImpl* cacheImpl);
+  explicit TombstoneExpiryHandler(TombstoneList* tombstoneList);
 
   int handle_timeout(const ACE_Time_Value& current_time,
                      const void* arg) override;
 
   int handle_close(ACE_HANDLE handle, ACE_Reactor_Mask close_mask) override;
 
-  void setTombstoneEntry(std::shared_ptr<TombstoneEntry> entryPtr) {
-    m_entryPtr = entryPtr;
-  }
-
  private:
-  // The entry contained in the tombstone list
-  std::shared_ptr<TombstoneEntry> m_entryPtr;
-  // Duration after which the task should be reset in case of
-  // modification.
-  std::chrono::milliseconds m_duration;
-  CacheImpl* m_cacheImpl;
-  // perform the actual expiration action
-  void DoTheExpirationAction(const std::shared_ptr<CacheableKey>& key);
-
   TombstoneList* m_tombstoneList;
 };
 }  // namespace client
@@ -17,6 +17,7 @@
 
 #include "TombstoneList.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "MapSegment.hpp"
@@ -28,51 +29,59 @@ namespace client {
 
 #define SIZEOF_PTR (sizeof(void*))
 #define SIZEOF_SHAREDPTR (SIZEOF_PTR + 4)
-// 3 variables in expiry handler, two variables for ace_reactor expiry, one
-// pointer to expiry handle
-#define SIZEOF_EXPIRYHANDLER ((SIZEOF_PTR * 5) + 4)
-#define SIZEOF_TOMBSTONEENTRY (SIZEOF_PTR + 8 + 8)
+#define SIZEOF_TOMBSTONEENTRY (SIZEOF_PTR + 8)
 // one shared ptr for map entry, one sharedPtr for tombstone entry, one
-// sharedptr for key, one shared ptr for tombstone value,
-// one ptr for tombstone list, one ptr for mapsegment, one tombstone entry
+// sharedptr for key, one shared ptr for tombstone value, one shared ptr for
+// the key in its generation, one ptr for mapsegment, one tombstone entry
 #define SIZEOF_TOMBSTONELISTENTRY \
-  (SIZEOF_SHAREDPTR * 4 + SIZEOF_PTR * 2 + SIZEOF_TOMBSTONEENTRY)
-#define SIZEOF_TOMBSTONEOVERHEAD \
-  (SIZEOF_EXPIRYHANDLER + SIZEOF_TOMBSTONELISTENTRY)
-
-ExpiryTaskManager::id_type TombstoneList::getExpiryTask(
-    TombstoneExpiryHandler** handler) {
+  (SIZEOF_SHAREDPTR * 5 + SIZEOF_PTR + SIZEOF_TOMBSTONEENTRY)
+#define SIZEOF_TOMBSTONEOVERHEAD (SIZEOF_TOMBSTONELISTENTRY)
+
+namespace {
+// A generation is reaped by the first sweep at least the timeout plus one
+// span after it started, and sweeps run every span, so a tombstone lives
+// for between the timeout and the timeout plus two generation spans.
+constexpr int kGenerationsPerTimeout = 8;
+constexpr std::chrono::milliseconds kMinGenerationSpan(1000);
+}  // namespace
+
+TombstoneList::TombstoneList(MapSegment* mapSegment, CacheImpl* cacheImpl)
+    : m_nextGeneration(0),
+      m_tombstoneTimeout(cacheImpl->getDistributedSystem()
+                             .getSystemProperties()
+                             .tombstoneTimeout()),
+      m_generationSpan(std::max(m_tombstoneTimeout / kGenerationsPerTimeout,
+                                kMinGenerationSpan)),
+      m_sweepHandler(nullptr),
+      m_sweepTaskId(-1),
+      m_mapSegment(mapSegment),
+      m_cacheImpl(cacheImpl) {}
+
+void TombstoneList::add(const std::shared_ptr<MapEntryImpl>& entry) {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  auto duration = m_cacheImpl->getDistributedSystem()
-                      .getSystemProperties()
-                      .tombstoneTimeout();
-
-  auto tombstoneEntryPtr = std::make_shared<TombstoneEntry>(nullptr);
-  *handler = new TombstoneExpiryHandler(tombstoneEntryPtr, this, duration,
-                                        m_cacheImpl);
-  tombstoneEntryPtr->setHandler(*handler);
-  auto id = m_cacheImpl->getExpiryTaskManager().scheduleExpiryTask(
-      *handler, duration, std::chrono::seconds::zero());
-  return id;
-}
+  auto now = clock::now();
+  if (m_generations.empty() ||
+      now - m_generations.back().start >= m_generationSpan) {
+    m_generations.push_back(Generation{m_nextGeneration++, now, {}});
+  }
+  auto& generation = m_generations.back();
 
-void TombstoneList::add(const std::shared_ptr<MapEntryImpl>& entry,
-                        TombstoneExpiryHandler* handler,
-                        ExpiryTaskManager::id_type taskid) {
-  // This function is not guarded as all functions of this class are called from
-  // MapSegment read TombstoneTImeout from systemProperties.
-  auto tombstoneEntryPtr = std::make_shared<TombstoneEntry>(entry);
-  handler->setTombstoneEntry(tombstoneEntryPtr);
-  tombstoneEntryPtr->setHandler(handler);
   std::shared_ptr<CacheableKey> key;
   entry->getKeyI(key);
-
-  tombstoneEntryPtr->setExpiryTaskId(taskid);
-  m_tombstoneMap[key] = tombstoneEntryPtr;
+  m_tombstoneMap[key] = std::make_shared<TombstoneEntry>(entry, generation.id);
+  generation.keys.push_back(key);
   m_cacheImpl->getCachePerfStats().incTombstoneCount();
   auto tombstonesize = key->objectSize() + SIZEOF_TOMBSTONEOVERHEAD;
   m_cacheImpl->getCachePerfStats().incTombstoneSize(tombstonesize);
+
+  // The sweep is scheduled with the first tombstone and runs every
+  // generation span until it finds the list empty.
+  if (m_sweepTaskId == -1) {
+    m_sweepHandler = new TombstoneExpiryHandler(this);
+    m_sweepTaskId = m_cacheImpl->getExpiryTaskManager().scheduleExpiryTask(
+        m_sweepHandler, m_generationSpan, m_generationSpan);
+  }
 }
 
 // Reaps the tombstones which have been gc'ed on server.
@@ -82,27 +91,21 @@ void TombstoneList::add(const std::shared_ptr<MapEntryImpl>& entry,
 void TombstoneList::reapTombstones(std::map<uint16_t, int64_t>& gcVersions) {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  std::unordered_set<std::shared_ptr<CacheableKey>,
-                     dereference_hash<std::shared_ptr<CacheableKey>>,
-                     dereference_equal_to<std::shared_ptr<CacheableKey>>>
-      tobeDeleted;
-  for (const auto& queIter : m_tombstoneMap) {
-    auto const& mapIter = gcVersions.find(
-        queIter.second->getEntry()->getVersionStamp().getMemberId());
-
-    if (mapIter == gcVersions.end()) {
-      continue;
+  int32_t reaped = 0;
+  int64_t tombstonesize = 0;
+  for (auto queIter = m_tombstoneMap.begin();
+       queIter != m_tombstoneMap.end();) {
+    auto& versionStamp = queIter->second->getEntry()->getVersionStamp();
+    auto const& mapIter = gcVersions.find(versionStamp.getMemberId());
+    if (mapIter != gcVersions.end() &&
+        mapIter->second >= versionStamp.getRegionVersion()) {
+      queIter = unguardedReap(queIter, tombstonesize);
+      ++reaped;
+    } else {
+      ++queIter;
     }
-
-    auto const& version = (*mapIter).second;
-    if (version >=
-        queIter.second->getEntry()->getVersionStamp().getRegionVersion()) {
-      tobeDeleted.insert(queIter.first);
-    }
-  }
-  for (const auto& itr : tobeDeleted) {
-    unguardedRemoveEntryFromMapSegment(itr);
   }
+  decTombstoneStats(reaped, tombstonesize);
 }
 
 // Reaps the tombstones whose keys are specified in the hash set .
@@ -110,21 +113,75 @@ void TombstoneList::reapTombstones(
     std::shared_ptr<CacheableHashSet> removedKeys) {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  for (auto queIter = removedKeys->begin(); queIter != removedKeys->end();
-       ++queIter) {
-    unguardedRemoveEntryFromMapSegment(*queIter);
+  int32_t reaped = 0;
+  int64_t tombstonesize = 0;
+  for (const auto& key : *removedKeys) {
+    auto queIter = m_tombstoneMap.find(key);
+    if (queIter != m_tombstoneMap.end()) {
+      unguardedReap(queIter, tombstonesize);
+      ++reaped;
+    }
   }
+  decTombstoneStats(reaped, tombstonesize);
 }
+
+void TombstoneList::reapExpiredTombstones(time_point now) {
+  // This function is not guarded as all functions of this class are called from
+  // MapSegment
+  int32_t reaped = 0;
+  int64_t tombstonesize = 0;
+  // a generation has expired once its youngest possible tombstone has
+  while (!m_generations.empty() &&
+         now - m_generations.front().start >=
+             m_tombstoneTimeout + m_generationSpan) {
+    const auto& generation = m_generations.front();
+    for (const auto& key : generation.keys) {
+      auto queIter = m_tombstoneMap.find(key);
+      if (queIter != m_tombstoneMap.end() &&
+          queIter->second->getGeneration() == generation.id) {
+        unguardedReap(queIter, tombstonesize);
+        ++reaped;
+      }
+    }
+    m_generations.pop_front();
+  }
+  decTombstoneStats(reaped, tombstonesize);
+}
+
+void TombstoneList::sweepExpiredTombstones(time_point now) {
+  // This function is not guarded as all functions of this class are called from
+  // MapSegment
+  reapExpiredTombstones(now);
+  if (m_generations.empty() && m_sweepTaskId != -1) {
+    // A zero interval makes this run the task's last; the expiry task
+    // manager deletes the handler once it returns. Cancelling here instead
+    // would free the node of the timer being dispatched.
+    m_cacheImpl->getExpiryTaskManager().resetTask(
+        m_sweepTaskId, std::chrono::seconds::zero());
+    m_sweepHandler = nullptr;
+    m_sweepTaskId = -1;
+  }
+}
+
 // Call this when the lock of MapSegment has not been taken
-void TombstoneList::removeEntryFromMapSegment(
-    std::shared_ptr<CacheableKey> key) {
-  m_mapSegment->removeActualEntry(key, false);
+void TombstoneList::sweep() { m_mapSegment->reapExpiredTombstones(); }
+
+// Removes the tombstone and its entry from the MapSegment, accumulating its
+// size for a single stats update by the caller.
+TombstoneList::TombstoneMap::iterator TombstoneList::unguardedReap(
+    TombstoneMap::iterator iter, int64_t& tombstoneSize) {
+  const auto& key = iter->first;
+  tombstoneSize += key->objectSize() + SIZEOF_TOMBSTONEOVERHEAD;
+  m_mapSegment->unguardedEraseEntry(key);
+  return m_tombstoneMap.erase(iter);
 }
 
-// Call this when the lock of MapSegment has already been taken
-void TombstoneList::unguardedRemoveEntryFromMapSegment(
-    std::shared_ptr<CacheableKey> key) {
-  m_mapSegment->unguardedRemoveActualEntry(key);
+void TombstoneList::decTombstoneStats(int32_t count, int64_t tombstoneSize) {
+  if (count > 0) {
+    auto& cachePerfStats = m_cacheImpl->getCachePerfStats();
+    cachePerfStats.decTombstoneCount(count);
+    cachePerfStats.decTombstoneSize(tombstoneSize);
+  }
 }
 
 bool TombstoneList::exists(const std::shared_ptr<CacheableKey>& key) const {
@@ -135,48 +192,42 @@ bool TombstoneList::exists(const std::shared_ptr<CacheableKey>& key) const {
 }
 
 void TombstoneList::eraseEntryFromTombstoneList(
-    const std::shared_ptr<CacheableKey>& key, bool cancelTask) {
+    const std::shared_ptr<CacheableKey>& key) {
   // This function is not guarded as all functions of this class are called from
-  // MapSegment
-  if (exists(key)) {
-    if (cancelTask) {
-      m_cacheImpl->getExpiryTaskManager().cancelTask(
-          m_tombstoneMap[key]->getExpiryTaskId());
-      delete m_tombstoneMap[key]->getHandler();
-    }
-
+  // MapSegment. The key stays in its generation and is skipped when that is
+  // reaped.
+  if (key && m_tombstoneMap.erase(key) > 0) {
     m_cacheImpl->getCachePerfStats().decTombstoneCount();
     auto tombstonesize = key->objectSize() + SIZEOF_TOMBSTONEOVERHEAD;
     m_cacheImpl->getCachePerfStats().decTombstoneSize(tombstonesize);
-    m_tombstoneMap.erase(key);
   }
 }
 
-ExpiryTaskManager::id_type
-TombstoneList::eraseEntryFromTombstoneListWithoutCancelTask(
-    const std::shared_ptr<CacheableKey>& key,
-    TombstoneExpiryHandler*& handler) {
+void TombstoneList::clear() {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  ExpiryTaskManager::id_type taskid = -1;
-  if (exists(key)) {
-    taskid = m_tombstoneMap[key]->getExpiryTaskId();
-    handler = m_tombstoneMap[key]->getHandler();
-    m_cacheImpl->getCachePerfStats().decTombstoneCount();
-    auto tombstonesize = key->objectSize() + SIZEOF_TOMBSTONEOVERHEAD;
-    m_cacheImpl->getCachePerfStats().decTombstoneSize(tombstonesize);
-    m_tombstoneMap.erase(key);
+  if (m_tombstoneMap.empty()) {
+    m_generations.clear();
+    return;
+  }
+  int64_t tombstonesize = 0;
+  for (const auto& queIter : m_tombstoneMap) {
+    tombstonesize += queIter.first->objectSize() + SIZEOF_TOMBSTONEOVERHEAD;
   }
-  return taskid;
+  decTombstoneStats(static_cast<int32_t>(m_tombstoneMap.size()),
+                    tombstonesize);
+  m_tombstoneMap.clear();
+  m_generations.clear();
 }
 
 void TombstoneList::cleanUp() {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
-  auto& expiryTaskManager = m_cacheImpl->getExpiryTaskManager();
-  for (const auto& queIter : m_tombstoneMap) {
-    expiryTaskManager.cancelTask(queIter.second->getExpiryTaskId());
-    delete queIter.second->getHandler();
+  if (m_sweepTaskId != -1) {
+    m_cacheImpl->getExpiryTaskManager().cancelTask(m_sweepTaskId);
+    delete m_sweepHandler;
+    m_sweepHandler = nullptr;
+    m_sweepTaskId = -1;
   }
 }
 
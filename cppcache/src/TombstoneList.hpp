@@ -21,9 +21,11 @@
 #define GEODE_TOMBSTONELIST_H_
 
 #include <chrono>
-#include <list>
+#include <deque>
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <geode/CacheableBuiltins.hpp>
 #include <geode/internal/functional.hpp>
@@ -39,38 +41,38 @@ class TombstoneExpiryHandler;
 
 class TombstoneEntry {
  public:
-  using clock = std::chrono::steady_clock;
-  using time_point = clock::time_point;
-
-  explicit TombstoneEntry(const std::shared_ptr<MapEntryImpl>& entry)
-      : m_entry(entry),
-        m_tombstoneCreationTime(TombstoneEntry::clock::now()),
-        m_expiryTaskId(0),
-        m_handler(nullptr) {}
+  TombstoneEntry(const std::shared_ptr<MapEntryImpl>& entry,
+                 uint64_t generation)
+      : m_entry(entry), m_generation(generation) {}
   virtual ~TombstoneEntry() {}
   std::shared_ptr<MapEntryImpl> getEntry() { return m_entry; }
-  time_point getTombstoneCreationTime() { return m_tombstoneCreationTime; }
-  ExpiryTaskManager::id_type getExpiryTaskId() { return m_expiryTaskId; }
-  void setExpiryTaskId(ExpiryTaskManager::id_type expiryTaskId) {
-    m_expiryTaskId = expiryTaskId;
-  }
-  TombstoneExpiryHandler* getHandler() { return m_handler; };
-  void setHandler(TombstoneExpiryHandler* handler) { m_handler = handler; };
+  uint64_t getGeneration() const { return m_generation; }
 
  private:
   std::shared_ptr<MapEntryImpl> m_entry;
-  time_point m_tombstoneCreationTime;
-  ExpiryTaskManager::id_type m_expiryTaskId;
-  TombstoneExpiryHandler* m_handler;
+  // id of the generation of the owning list this tombstone was created in
+  uint64_t m_generation;
 };
 
+/**
+ * The tombstones of a single MapSegment. Besides being indexed by key,
+ * tombstones are kept in FIFO generations by creation time, each spanning a
+ * fraction of the tombstone timeout. A single periodic task per list reaps
+ * every generation that has entirely outlived the timeout, instead of each
+ * tombstone scheduling its own expiry task. A tombstone may therefore
+ * outlive the timeout by up to two generation spans: one for its
+ * generation to fill, one for the next sweep to come round. The task is
+ * scheduled with the first tombstone and retires itself on the first sweep
+ * that finds no generation left, whether reaped or cleared.
+ */
 class TombstoneList {
  public:
-  TombstoneList(MapSegment* mapSegment, CacheImpl* cacheImpl)
-      : m_mapSegment(mapSegment), m_cacheImpl(cacheImpl) {}
+  using clock = std::chrono::steady_clock;
+  using time_point = clock::time_point;
+
+  TombstoneList(MapSegment* mapSegment, CacheImpl* cacheImpl);
   virtual ~TombstoneList() { cleanUp(); }
-  void add(const std::shared_ptr<MapEntryImpl>& entry,
-           TombstoneExpiryHandler* handler, ExpiryTaskManager::id_type taskID);
+  void add(const std::shared_ptr<MapEntryImpl>& entry);
 
   // Reaps the tombstones which have been gc'ed on server.
   // A map that has identifier for ClientProxyMembershipID as key
@@ -78,24 +80,56 @@ class TombstoneList {
   // value is passed as paramter
   void reapTombstones(std::map<uint16_t, int64_t>& gcVersions);
   void reapTombstones(std::shared_ptr<CacheableHashSet> removedKeys);
-  void eraseEntryFromTombstoneList(const std::shared_ptr<CacheableKey>& key,
-                                   bool cancelTask = true);
-  ExpiryTaskManager::id_type eraseEntryFromTombstoneListWithoutCancelTask(
-      const std::shared_ptr<CacheableKey>& key,
-      TombstoneExpiryHandler*& handler);
+
+  /**
+   * Reaps the tombstones of every generation started at least the tombstone
+   * timeout plus one generation span before now, in one pass.
+   */
+  void reapExpiredTombstones(time_point now);
+
+  /**
+   * Run by the sweep task: reaps expired tombstones, then retires the task
+   * if no generation is left. The next tombstone added schedules a new one.
+   */
+  void sweepExpiredTombstones(time_point now);
+  void eraseEntryFromTombstoneList(const std::shared_ptr<CacheableKey>& key);
   void cleanUp();
-  ExpiryTaskManager::id_type getExpiryTask(TombstoneExpiryHandler** handler);
+
+  /**
+   * Drops every tombstone, updating the stats once for all of them.
+   */
+  void clear();
   bool exists(const std::shared_ptr<CacheableKey>& key) const;
+  bool isSweepScheduled() const { return m_sweepTaskId != -1; }
 
  private:
-  void removeEntryFromMapSegment(std::shared_ptr<CacheableKey> key);
-  void unguardedRemoveEntryFromMapSegment(std::shared_ptr<CacheableKey> key);
   typedef std::unordered_map<
       std::shared_ptr<CacheableKey>, std::shared_ptr<TombstoneEntry>,
       dereference_hash<std::shared_ptr<CacheableKey>>,
       dereference_equal_to<std::shared_ptr<CacheableKey>>>
       TombstoneMap;
+
+  struct Generation {
+    uint64_t id;
+    time_point start;
+    // may hold keys whose tombstone has since been removed or recreated
+    // in a later generation; these are skipped when the generation is reaped
+    std::vector<std::shared_ptr<CacheableKey>> keys;
+  };
+
+  // Call this when the lock of MapSegment has not been taken
+  void sweep();
+  TombstoneMap::iterator unguardedReap(TombstoneMap::iterator iter,
+                                       int64_t& tombstoneSize);
+  void decTombstoneStats(int32_t count, int64_t tombstoneSize);
+
   TombstoneMap m_tombstoneMap;
+  std::deque<Generation> m_generations;
+  uint64_t m_nextGeneration;
+  std::chrono::milliseconds m_tombstoneTimeout;
+  std::chrono::milliseconds m_generationSpan;
+  TombstoneExpiryHandler* m_sweepHandler;
+  ExpiryTaskManager::id_type m_sweepTaskId;
   MapSegment* m_mapSegment;
   CacheImpl* m_cacheImpl;
   friend class TombstoneExpiryHandler;
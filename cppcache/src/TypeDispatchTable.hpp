@@ -0,0 +1,138 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_TYPEDISPATCHTABLE_H_
+#define GEODE_TYPEDISPATCHTABLE_H_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <geode/Serializable.hpp>
+
+#include "NonCopyable.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Maps type ids to the factories creating their instances, for the
+ * deserialization of every object read from the wire.
+ *
+ * Ids in [MinId, MaxId) live in a dense array read without locking; others
+ * fall back to a map under a mutex. A binding is published by replacing the
+ * slot's pointer, and replaced factories are kept until the table is
+ * destroyed, since a reader may still be calling them. Bindings change
+ * rarely, mostly while the cache is created, so little is ever kept.
+ */
+template <typename Id, int32_t MinId, int32_t MaxId>
+class TypeDispatchTable : private NonCopyable {
+ public:
+  TypeDispatchTable() {
+    for (auto& slot : m_slots) {
+      slot.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  ~TypeDispatchTable() noexcept = default;
+
+  /** Returns the factory bound to id, or nullptr if there is none. */
+  inline const TypeFactoryMethod* find(Id id) const {
+    const auto index = static_cast<int32_t>(id);
+    if (index >= MinId && index < MaxId) {
+      return m_slots[index - MinId].load(std::memory_order_acquire);
+    }
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    const auto found = m_others.find(index);
+    return found == m_others.end() ? nullptr : found->second;
+  }
+
+  /** Binds func to id; returns false if id is already bound. */
+  bool bind(Id id, TypeFactoryMethod func) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (unguardedFind(id) != nullptr) {
+      return false;
+    }
+    publish(id, keep(std::move(func)));
+    return true;
+  }
+
+  void rebind(Id id, TypeFactoryMethod func) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    publish(id, keep(std::move(func)));
+  }
+
+  void unbind(Id id) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    publish(id, nullptr);
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    for (auto& slot : m_slots) {
+      slot.store(nullptr, std::memory_order_release);
+    }
+    m_others.clear();
+  }
+
+ private:
+  const TypeFactoryMethod* unguardedFind(Id id) const {
+    const auto index = static_cast<int32_t>(id);
+    if (index >= MinId && index < MaxId) {
+      return m_slots[index - MinId].load(std::memory_order_relaxed);
+    }
+    const auto found = m_others.find(index);
+    return found == m_others.end() ? nullptr : found->second;
+  }
+
+  const TypeFactoryMethod* keep(TypeFactoryMethod func) {
+    if (!func) {
+      return nullptr;
+    }
+    m_factories.emplace_back(new TypeFactoryMethod(std::move(func)));
+    return m_factories.back().get();
+  }
+
+  void publish(Id id, const TypeFactoryMethod* func) {
+    const auto index = static_cast<int32_t>(id);
+    if (index >= MinId && index < MaxId) {
+      m_slots[index - MinId].store(func, std::memory_order_release);
+    } else if (func == nullptr) {
+      m_others.erase(index);
+    } else {
+      m_others[index] = func;
+    }
+  }
+
+  std::array<std::atomic<const TypeFactoryMethod*>, MaxId - MinId> m_slots;
+  std::unordered_map<int32_t, const TypeFactoryMethod*> m_others;
+  std::vector<std::unique_ptr<const TypeFactoryMethod>> m_factories;
+  mutable std::mutex m_mutex;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_TYPEDISPATCHTABLE_H_
@@ -246,8 +246,11 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
 
   if (hasObjects) {
     std::shared_ptr<CacheableKey> key;
-    std::shared_ptr<VersionTag> versionTag;
     std::shared_ptr<Cacheable> value;
+    // the chunk's entries go in the local cache together once it is read,
+    // unless the caller collects them to put later
+    MapPutBatch chunkPuts;
+    auto puts = m_deferredPuts != nullptr ? m_deferredPuts : &chunkPuts;
 
     for (int32_t index = 0; index < len; ++index) {
       if (m_keys != nullptr && !m_hasKeys) {
@@ -263,34 +266,36 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
       const auto& iter = m_values->find(key);
       value = iter == m_values->end() ? nullptr : iter->second;
       if (m_byteArray[index] != 3) {  // 3 - key not found on server
-        std::shared_ptr<Cacheable> oldValue;
         if (m_addToLocalCache) {
-          int updateCount = -1;
-          versionTag = m_versionTags[index];
-
-          GfErrType err =
-              m_region->putLocal("getAll", false, key, value, oldValue, true,
-                                 updateCount, m_destroyTracker, versionTag);
-          if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
-            LOGDEBUG(
-                "VersionedCacheableObjectPartList::fromData putLocal for key [%s] failed because the cache \
-                  already contains an entry with higher version.",
-                Utils::nullSafeToString(key).c_str());
-            // replace the value with higher version tag
-            (*m_values)[key] = oldValue;
-          }
-        }       // END::m_addToLocalCache
-        else {  // m_addToLocalCache = false
+          puts->keys.push_back(key);
+          puts->values.push_back(value);
+          puts->versionTags.push_back(m_versionTags[index]);
+        } else {  // m_addToLocalCache = false
+          std::shared_ptr<Cacheable> oldValue;
           m_region->getEntry(key, oldValue);
           // if value has already been received via notification or put by
           // another thread, then return that
           if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
             // replace the value with new value
-            (*m_values)[key] = oldValue;
+            (*m_values)[key] = m_region->fromStoredValue(oldValue);
           }
         }
       }
     }
+
+    m_region->putLocalBatch("getAll", chunkPuts, m_destroyTracker);
+    for (size_t index = 0; index < chunkPuts.results.size(); ++index) {
+      const auto& result = chunkPuts.results[index];
+      if (result.err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+        const auto& chunkKey = chunkPuts.keys[index];
+        LOGDEBUG(
+            "VersionedCacheableObjectPartList::fromData putLocal for key [%s] failed because the cache \
+                  already contains an entry with higher version.",
+            Utils::nullSafeToString(chunkKey).c_str());
+        // replace the value with higher version tag
+        (*m_values)[chunkKey] = m_region->fromStoredValue(result.oldValue);
+      }
+    }
   }
   if (m_keysOffset != nullptr) *m_keysOffset += len;
   if (valuesNULL) m_values = nullptr;
@@ -32,6 +32,7 @@ namespace geode {
 namespace client {
 
 class ThinClientRegion;
+struct MapPutBatch;
 
 /**
  * Implement an immutable list of object parts that encapsulates an object,
@@ -54,6 +55,7 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
   uint16_t m_endpointMemId;
   std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> m_tempKeys;
   std::recursive_mutex& m_responseLock;
+  MapPutBatch* m_deferredPuts = nullptr;
 
   static const uint8_t FLAG_NULL_TAG;
   static const uint8_t FLAG_FULL_TAG;
@@ -153,6 +155,12 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
 
   inline uint16_t getEndpointMemId() { return m_endpointMemId; }
 
+  /**
+   * Collect the entries to be added to the local cache in puts rather than
+   * putting them while reading.
+   */
+  inline void deferLocalPuts(MapPutBatch* puts) { m_deferredPuts = puts; }
+
   std::vector<std::shared_ptr<VersionTag>>& getVersionedTagptr() {
     return m_versionTags;
   }
@@ -99,6 +99,22 @@ AtomicStatisticsImpl::AtomicStatisticsImpl(StatisticsType* typeArg,
     } else {
       doubleStorage = nullptr;
     }
+
+    auto descriptors = statsType->getStatistics();
+    for (int32_t i = 0; i < statsType->getDescriptorsCount(); i++) {
+      auto descriptor = dynamic_cast<StatisticDescriptorImpl*>(descriptors[i]);
+      if (!descriptor->isStriped()) {
+        continue;
+      }
+      auto& stripes =
+          descriptor->getTypeCode() == INT_TYPE ? intStripes : longStripes;
+      if (stripes.empty()) {
+        stripes.resize(descriptor->getTypeCode() == INT_TYPE ? intCount
+                                                              : longCount);
+      }
+      stripes[descriptor->getId()] =
+          std::unique_ptr<StripedCounter>(new StripedCounter());
+    }
   } catch (...) {
     statsType = nullptr;  // Will be deleted by the class who calls this ctor
   }
@@ -143,6 +159,10 @@ void AtomicStatisticsImpl::_setInt(int32_t offset, int32_t value) {
         offset);
     throw IllegalArgumentException(s);
   }
+  if (!intStripes.empty() && intStripes[offset]) {
+    intStripes[offset]->set(value);
+    return;
+  }
   intStorage[offset] = value;
 }
 
@@ -156,6 +176,10 @@ void AtomicStatisticsImpl::_setLong(int32_t offset, int64_t value) {
     throw IllegalArgumentException(s);
   }
 
+  if (!longStripes.empty() && longStripes[offset]) {
+    longStripes[offset]->set(value);
+    return;
+  }
   longStorage[offset] = value;
 }
 
@@ -181,6 +205,9 @@ int32_t AtomicStatisticsImpl::_getInt(int32_t offset) const {
     throw IllegalArgumentException(s);
   }
 
+  if (!intStripes.empty() && intStripes[offset]) {
+    return static_cast<int32_t>(intStripes[offset]->sum());
+  }
   return intStorage[offset];
 }
 
@@ -192,6 +219,9 @@ int64_t AtomicStatisticsImpl::_getLong(int32_t offset) const {
         offset);
     throw IllegalArgumentException(s);
   }
+  if (!longStripes.empty() && longStripes[offset]) {
+    return longStripes[offset]->sum();
+  }
   return longStorage[offset];
 }
 
@@ -247,6 +277,10 @@ int32_t AtomicStatisticsImpl::_incInt(int32_t offset, int32_t delta) {
     throw IllegalArgumentException(s);
   }
 
+  if (!intStripes.empty() && intStripes[offset]) {
+    intStripes[offset]->add(delta);
+    return delta;
+  }
   return (intStorage[offset] += delta);
 }
 
@@ -257,6 +291,10 @@ int64_t AtomicStatisticsImpl::_incLong(int32_t offset, int64_t delta) {
         " of the Statistic Descriptor is not valid.");
   }
 
+  if (!longStripes.empty() && longStripes[offset]) {
+    longStripes[offset]->add(delta);
+    return delta;
+  }
   return (longStorage[offset] += delta);
 }
 
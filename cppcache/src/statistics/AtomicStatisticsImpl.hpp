@@ -21,7 +21,9 @@
 #define GEODE_STATISTICS_ATOMICSTATISTICSIMPL_H_
 
 #include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <geode/internal/geode_globals.hpp>
 
@@ -29,6 +31,7 @@
 #include "Statistics.hpp"
 #include "StatisticsFactory.hpp"
 #include "StatisticsTypeImpl.hpp"
+#include "StripedCounter.hpp"
 
 /** @file
  */
@@ -70,6 +73,14 @@ class AtomicStatisticsImpl : public Statistics, private client::NonCopyable {
   /** An array containing the values of the double statistics */
   std::atomic<double>* doubleStorage;
 
+  /** The counters of the striped int32_t statistics, indexed like
+   * intStorage; empty if the type has no striped int32_t statistics */
+  std::vector<std::unique_ptr<StripedCounter>> intStripes;
+
+  /** The counters of the striped int64_t statistics, indexed like
+   * longStorage; empty if the type has no striped int64_t statistics */
+  std::vector<std::unique_ptr<StripedCounter>> longStripes;
+
   ///////////////////////Private Methods//////////////////////////
   bool isOpen() const;
 
@@ -216,6 +216,20 @@ StatisticDescriptor* GeodeStatisticsFactory::createDoubleCounter(
                                                       largerBetter);
 }
 
+StatisticDescriptor* GeodeStatisticsFactory::createStripedIntCounter(
+    const std::string& name, const std::string& description,
+    const std::string& units, bool largerBetter) {
+  return StatisticDescriptorImpl::createStripedIntCounter(name, description,
+                                                          units, largerBetter);
+}
+
+StatisticDescriptor* GeodeStatisticsFactory::createStripedLongCounter(
+    const std::string& name, const std::string& description,
+    const std::string& units, bool largerBetter) {
+  return StatisticDescriptorImpl::createStripedLongCounter(
+      name, description, units, largerBetter);
+}
+
 StatisticDescriptor* GeodeStatisticsFactory::createIntGauge(
     const std::string& name, const std::string& description,
     const std::string& units, bool largerBetter) {
@@ -116,6 +116,16 @@ class GeodeStatisticsFactory : public StatisticsFactory {
                                            const std::string& units,
                                            bool largerBetter) override;
 
+  StatisticDescriptor* createStripedIntCounter(const std::string& name,
+                                               const std::string& description,
+                                               const std::string& units,
+                                               bool largerBetter) override;
+
+  StatisticDescriptor* createStripedLongCounter(const std::string& name,
+                                                const std::string& description,
+                                                const std::string& units,
+                                                bool largerBetter) override;
+
   StatisticDescriptor* createIntGauge(const std::string& name,
                                       const std::string& description,
                                       const std::string& units,
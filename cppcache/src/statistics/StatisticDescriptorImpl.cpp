@@ -50,6 +50,7 @@ StatisticDescriptorImpl::StatisticDescriptorImpl(
       unit(statUnit),
       isStatCounter(statIsStatCounter),
       isStatLargerBetter(statIsStatLargerBetter),
+      isStatStriped(false),
       id(-1),
       descriptorType(statDescriptorType) {}
 
@@ -96,6 +97,24 @@ StatisticDescriptor* StatisticDescriptorImpl::createDoubleCounter(
   return sdi;
 }
 
+StatisticDescriptor* StatisticDescriptorImpl::createStripedIntCounter(
+    const std::string& name, const std::string& description,
+    const std::string& units, bool isLargerBetter) {
+  auto sdi = new StatisticDescriptorImpl(name, INT_TYPE, description, units,
+                                         true, isLargerBetter);
+  sdi->isStatStriped = true;
+  return sdi;
+}
+
+StatisticDescriptor* StatisticDescriptorImpl::createStripedLongCounter(
+    const std::string& name, const std::string& description,
+    const std::string& units, bool isLargerBetter) {
+  auto sdi = new StatisticDescriptorImpl(name, LONG_TYPE, description, units,
+                                         true, isLargerBetter);
+  sdi->isStatStriped = true;
+  return sdi;
+}
+
 StatisticDescriptor* StatisticDescriptorImpl::createIntGauge(
     const std::string& name, const std::string& description,
     const std::string& units, bool isLargerBetter) {
@@ -206,6 +225,8 @@ FieldType StatisticDescriptorImpl::getTypeCode() const {
   return descriptorType;
 }
 
+bool StatisticDescriptorImpl::isStriped() const { return isStatStriped; }
+
 void StatisticDescriptorImpl::setId(int32_t statId) { id = statId; }
 
 int32_t StatisticDescriptorImpl::checkInt() const {
@@ -65,6 +65,9 @@ class StatisticDescriptorImpl : public StatisticDescriptor {
   /** Do larger values of the statistic indicate better performance? */
   bool isStatLargerBetter;
 
+  /** Is the statistic kept in a {@link StripedCounter}? */
+  bool isStatStriped;
+
   /** The physical offset used to access the data that stores the
    * value for this statistic in an instance of {@link Statistics}
    */
@@ -163,6 +166,26 @@ class StatisticDescriptorImpl : public StatisticDescriptor {
       const std::string& name, const std::string& description,
       const std::string& units, bool isLargerBetter);
 
+  /**
+   * Creates a descriptor of Integer type
+   * whose value behaves like a counter and is striped across
+   * cache lines
+   * @throws OutOfMemoryException
+   */
+  static StatisticDescriptor* createStripedIntCounter(
+      const std::string& name, const std::string& description,
+      const std::string& units, bool isLargerBetter);
+
+  /**
+   * Creates a descriptor of Long type
+   * whose value behaves like a counter and is striped across
+   * cache lines
+   * @throws OutOfMemoryException
+   */
+  static StatisticDescriptor* createStripedLongCounter(
+      const std::string& name, const std::string& description,
+      const std::string& units, bool isLargerBetter);
+
   /**
    * Creates a descriptor of Integer type
    * whose value behaves like a gauge
@@ -221,6 +244,12 @@ class StatisticDescriptorImpl : public StatisticDescriptor {
    */
   FieldType getTypeCode() const;
 
+  /**
+   * Returns true if the value of this statistic is spread over a
+   * {@link StripedCounter} rather than held in a single atomic
+   */
+  bool isStriped() const;
+
   /**
    * Sets the id of this descriptor
    * An uninitialized id will be -1
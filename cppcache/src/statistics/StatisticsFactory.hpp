@@ -94,6 +94,26 @@ class APACHE_GEODE_EXPORT StatisticsFactory {
       const std::string& name, const std::string& description,
       const std::string& units, bool largerBetter = true) = 0;
 
+  /**
+   * Creates and returns an int counter {@link StatisticDescriptor} like
+   * createIntCounter() whose value is striped over several cache lines, so
+   * that threads incrementing it concurrently do not contend. Reading the
+   * value costs a pass over the stripes, and incInt() returns the delta
+   * rather than the new value; use it for hot counters that are only read
+   * when sampled.
+   */
+  virtual StatisticDescriptor* createStripedIntCounter(
+      const std::string& name, const std::string& description,
+      const std::string& units, bool largerBetter = true) = 0;
+
+  /**
+   * Creates and returns a long counter {@link StatisticDescriptor} striped
+   * like createStripedIntCounter().
+   */
+  virtual StatisticDescriptor* createStripedLongCounter(
+      const std::string& name, const std::string& description,
+      const std::string& units, bool largerBetter = true) = 0;
+
   /**
    * Creates and returns an int gauge {@link StatisticDescriptor}
    * with the given <code>name</code>, <code>description</code>,
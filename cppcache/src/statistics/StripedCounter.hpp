@@ -0,0 +1,127 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STATISTICS_STRIPEDCOUNTER_H_
+#define GEODE_STATISTICS_STRIPEDCOUNTER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+/** @file
+ */
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+/**
+ * A counter split over several cache line sized cells, in the manner of
+ * Java's LongAdder. Each thread adds to the cell picked by its own stripe
+ * index, so threads incrementing the same statistic rarely touch the same
+ * cache line. Reading the value sums the cells, which makes reads more
+ * expensive than with a single atomic; the counter suits statistics that
+ * are incremented on every operation and only read when sampled.
+ */
+class StripedCounter {
+ public:
+  /** Upper bound on the number of cells per counter. */
+  static const size_t kMaxCells = 64;
+
+  StripedCounter() : mask(cellCount() - 1), cells(new Cell[mask + 1]) {
+    for (size_t i = 0; i <= mask; i++) {
+      cells[i].value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  StripedCounter(const StripedCounter&) = delete;
+  StripedCounter& operator=(const StripedCounter&) = delete;
+
+  inline void add(int64_t delta) {
+    cells[stripeIndex() & mask].value.fetch_add(delta,
+                                                std::memory_order_relaxed);
+  }
+
+  /**
+   * Returns the sum of the cells. Increments racing with the call may or may
+   * not be included.
+   */
+  int64_t sum() const {
+    int64_t total = 0;
+    for (size_t i = 0; i <= mask; i++) {
+      total += cells[i].value.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  /**
+   * Sets the counter to value. Increments racing with the call may be lost,
+   * which matches how statistics are reset.
+   */
+  void set(int64_t value) {
+    cells[0].value.store(value, std::memory_order_relaxed);
+    for (size_t i = 1; i <= mask; i++) {
+      cells[i].value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  size_t getCellCount() const { return mask + 1; }
+
+ private:
+  // Padded so that no two cells can share a cache line, whatever the
+  // alignment of the array.
+  struct Cell {
+    std::atomic<int64_t> value;
+    char pad[64 - sizeof(std::atomic<int64_t>)];
+  };
+
+  static size_t cellCount() {
+    static const size_t count = [] {
+      size_t cpus = std::thread::hardware_concurrency();
+      size_t count = 1;
+      while (count < cpus && count < kMaxCells) {
+        count <<= 1;
+      }
+      return count;
+    }();
+    return count;
+  }
+
+  /**
+   * Threads are handed consecutive stripe indexes as they first increment
+   * a striped counter, spreading them evenly over the cells.
+   */
+  static size_t stripeIndex() {
+    static std::atomic<size_t> nextIndex(0);
+    static thread_local size_t index =
+        nextIndex.fetch_add(1, std::memory_order_relaxed);
+    return index;
+  }
+
+  const size_t mask;
+  std::unique_ptr<Cell[]> cells;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_STRIPEDCOUNTER_H_
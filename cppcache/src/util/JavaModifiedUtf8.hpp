@@ -21,7 +21,9 @@
 #define GEODE_UTIL_JAVAMODIFIEDUTF8_H_
 
 #include <codecvt>
+#include <cstring>
 #include <locale>
+#include <stdexcept>
 #include <string>
 
 #include "string.hpp"
@@ -37,12 +39,39 @@ struct JavaModifiedUtf8 {
    * Modified UTF-8.
    */
   inline static size_t encodedLength(const std::string& utf8) {
-    if (utf8.empty()) {
-      return 0;
-    }
+    return encodedLength(utf8.data(), utf8.length());
+  }
 
-    // TODO string optimize for direct calculation
-    return encodedLength(to_utf16(utf8));
+  /**
+   * Calculate the length of the given UTF-8 code units when encoded in Java
+   * Modified UTF-8 without converting them to UTF-16 first. NUL is encoded
+   * in 2 bytes and every supplementary character, 4 bytes in UTF-8, becomes
+   * a surrogate pair of 3 bytes each. All other sequences keep their length.
+   *
+   * @throws std::range_error if utf8 is not valid UTF-8.
+   */
+  inline static size_t encodedLength(const char* utf8, size_t length) {
+    size_t encodedLen = 0;
+    size_t i = 0;
+    while (i < length) {
+      const auto ascii = nonzero_ascii_prefix_length(utf8 + i, length - i);
+      encodedLen += ascii;
+      i += ascii;
+      if (i < length) {
+        const auto sequenceLength = utf8SequenceLength(utf8 + i, length - i);
+        if (sequenceLength == 1) {
+          // NUL
+          encodedLen += 2;
+        } else if (sequenceLength == 4) {
+          // surrogate pair
+          encodedLen += 6;
+        } else {
+          encodedLen += sequenceLength;
+        }
+        i += sequenceLength;
+      }
+    }
+    return encodedLen;
   }
 
   /**
@@ -76,7 +105,51 @@ struct JavaModifiedUtf8 {
    * Converts given UTF-8 string to Java Modified UTF-8 string.
    */
   inline static std::string fromString(const std::string& utf8) {
-    return fromString(to_utf16(utf8));
+    std::string jmutf8(encodedLength(utf8), '\0');
+    if (!jmutf8.empty()) {
+      encode(utf8.data(), utf8.length(), &jmutf8[0]);
+    }
+    return jmutf8;
+  }
+
+  /**
+   * Transcodes UTF-8 code units directly into Java Modified UTF-8. Runs of
+   * ASCII are copied as is, NUL and supplementary characters are re-encoded
+   * and all other sequences are already valid Java Modified UTF-8.
+   *
+   * @param out buffer of at least <code>encodedLength(utf8, length)</code>
+   *   bytes.
+   * @return one past the last byte written to out.
+   * @throws std::range_error if utf8 is not valid UTF-8.
+   */
+  template <class _CharT>
+  inline static _CharT* encode(const char* utf8, size_t length, _CharT* out) {
+    size_t i = 0;
+    while (i < length) {
+      const auto ascii = nonzero_ascii_prefix_length(utf8 + i, length - i);
+      std::memcpy(out, utf8 + i, ascii);
+      out += ascii;
+      i += ascii;
+      if (i < length) {
+        const auto sequenceLength = utf8SequenceLength(utf8 + i, length - i);
+        if (sequenceLength == 1) {
+          // NUL
+          *(out++) = static_cast<_CharT>(0xc0);
+          *(out++) = static_cast<_CharT>(0x80);
+        } else if (sequenceLength == 4) {
+          const auto b = reinterpret_cast<const uint8_t*>(utf8 + i);
+          const uint32_t cp = (b[0] & 0x07) << 18 | (b[1] & 0x3f) << 12 |
+                              (b[2] & 0x3f) << 6 | (b[3] & 0x3f);
+          encodeSurrogate(static_cast<char16_t>(0xd7c0 + (cp >> 10)), out);
+          encodeSurrogate(static_cast<char16_t>(0xdc00 | (cp & 0x3ff)), out);
+        } else {
+          std::memcpy(out, utf8 + i, sequenceLength);
+          out += sequenceLength;
+        }
+        i += sequenceLength;
+      }
+    }
+    return out;
   }
 
   /**
@@ -116,9 +189,72 @@ struct JavaModifiedUtf8 {
 
   inline static std::u16string decode(const char* buf, uint16_t len) {
     std::u16string value;
+    value.reserve(len);
     const auto end = buf + len;
     while (buf < end) {
-      value += decodeJavaModifiedUtf8Char(&buf);
+      const auto ascii = ascii_prefix_length(buf, end - buf);
+      value.append(buf, buf + ascii);
+      buf += ascii;
+      if (buf < end) {
+        value += decodeJavaModifiedUtf8Char(&buf);
+      }
+    }
+    return value;
+  }
+
+  /**
+   * Transcodes Java Modified UTF-8 directly into UTF-8. Runs of ASCII are
+   * copied as is, the 2 byte NUL is collapsed and surrogate pairs are
+   * combined into a single 4 byte sequence. Malformed sequences, lone
+   * surrogates and lead bytes Java Modified UTF-8 never produces are each
+   * replaced with U+FFFD.
+   */
+  inline static std::string decodeToUtf8(const char* buf, size_t len) {
+    std::string value;
+    value.reserve(len);
+    const auto end = buf + len;
+    while (buf < end) {
+      const auto ascii = ascii_prefix_length(buf, end - buf);
+      value.append(buf, ascii);
+      buf += ascii;
+      if (buf >= end) {
+        break;
+      }
+
+      const auto available = static_cast<size_t>(end - buf);
+      const auto sequenceLength =
+          javaModifiedUtf8SequenceLength(buf, available);
+      if (sequenceLength == 0) {
+        // skip the lead byte and whatever continuation bytes belong to it
+        buf += malformedSequenceLength(buf, available);
+        appendUtf8(kReplacementCharacter, value);
+        continue;
+      }
+
+      const char* next = buf;
+      const char16_t c = decodeJavaModifiedUtf8Char(&next);
+      if (c >= 0xd800 && c <= 0xdfff) {
+        const char* low = next;
+        if (c <= 0xdbff && low < end &&
+            javaModifiedUtf8SequenceLength(
+                low, static_cast<size_t>(end - low)) == 3) {
+          const char16_t c2 = decodeJavaModifiedUtf8Char(&low);
+          if (c2 >= 0xdc00 && c2 <= 0xdfff) {
+            appendUtf8(0x10000 + ((c - 0xd800) << 10) + (c2 - 0xdc00),
+                       value);
+            buf = low;
+            continue;
+          }
+        }
+        // lone surrogate, which UTF-8 cannot represent
+        appendUtf8(kReplacementCharacter, value);
+      } else if (c == 0 || next - buf != utf8Length(c)) {
+        // NUL or an overlong form, re-encoded in its shortest form
+        appendUtf8(c, value);
+      } else {
+        value.append(buf, next);
+      }
+      buf = next;
     }
     return value;
   }
@@ -172,6 +308,107 @@ struct JavaModifiedUtf8 {
     }
     return c;
   }
+
+ private:
+  static constexpr uint32_t kReplacementCharacter = 0xfffd;
+
+  inline static bool isContinuation(const char c) {
+    return (static_cast<uint8_t>(c) & 0xc0) == 0x80;
+  }
+
+  /**
+   * Returns the length of the well formed 2 or 3 byte Java Modified UTF-8
+   * sequence starting at buf, or 0 if it is malformed or truncated.
+   */
+  inline static size_t javaModifiedUtf8SequenceLength(const char* buf,
+                                                      size_t available) {
+    const auto b = static_cast<uint8_t>(buf[0]);
+    if ((b >> 5) == 0x6) {
+      return available >= 2 && isContinuation(buf[1]) ? 2 : 0;
+    } else if ((b >> 4) == 0xe) {
+      return available >= 3 && isContinuation(buf[1]) &&
+                     isContinuation(buf[2])
+                 ? 3
+                 : 0;
+    }
+    return 0;
+  }
+
+  /**
+   * Returns the number of bytes to skip for the malformed sequence starting
+   * at buf: the lead byte plus the continuation bytes it announced that are
+   * present.
+   */
+  inline static size_t malformedSequenceLength(const char* buf,
+                                               size_t available) {
+    const auto b = static_cast<uint8_t>(buf[0]);
+    const size_t expected = (b >> 5) == 0x6 ? 2 : (b >> 4) == 0xe ? 3 : 1;
+    size_t length = 1;
+    while (length < expected && length < available &&
+           isContinuation(buf[length])) {
+      length++;
+    }
+    return length;
+  }
+
+  inline static ptrdiff_t utf8Length(const uint32_t cp) {
+    return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+  }
+
+  inline static void appendUtf8(const uint32_t cp, std::string& utf8) {
+    if (cp < 0x80) {
+      utf8 += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+      utf8 += static_cast<char>(0xc0 | (cp >> 6));
+      utf8 += static_cast<char>(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+      utf8 += static_cast<char>(0xe0 | (cp >> 12));
+      utf8 += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+      utf8 += static_cast<char>(0x80 | (cp & 0x3f));
+    } else {
+      utf8 += static_cast<char>(0xf0 | (cp >> 18));
+      utf8 += static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+      utf8 += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+      utf8 += static_cast<char>(0x80 | (cp & 0x3f));
+    }
+  }
+
+  /**
+   * Returns the number of code units in the UTF-8 sequence starting at utf8,
+   * which must not start with a non-zero ASCII character.
+   */
+  inline static size_t utf8SequenceLength(const char* utf8, size_t available) {
+    const auto b = reinterpret_cast<const uint8_t*>(utf8);
+    size_t sequenceLength;
+    if (b[0] == 0) {
+      return 1;
+    } else if ((b[0] >> 5) == 0x6) {
+      sequenceLength = 2;
+    } else if ((b[0] >> 4) == 0xe) {
+      sequenceLength = 3;
+    } else if ((b[0] >> 3) == 0x1e) {
+      sequenceLength = 4;
+    } else {
+      throw std::range_error("Invalid UTF-8 lead byte");
+    }
+
+    if (sequenceLength > available) {
+      throw std::range_error("Truncated UTF-8 sequence");
+    }
+    for (size_t i = 1; i < sequenceLength; i++) {
+      if ((b[i] & 0xc0) != 0x80) {
+        throw std::range_error("Invalid UTF-8 continuation byte");
+      }
+    }
+    return sequenceLength;
+  }
+
+  template <class _CharT>
+  inline static void encodeSurrogate(const char16_t c, _CharT*& out) {
+    *(out++) = static_cast<_CharT>(0xe0 | c >> 12);
+    *(out++) = static_cast<_CharT>(0x80 | ((c >> 6) & 0x3f));
+    *(out++) = static_cast<_CharT>(0x80 | (c & 0x3f));
+  }
 };
 
 }  // namespace internal
@@ -52,6 +52,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class AsyncLogWriter;
 class Exception;
 
 /******************************************************************************/
@@ -172,6 +173,16 @@ class APACHE_GEODE_EXPORT Log {
    */
   static void close();
 
+  /**
+   * Switches to asynchronous logging until the next close(). Callers then
+   * only format their line and queue it; a background thread writes queued
+   * lines in batches and does any file rolling. When queueSize lines are
+   * pending further lines are dropped, and reported in a later warning,
+   * unless blockWhenFull is set, in which case callers wait for room. The
+   * queue size is fixed by the first call.
+   */
+  static void startAsync(uint32_t queueSize, bool blockWhenFull);
+
   /**
    * returns character string for given log level. The string will be
    * identical to the enum declaration above, except it will be all
@@ -534,6 +545,15 @@ class APACHE_GEODE_EXPORT Log {
 
   static void writeBanner();
 
+  /**
+   * Writes one line to the log file or stdout, rolling the file as needed.
+   * Must be called with the log mutex held.
+   */
+  static void writeLine(LogLevel level, const char* prefix, const char* msg,
+                        bool flush);
+
+  friend class AsyncLogWriter;
+
   /******/
  public:
   static void put(LogLevel level, const std::string& msg);
@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_BYTESWAP_H_
+#define GEODE_UTIL_BYTESWAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <stdlib.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define GEODE_BIG_ENDIAN_HOST 1
+#endif
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+/**
+ * Converts between host and network (big endian) byte order for arrays of
+ * fixed width values. The wire format used by Geode is big endian so on
+ * little endian hosts every element must be swapped. Whole arrays are
+ * swapped with SSSE3 or AVX2 shuffles, when the compiler targets them, and
+ * the remainder is swapped a word at a time.
+ */
+struct ByteSwap {
+  inline static uint16_t swap(uint16_t value) {
+#if defined(_MSC_VER)
+    return _byteswap_ushort(value);
+#else
+    return __builtin_bswap16(value);
+#endif
+  }
+
+  inline static uint32_t swap(uint32_t value) {
+#if defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#else
+    return __builtin_bswap32(value);
+#endif
+  }
+
+  inline static uint64_t swap(uint64_t value) {
+#if defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    return __builtin_bswap64(value);
+#endif
+  }
+
+  /**
+   * Copies count elements of sizeof(T) bytes from src to dst reversing the
+   * byte order of each element on little endian hosts. The operation is
+   * symmetric so it is used for both encoding and decoding. Neither buffer
+   * needs to be aligned.
+   */
+  template <class T>
+  inline static void copy(void* dst, const void* src, size_t count) {
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 ||
+                      sizeof(T) == 8,
+                  "ByteSwap supports only 1, 2, 4 and 8 byte elements.");
+#if defined(GEODE_BIG_ENDIAN_HOST)
+    std::memcpy(dst, src, count * sizeof(T));
+#else
+    copySwapped(dst, src, count, Width<sizeof(T)>());
+#endif
+  }
+
+ private:
+  template <size_t N>
+  struct Width {};
+
+  inline static void copySwapped(void* dst, const void* src, size_t count,
+                                 Width<1>) {
+    std::memcpy(dst, src, count);
+  }
+
+  template <size_t N>
+  inline static void copySwapped(void* dst, const void* src, size_t count,
+                                 Width<N> width) {
+    auto out = static_cast<uint8_t*>(dst);
+    auto in = static_cast<const uint8_t*>(src);
+    auto remaining = count * N;
+#if defined(__AVX2__)
+    const auto mask256 = _mm256_broadcastsi128_si256(shuffleMask(width));
+    for (; remaining >= 32; remaining -= 32, in += 32, out += 32) {
+      auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                          _mm256_shuffle_epi8(block, mask256));
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+    const auto mask128 = shuffleMask(width);
+    for (; remaining >= 16; remaining -= 16, in += 16, out += 16) {
+      auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                       _mm_shuffle_epi8(block, mask128));
+    }
+#endif
+    copyScalar(out, in, remaining / N, width);
+  }
+
+  inline static void copyScalar(uint8_t* out, const uint8_t* in, size_t count,
+                                Width<2>) {
+    for (; count > 0; count--, in += 2, out += 2) {
+      uint16_t value;
+      std::memcpy(&value, in, 2);
+      value = swap(value);
+      std::memcpy(out, &value, 2);
+    }
+  }
+
+  inline static void copyScalar(uint8_t* out, const uint8_t* in, size_t count,
+                                Width<4>) {
+    for (; count > 0; count--, in += 4, out += 4) {
+      uint32_t value;
+      std::memcpy(&value, in, 4);
+      value = swap(value);
+      std::memcpy(out, &value, 4);
+    }
+  }
+
+  inline static void copyScalar(uint8_t* out, const uint8_t* in, size_t count,
+                                Width<8>) {
+    for (; count > 0; count--, in += 8, out += 8) {
+      uint64_t value;
+      std::memcpy(&value, in, 8);
+      value = swap(value);
+      std::memcpy(out, &value, 8);
+    }
+  }
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+  inline static __m128i shuffleMask(Width<2>) {
+    return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  }
+
+  inline static __m128i shuffleMask(Width<4>) {
+    return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  }
+
+  inline static __m128i shuffleMask(Width<8>) {
+    return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  }
+#endif
+};
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_UTIL_BYTESWAP_H_
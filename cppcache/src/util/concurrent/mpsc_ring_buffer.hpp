@@ -0,0 +1,127 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_MPSC_RING_BUFFER_H_
+#define GEODE_UTIL_CONCURRENT_MPSC_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Bounded lock-free queue for many producers and a single consumer.
+ *
+ * Each slot carries a sequence number telling producers and the consumer
+ * whose turn it is, so producers only contend on a single compare and swap
+ * of the enqueue position and never wait on each other or on the consumer.
+ * The capacity is rounded up to a power of two.
+ */
+template <class T>
+class mpsc_ring_buffer final {
+ private:
+  struct slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static size_t round_up(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    return size;
+  }
+
+  const size_t mask_;
+  std::unique_ptr<slot[]> slots_;
+  std::atomic<size_t> enqueue_pos_;
+  // keeps the producers' and the consumer's positions on separate cache lines
+  char pad_[64];
+  size_t dequeue_pos_;
+
+ public:
+  explicit mpsc_ring_buffer(size_t capacity)
+      : mask_(round_up(capacity) - 1),
+        slots_(new slot[mask_ + 1]),
+        enqueue_pos_(0),
+        dequeue_pos_(0) {
+    for (size_t i = 0; i <= mask_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpsc_ring_buffer(const mpsc_ring_buffer&) = delete;
+  mpsc_ring_buffer& operator=(const mpsc_ring_buffer&) = delete;
+
+  size_t capacity() const { return mask_ + 1; }
+
+  /**
+   * Moves value into the queue. Returns false, leaving value untouched, if
+   * the queue is full. Safe to call from any number of threads.
+   */
+  bool try_push(T& value) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& s = slots_[pos & mask_];
+      auto seq = s.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          s.value = std::move(value);
+          s.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * Moves the oldest value into value. Returns false if the queue is empty.
+   * Must only be called from the consumer thread.
+   */
+  bool try_pop(T& value) {
+    auto& s = slots_[dequeue_pos_ & mask_];
+    auto seq = s.sequence.load(std::memory_order_acquire);
+    if (static_cast<std::ptrdiff_t>(seq - (dequeue_pos_ + 1)) < 0) {
+      return false;
+    }
+    value = std::move(s.value);
+    s.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    return true;
+  }
+};
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_MPSC_RING_BUFFER_H_ */
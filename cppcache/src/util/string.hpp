@@ -22,9 +22,15 @@
 
 #include <cctype>
 #include <codecvt>
+#include <cstdint>
+#include <cstring>
 #include <locale>
 #include <string>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "type_traits.hpp"
 
 namespace apache {
@@ -156,6 +162,65 @@ inline std::string to_utf8(const std::u32string& ucs4) {
 #endif
 }
 
+/**
+ * Returns the number of leading bytes in data that are 7-bit ASCII. The scan
+ * checks 16 bytes at a time with SSE2, where available, or 8 bytes at a time
+ * otherwise.
+ */
+inline size_t ascii_prefix_length(const char* data, size_t length) {
+  size_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+  for (; i + 16 <= length; i += 16) {
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    if (_mm_movemask_epi8(block) != 0) {
+      break;
+    }
+  }
+#endif
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, 8);
+    if ((word & 0x8080808080808080ULL) != 0) {
+      break;
+    }
+  }
+  while (i < length && (data[i] & 0x80) == 0) {
+    i++;
+  }
+  return i;
+}
+
+/**
+ * Returns the number of leading bytes in data that are 7-bit ASCII other than
+ * NUL, which is the run of bytes that Java Modified UTF-8 encodes unchanged.
+ */
+inline size_t nonzero_ascii_prefix_length(const char* data, size_t length) {
+  size_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+  const auto zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    auto special = _mm_or_si128(block, _mm_cmpeq_epi8(block, zero));
+    if (_mm_movemask_epi8(special) != 0) {
+      break;
+    }
+  }
+#endif
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, 8);
+    const auto zeroBytes =
+        (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+    if (((word & 0x8080808080808080ULL) | zeroBytes) != 0) {
+      break;
+    }
+  }
+  while (i < length && data[i] != 0 && (data[i] & 0x80) == 0) {
+    i++;
+  }
+  return i;
+}
+
 inline bool equal_ignore_case(const std::string& str1,
                               const std::string& str2) {
   return ((str1.size() == str2.size()) &&
@@ -0,0 +1,110 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "statistics/AtomicStatisticsImpl.hpp"
+#include "statistics/StatisticDescriptorImpl.hpp"
+#include "statistics/StatisticsTypeImpl.hpp"
+#include "statistics/StripedCounter.hpp"
+
+using apache::geode::statistics::AtomicStatisticsImpl;
+using apache::geode::statistics::StatisticDescriptor;
+using apache::geode::statistics::StatisticDescriptorImpl;
+using apache::geode::statistics::StatisticsTypeImpl;
+using apache::geode::statistics::StripedCounter;
+
+namespace {
+
+StatisticsTypeImpl* createType() {
+  auto descriptors = new StatisticDescriptor*[4];
+  descriptors[0] =
+      StatisticDescriptorImpl::createIntCounter("plainInt", "", "", true);
+  descriptors[1] = StatisticDescriptorImpl::createStripedIntCounter(
+      "stripedInt", "", "", true);
+  descriptors[2] =
+      StatisticDescriptorImpl::createLongCounter("plainLong", "", "", true);
+  descriptors[3] = StatisticDescriptorImpl::createStripedLongCounter(
+      "stripedLong", "", "", true);
+  return new StatisticsTypeImpl("TestStats", "", descriptors, 4);
+}
+
+}  // namespace
+
+TEST(AtomicStatisticsImplTest, stripedCounterSumsConcurrentIncrements) {
+  StripedCounter counter;
+  EXPECT_LE(1, counter.getCellCount());
+  EXPECT_GE(static_cast<size_t>(StripedCounter::kMaxCells),
+            counter.getCellCount());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&counter] {
+      for (int j = 0; j < 10000; j++) {
+        counter.add(1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(80000, counter.sum());
+
+  counter.set(5);
+  EXPECT_EQ(5, counter.sum());
+}
+
+TEST(AtomicStatisticsImplTest, stripedStatisticsReadLikePlainOnes) {
+  std::unique_ptr<StatisticsTypeImpl> type(createType());
+  AtomicStatisticsImpl stats(type.get(), "test", 1, 1, nullptr);
+
+  auto plainInt = stats.nameToId("plainInt");
+  auto stripedInt = stats.nameToId("stripedInt");
+  auto plainLong = stats.nameToId("plainLong");
+  auto stripedLong = stats.nameToId("stripedLong");
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 1000; j++) {
+        stats.incInt(plainInt, 1);
+        stats.incInt(stripedInt, 1);
+        stats.incLong(plainLong, 2);
+        stats.incLong(stripedLong, 2);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(4000, stats.getInt(plainInt));
+  EXPECT_EQ(4000, stats.getInt(stripedInt));
+  EXPECT_EQ(8000, stats.getLong(plainLong));
+  EXPECT_EQ(8000, stats.getLong(stripedLong));
+  EXPECT_EQ(4000, stats.getRawBits(stats.nameToDescriptor("stripedInt")));
+  EXPECT_EQ(8000, stats.getRawBits(stats.nameToDescriptor("stripedLong")));
+
+  stats.setInt(stripedInt, 0);
+  stats.setLong(stripedLong, 7);
+  EXPECT_EQ(0, stats.getInt(stripedInt));
+  EXPECT_EQ(7, stats.getLong(stripedLong));
+}
@@ -224,4 +224,16 @@ TEST_F(CacheableStringTests, TestFromDataNonAsciiHuge) {
   EXPECT_EQ(utf8, str->value());
 }
 
+TEST_F(CacheableStringTests, SerializedFormMatchesWriteObject) {
+  auto str = CacheableString::create(u8"You had me at meat tornad\u00F6.");
+  TestDataOutput out;
+  out.writeObject(str);
+
+  const auto& serialized = str->serializedForm();
+  EXPECT_EQ(to_hex(out),
+            to_hex(reinterpret_cast<const uint8_t*>(serialized.data()),
+                   serialized.size()));
+  EXPECT_EQ(&serialized, &str->serializedForm());
+}
+
 }  // namespace
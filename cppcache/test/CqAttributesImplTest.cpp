@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <geode/CqListener.hpp>
+
+#include "CqAttributesImpl.hpp"
+
+using apache::geode::client::CqAttributesImpl;
+using apache::geode::client::CqListener;
+
+TEST(CqAttributesImplTest, snapshotIsUnchangedByLaterMutations) {
+  CqAttributesImpl cqAttributes;
+  auto first = std::make_shared<CqListener>();
+  auto second = std::make_shared<CqListener>();
+
+  cqAttributes.addCqListener(first);
+  auto snapshot = cqAttributes.getCqListenersSnapshot();
+  ASSERT_EQ(1, snapshot->size());
+
+  cqAttributes.addCqListener(second);
+  EXPECT_EQ(1, snapshot->size());
+  EXPECT_EQ(2, cqAttributes.getCqListenersSnapshot()->size());
+
+  cqAttributes.removeCqListener(first);
+  EXPECT_EQ(first, snapshot->front());
+  auto listeners = cqAttributes.getCqListeners();
+  ASSERT_EQ(1, listeners.size());
+  EXPECT_EQ(second, listeners.front());
+}
+
+TEST(CqAttributesImplTest, setCqListenersReplacesSnapshot) {
+  CqAttributesImpl cqAttributes;
+  auto first = std::make_shared<CqListener>();
+  auto second = std::make_shared<CqListener>();
+  cqAttributes.addCqListener(first);
+  auto snapshot = cqAttributes.getCqListenersSnapshot();
+
+  cqAttributes.setCqListeners({second});
+  EXPECT_EQ(first, snapshot->front());
+  ASSERT_EQ(1, cqAttributes.getCqListenersSnapshot()->size());
+  EXPECT_EQ(second, cqAttributes.getCqListenersSnapshot()->front());
+}
@@ -122,6 +122,18 @@ class TestDataInput {
 
   std::vector<char16_t> readCharArray() { return m_dataInput.readCharArray(); }
 
+  std::vector<int16_t> readShortArray() {
+    return m_dataInput.readShortArray();
+  }
+
+  std::vector<int32_t> readIntArray() { return m_dataInput.readIntArray(); }
+
+  std::vector<int64_t> readLongArray() { return m_dataInput.readLongArray(); }
+
+  std::vector<double> readDoubleArray() {
+    return m_dataInput.readDoubleArray();
+  }
+
   std::vector<std::string> readStringArray() {
     return m_dataInput.readStringArray();
   }
@@ -513,6 +525,41 @@ TEST_F(DataInputTest, TestReadCharArray) {
       << "Correct const char *";
 }
 
+TEST_F(DataInputTest, TestReadShortArray) {
+  TestDataInput dataInput("03000180007FFF");
+  auto value = dataInput.readShortArray();
+  EXPECT_EQ(std::vector<int16_t>({1, -32768, 32767}), value);
+}
+
+TEST_F(DataInputTest, TestReadIntArray) {
+  TestDataInput dataInput(
+      "1100000000000000010000000200000003000000040000000500000006000000070000"
+      "0008000000090000000A0000000B0000000C0000000D0000000E0000000FFFFFFFFF");
+  auto value = dataInput.readIntArray();
+  EXPECT_EQ(std::vector<int32_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                  13, 14, 15, -1}),
+            value);
+}
+
+TEST_F(DataInputTest, TestReadLongArray) {
+  TestDataInput dataInput(
+      "030ABCDEFFEDCBABCD0000000000000001FFFFFFFFFFFFFFFF");
+  auto value = dataInput.readLongArray();
+  EXPECT_EQ(std::vector<int64_t>({773738426788457421, 1, -1}), value);
+}
+
+TEST_F(DataInputTest, TestReadDoubleArray) {
+  TestDataInput dataInput("02400921FB54442EEA0000000000000000");
+  auto value = dataInput.readDoubleArray();
+  EXPECT_EQ(std::vector<double>({3.14159265359, 0.0}), value);
+}
+
+TEST_F(DataInputTest, ThrowsWhenReadingIntArrayBeyondBuffer) {
+  TestDataInput dataInput("0300000001000000020000");
+  EXPECT_THROW(dataInput.readIntArray(),
+               apache::geode::client::OutOfRangeException);
+}
+
 TEST_F(DataInputTest, TestReadString) {
   TestDataInput dataInput(
       "57001B596F7520686164206D65206174206D65617420746F726E61646F2E");
@@ -223,6 +223,49 @@ TEST_F(DataOutputTest, TestWriteDouble) {
   EXPECT_BYTEARRAY_EQ("400921FB54442EEA", dataOutput.getByteArray());
 }
 
+TEST_F(DataOutputTest, TestWriteArrayOnlyInt16) {
+  int16_t values[] = {1, -32768, 32767};
+
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeArrayOnly(values, 3);
+  EXPECT_BYTEARRAY_EQ("000180007FFF", dataOutput.getByteArray());
+}
+
+TEST_F(DataOutputTest, TestWriteArrayOnlyInt32) {
+  int32_t values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, -1};
+
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeArrayOnly(values, 17);
+  EXPECT_BYTEARRAY_EQ(
+      "0000000000000001000000020000000300000004000000050000000600000007000000"
+      "08000000090000000A0000000B0000000C0000000D0000000E0000000FFFFFFFFF",
+      dataOutput.getByteArray());
+}
+
+TEST_F(DataOutputTest, TestWriteArrayOnlyInt64) {
+  int64_t values[] = {773738426788457421, 1, -1};
+
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeArrayOnly(values, 3);
+  EXPECT_BYTEARRAY_EQ("0ABCDEFFEDCBABCD0000000000000001FFFFFFFFFFFFFFFF",
+                      dataOutput.getByteArray());
+}
+
+TEST_F(DataOutputTest, TestWriteArrayOnlyDouble) {
+  double values[] = {3.14159265359, 0.0};
+
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeArrayOnly(values, 2);
+  EXPECT_BYTEARRAY_EQ("400921FB54442EEA0000000000000000",
+                      dataOutput.getByteArray());
+}
+
+TEST_F(DataOutputTest, TestWriteArrayOnlyChar16) {
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeArrayOnly(u"Geode", 5);
+  EXPECT_BYTEARRAY_EQ("00470065006F00640065", dataOutput.getByteArray());
+}
+
 TEST_F(DataOutputTest, TestWriteString) {
   TestDataOutput dataOutput(nullptr);
   dataOutput.writeString("You had me at meat tornado.");
@@ -0,0 +1,187 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "DurableEventReplay.hpp"
+#include "TcrMessage.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::DataInput;
+using apache::geode::client::DurableEventReplay;
+using apache::geode::client::TcrMessage;
+using apache::geode::client::TcrMessageReply;
+
+namespace {
+
+// a subscription event as the notification channel would have decoded it
+class Event : public TcrMessageReply {
+ public:
+  Event(int32_t type, const std::string& region, const std::string& key)
+      : TcrMessageReply(true, nullptr) {
+    m_msgType = type;
+    m_regionName = region;
+    m_key = CacheableString::create(key);
+  }
+
+  void setDelta(const Cache& cache) {
+    static const uint8_t bytes[] = {0};
+    m_delta = std::unique_ptr<DataInput>(
+        new DataInput(cache.createDataInput(bytes, sizeof(bytes))));
+  }
+};
+
+class DurableEventReplayTest : public ::testing::Test {
+ protected:
+  DurableEventReplayTest()
+      : m_cache(CacheFactory{}.set("log-level", "none").create()) {}
+
+  ~DurableEventReplayTest() override {
+    for (auto event : m_batch) {
+      delete event;
+    }
+  }
+
+  Event* add(int32_t type, const std::string& region, const std::string& key) {
+    auto event = new Event(type, region, key);
+    m_batch.push_back(event);
+    return event;
+  }
+
+  // the events conflation left in the batch, in order
+  std::vector<TcrMessageReply*> remaining() const {
+    std::vector<TcrMessageReply*> events;
+    for (auto event : m_batch) {
+      if (event != nullptr) {
+        events.push_back(event);
+      }
+    }
+    return events;
+  }
+
+  Cache m_cache;
+  std::vector<TcrMessageReply*> m_batch;
+};
+
+}  // namespace
+
+TEST_F(DurableEventReplayTest, collapsesUpdatesOfTheSameKey) {
+  add(TcrMessage::LOCAL_CREATE, "/region", "key");
+  add(TcrMessage::LOCAL_UPDATE, "/region", "key");
+  auto last = add(TcrMessage::LOCAL_UPDATE, "/region", "key");
+
+  EXPECT_EQ(2, DurableEventReplay::conflate(m_batch));
+
+  const std::vector<TcrMessageReply*> expected{last};
+  EXPECT_EQ(expected, remaining());
+}
+
+TEST_F(DurableEventReplayTest, keepsCreateBeforeDestroy) {
+  auto create = add(TcrMessage::LOCAL_CREATE, "/region", "key");
+  auto destroy = add(TcrMessage::LOCAL_DESTROY, "/region", "key");
+  auto recreate = add(TcrMessage::LOCAL_CREATE, "/region", "key");
+
+  EXPECT_EQ(0, DurableEventReplay::conflate(m_batch));
+
+  const std::vector<TcrMessageReply*> expected{create, destroy, recreate};
+  EXPECT_EQ(expected, remaining());
+}
+
+TEST_F(DurableEventReplayTest, keepsOrderAcrossKeys) {
+  add(TcrMessage::LOCAL_UPDATE, "/region", "a");
+  add(TcrMessage::LOCAL_UPDATE, "/region", "b");
+  auto otherRegion = add(TcrMessage::LOCAL_UPDATE, "/other", "a");
+  auto lastA = add(TcrMessage::LOCAL_UPDATE, "/region", "a");
+  auto c = add(TcrMessage::LOCAL_CREATE, "/region", "c");
+  auto lastB = add(TcrMessage::LOCAL_UPDATE, "/region", "b");
+
+  EXPECT_EQ(2, DurableEventReplay::conflate(m_batch));
+
+  const std::vector<TcrMessageReply*> expected{otherRegion, lastA, c, lastB};
+  EXPECT_EQ(expected, remaining());
+}
+
+TEST_F(DurableEventReplayTest, fullValueSupersedesDelta) {
+  add(TcrMessage::LOCAL_UPDATE, "/region", "key");
+  add(TcrMessage::LOCAL_UPDATE, "/region", "key")->setDelta(m_cache);
+  auto last = add(TcrMessage::LOCAL_UPDATE, "/region", "key");
+
+  EXPECT_EQ(2, DurableEventReplay::conflate(m_batch));
+
+  const std::vector<TcrMessageReply*> expected{last};
+  EXPECT_EQ(expected, remaining());
+}
+
+TEST_F(DurableEventReplayTest, keepsUpdateBeforeDelta) {
+  auto update = add(TcrMessage::LOCAL_UPDATE, "/region", "key");
+  auto delta = add(TcrMessage::LOCAL_UPDATE, "/region", "key");
+  delta->setDelta(m_cache);
+
+  EXPECT_EQ(0, DurableEventReplay::conflate(m_batch));
+
+  const std::vector<TcrMessageReply*> expected{update, delta};
+  EXPECT_EQ(expected, remaining());
+}
+
+TEST_F(DurableEventReplayTest, defaultSettingDispatchesEveryEvent) {
+  const auto conflate =
+      DurableEventReplay::conflates(m_cache.getSystemProperties());
+  EXPECT_FALSE(conflate);
+
+  std::vector<int32_t> dispatched;
+  DurableEventReplay replay(
+      CacheRegionHelper::getCacheImpl(&m_cache)->getCachePerfStats(),
+      [&dispatched](TcrMessageReply* event) {
+        dispatched.push_back(event->getMessageType());
+        delete event;
+      },
+      conflate, false);
+  replay.add(new Event(TcrMessage::LOCAL_CREATE, "/region", "key"));
+  replay.add(new Event(TcrMessage::LOCAL_UPDATE, "/region", "key"));
+  replay.add(new Event(TcrMessage::LOCAL_UPDATE, "/region", "key"));
+  replay.finish();
+
+  const std::vector<int32_t> expected{TcrMessage::LOCAL_CREATE,
+                                      TcrMessage::LOCAL_UPDATE,
+                                      TcrMessage::LOCAL_UPDATE};
+  EXPECT_EQ(expected, dispatched);
+}
+
+TEST(DurableEventReplayConflatesTest, onlyWhenConflateEventsIsTrue) {
+  for (const auto& setting : {"true", "false", "server"}) {
+    auto cache = CacheFactory{}
+                     .set("log-level", "none")
+                     .set("conflate-events", setting)
+                     .create();
+    EXPECT_EQ(std::string(setting) == "true",
+              DurableEventReplay::conflates(cache.getSystemProperties()))
+        << setting;
+    cache.close();
+  }
+}
@@ -0,0 +1,284 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Struct.hpp>
+
+#include "LocalIndex.hpp"
+#include "LocalQuery.hpp"
+#include "QueryValue.hpp"
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::IndexType;
+using apache::geode::client::LocalIndexes;
+using apache::geode::client::LocalQuery;
+using apache::geode::client::LocalQuerySource;
+using apache::geode::client::QueryException;
+using apache::geode::client::QueryOperator;
+using apache::geode::client::QueryPath;
+using apache::geode::client::QueryValue;
+using apache::geode::client::Struct;
+
+namespace {
+
+class TestSource : public LocalQuerySource {
+ public:
+  TestSource() : scans(0) {}
+
+  void put(int32_t key, const std::shared_ptr<Cacheable>& value) {
+    auto cacheableKey = CacheableInt32::create(key);
+    values[key] = value;
+    indexes.put(cacheableKey, value);
+  }
+
+  Entries getEntries() const override {
+    ++scans;
+    Entries entries;
+    for (const auto& entry : values) {
+      entries.emplace_back(CacheableInt32::create(entry.first), entry.second);
+    }
+    return entries;
+  }
+
+  std::shared_ptr<Cacheable> getValue(
+      const std::shared_ptr<CacheableKey>& key) const override {
+    const auto found = values.find(
+        std::dynamic_pointer_cast<CacheableInt32>(key)->value());
+    return found == values.end() ? nullptr : found->second;
+  }
+
+  const LocalIndexes* getIndexes() const override { return &indexes; }
+
+  std::unordered_map<int32_t, std::shared_ptr<Cacheable>> values;
+  LocalIndexes indexes;
+  mutable int scans;
+};
+
+std::shared_ptr<TestSource> createSource() {
+  auto source = std::make_shared<TestSource>();
+  for (int32_t i = 0; i < 10; i++) {
+    source->put(i, CacheableInt32::create(i % 5));
+  }
+  return source;
+}
+
+void createIndex(TestSource& source, const std::string& name,
+                 const QueryPath& path, IndexType type) {
+  auto index = source.indexes.create(name, path, type);
+  for (const auto& entry : source.values) {
+    index->populate(CacheableInt32::create(entry.first), entry.second);
+  }
+  index->populated();
+}
+
+}  // namespace
+
+TEST(LocalQueryTest, comparesNumbersAcrossTypes) {
+  EXPECT_TRUE(QueryValue::ofInteger(1).satisfies(QueryOperator::EQ,
+                                                 QueryValue::ofDouble(1.0)));
+  EXPECT_TRUE(QueryValue::ofInteger(1).satisfies(QueryOperator::LT,
+                                                 QueryValue::ofDouble(1.5)));
+  EXPECT_EQ(QueryValue::ofInteger(7).hash(), QueryValue::ofDouble(7.0).hash());
+
+  // 2^53 + 1 cannot be represented as a double
+  const int64_t large = (int64_t{1} << 53) + 1;
+  EXPECT_TRUE(QueryValue::ofInteger(large).satisfies(
+      QueryOperator::GT, QueryValue::ofDouble(static_cast<double>(large))));
+
+  const auto nan =
+      QueryValue::ofDouble(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_TRUE(nan.satisfies(QueryOperator::EQ, nan));
+  EXPECT_TRUE(nan.satisfies(QueryOperator::GT, QueryValue::ofInteger(1)));
+}
+
+TEST(LocalQueryTest, valuesOfDifferentKindsAreNeverEqual) {
+  const auto one = QueryValue::ofInteger(1);
+  const auto text = QueryValue::ofString("1");
+  EXPECT_FALSE(one.satisfies(QueryOperator::EQ, text));
+  EXPECT_TRUE(one.satisfies(QueryOperator::NE, text));
+  EXPECT_FALSE(one.satisfies(QueryOperator::LT, text));
+  EXPECT_FALSE(one.satisfies(QueryOperator::EQ, QueryValue()));
+  EXPECT_FALSE(one.satisfies(QueryOperator::NE, QueryValue()));
+  EXPECT_TRUE(QueryValue::ofNull().satisfies(QueryOperator::EQ,
+                                             QueryValue::ofNull()));
+}
+
+TEST(LocalQueryTest, expandsPredicates) {
+  EXPECT_EQ("select distinct * from /r this where this > 1",
+            LocalQuery::forPredicate("/r", "this > 1"));
+  EXPECT_EQ(" SELECT * from /r",
+            LocalQuery::forPredicate("/r", " SELECT * from /r"));
+}
+
+TEST(LocalQueryTest, parsesPaths) {
+  EXPECT_EQ(QueryPath({"address", "city"}),
+            LocalQuery::parsePath("this.address.city"));
+  EXPECT_EQ(QueryPath({"id"}), LocalQuery::parsePath("id"));
+  EXPECT_THROW(LocalQuery::parsePath("id > 1"), QueryException);
+}
+
+TEST(LocalQueryTest, rejectsQueriesItCannotRun) {
+  EXPECT_THROW(LocalQuery("select * from /r order by id"), QueryException);
+  EXPECT_THROW(LocalQuery("select count(*) from /r"), QueryException);
+  EXPECT_THROW(LocalQuery("select * from /r, /s"), QueryException);
+  EXPECT_THROW(LocalQuery("select * from /r where id in set(1, 2)"),
+               QueryException);
+  EXPECT_THROW(LocalQuery("select * from /r where name.toUpperCase() = 'A'"),
+               QueryException);
+  EXPECT_THROW(LocalQuery("select * from /r where id = $1"), QueryException);
+  EXPECT_THROW(LocalQuery("import a.b.C; select * from /r"), QueryException);
+  EXPECT_THROW(LocalQuery("select * from /r where name = 'a"), QueryException);
+
+  EXPECT_NO_THROW(LocalQuery(
+      "SELECT DISTINCT p.id AS i, p.name FROM /a/b p WHERE NOT (p.id < 3 OR "
+      "p.name <> 'it''s') AND p.active = true LIMIT 10"));
+}
+
+TEST(LocalQueryTest, scansWithoutIndexes) {
+  auto source = createSource();
+
+  auto results =
+      LocalQuery("select * from /r where this >= 3").execute(*source);
+  EXPECT_EQ(4, results->size());
+  EXPECT_EQ(1, source->scans);
+
+  results =
+      LocalQuery("select distinct * from /r where this >= 3").execute(*source);
+  EXPECT_EQ(2, results->size());
+
+  results = LocalQuery("select * from /r r where r < 2 or r = 4 limit 5")
+                .execute(*source);
+  EXPECT_EQ(5, results->size());
+
+  results =
+      LocalQuery("select * from /r where not (this = 1)").execute(*source);
+  EXPECT_EQ(8, results->size());
+
+  results = LocalQuery("select * from /r where this = '1'").execute(*source);
+  EXPECT_EQ(0, results->size());
+}
+
+TEST(LocalQueryTest, projectsStructs) {
+  auto source = createSource();
+
+  auto results =
+      LocalQuery("select distinct this as a, this as b from /r where this = 2")
+          .execute(*source);
+  ASSERT_EQ(1, results->size());
+  auto row = std::dynamic_pointer_cast<Struct>((*results)[0]);
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>((*row)["b"])->value());
+}
+
+TEST(LocalQueryTest, usesIndexes) {
+  auto source = createSource();
+  createIndex(*source, "hash", QueryPath(), IndexType::HASH);
+
+  auto results = LocalQuery("select * from /r where this = 3").execute(*source);
+  EXPECT_EQ(2, results->size());
+  EXPECT_EQ(0, source->scans);
+
+  // a hash index cannot answer ordering comparisons
+  results = LocalQuery("select * from /r where this > 3").execute(*source);
+  EXPECT_EQ(2, results->size());
+  EXPECT_EQ(1, source->scans);
+
+  createIndex(*source, "range", QueryPath(), IndexType::RANGE);
+  results = LocalQuery("select * from /r where 3 < this and this <> 5")
+                .execute(*source);
+  EXPECT_EQ(2, results->size());
+  results = LocalQuery("select * from /r where this <= 1").execute(*source);
+  EXPECT_EQ(4, results->size());
+  EXPECT_EQ(1, source->scans);
+
+  // the index follows changes
+  source->put(0, CacheableInt32::create(3));
+  results = LocalQuery("select * from /r where this = 3").execute(*source);
+  EXPECT_EQ(3, results->size());
+  EXPECT_EQ(1, source->scans);
+}
+
+TEST(LocalQueryTest, indexPopulationKeepsNewerChanges) {
+  LocalIndexes indexes;
+  auto index = indexes.create("index", QueryPath(), IndexType::HASH);
+  EXPECT_THROW(indexes.create("index", QueryPath(), IndexType::RANGE),
+               apache::geode::client::IllegalStateException);
+
+  auto key = CacheableInt32::create(1);
+  indexes.put(key, CacheableInt32::create(2));
+  index->populate(key, CacheableInt32::create(1));
+  index->populated();
+
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  EXPECT_TRUE(index->find(QueryOperator::EQ, QueryValue::ofInteger(2), keys));
+  EXPECT_EQ(1, keys.size());
+  keys.clear();
+  EXPECT_TRUE(index->find(QueryOperator::EQ, QueryValue::ofInteger(1), keys));
+  EXPECT_TRUE(keys.empty());
+
+  EXPECT_TRUE(indexes.remove("index"));
+  EXPECT_FALSE(indexes.remove("index"));
+  EXPECT_TRUE(indexes.empty());
+}
+
+TEST(LocalQueryTest, unreadableValuesDisableIndexes) {
+  auto source = createSource();
+  createIndex(*source, "index", QueryPath({"id"}), IndexType::HASH);
+  auto index = source->indexes.find(QueryPath({"id"}), QueryOperator::EQ);
+  ASSERT_NE(nullptr, index);
+
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  EXPECT_FALSE(index->find(QueryOperator::EQ, QueryValue::ofInteger(1), keys));
+  EXPECT_THROW(LocalQuery("select * from /r where id = 1").execute(*source),
+               QueryException);
+}
+
+TEST(LocalQueryTest, appliesEvaluationsOnlyToTheIndexesEvaluatedFor) {
+  LocalIndexes indexes;
+  auto index = indexes.create("index", QueryPath(), IndexType::HASH);
+  index->populated();
+  auto key = CacheableInt32::create(1);
+
+  EXPECT_TRUE(indexes.put(key, indexes.evaluate(CacheableInt32::create(2))));
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  EXPECT_TRUE(index->find(QueryOperator::EQ, QueryValue::ofInteger(2), keys));
+  EXPECT_EQ(1, keys.size());
+
+  // an index created since the evaluation has no attribute for it
+  const auto evaluation = indexes.evaluate(CacheableInt32::create(3));
+  indexes.create("other", QueryPath(), IndexType::RANGE)->populated();
+  EXPECT_FALSE(indexes.put(key, evaluation));
+  keys.clear();
+  EXPECT_TRUE(index->find(QueryOperator::EQ, QueryValue::ofInteger(2), keys));
+  EXPECT_EQ(1, keys.size());
+
+  EXPECT_TRUE(indexes.put(key, indexes.evaluate(nullptr)));
+  keys.clear();
+  EXPECT_TRUE(index->find(QueryOperator::EQ, QueryValue::ofInteger(2), keys));
+  EXPECT_TRUE(keys.empty());
+}
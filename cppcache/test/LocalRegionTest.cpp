@@ -15,18 +15,124 @@
  * limitations under the License.
  */
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <geode/AuthenticatedView.hpp>
 #include <geode/Cache.hpp>
+#include <geode/CacheListener.hpp>
+#include <geode/CacheStatistics.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/EntryEvent.hpp>
 #include <geode/PoolManager.hpp>
 #include <geode/RegionFactory.hpp>
 #include <geode/RegionShortcut.hpp>
 
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "LocalRegion.hpp"
+#include "VersionTag.hpp"
+#include "VersionedCacheableObjectPartList.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
 using apache::geode::client::CacheClosedException;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheListener;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::CacheStatistics;
+using apache::geode::client::EntryEvent;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::IndexType;
+using apache::geode::client::LocalRegion;
+using apache::geode::client::Region;
 using apache::geode::client::RegionAttributesFactory;
 using apache::geode::client::RegionShortcut;
+using apache::geode::client::Serializable;
+using apache::geode::client::VersionedCacheableObjectPartList;
+using apache::geode::client::VersionTag;
+
+namespace {
+
+// the after create and after update events of a region, by key
+class RecordingListener : public CacheListener {
+ public:
+  struct Event {
+    std::string type;
+    std::shared_ptr<Serializable> oldValue;
+  };
+
+  void afterCreate(const EntryEvent& event) override {
+    record("create", event);
+  }
+
+  void afterUpdate(const EntryEvent& event) override {
+    record("update", event);
+  }
+
+  std::map<std::string, Event> events;
+
+ private:
+  void record(const std::string& type, const EntryEvent& event) {
+    events[event.getKey()->toString()] = Event{type, event.getOldValue()};
+  }
+};
+
+// a local region whose putAll comes back with the given entry versions, as
+// if a server had applied it
+class VersionedLocalRegion : public LocalRegion {
+ public:
+  VersionedLocalRegion(Cache& cache, const std::string& name,
+                       const std::shared_ptr<CacheListener>& listener)
+      : LocalRegion(name, CacheRegionHelper::getCacheImpl(&cache), nullptr,
+                    RegionAttributesFactory()
+                        .setCacheListener(listener)
+                        .setConcurrencyChecksEnabled(true)
+                        .create(),
+                    std::make_shared<CacheStatistics>()),
+        m_cacheImpl(CacheRegionHelper::getCacheImpl(&cache)) {}
+
+  std::map<std::string, int32_t> versions;
+
+ protected:
+  GfErrType putAllNoThrow_remote(
+      const HashMapOfCacheable& map,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      std::chrono::milliseconds,
+      const std::shared_ptr<Serializable>&) override {
+    versionedObjPartList = std::make_shared<VersionedCacheableObjectPartList>(
+        new std::vector<std::shared_ptr<CacheableKey>>(), m_responseLock);
+    // one tag per entry, in the order putAll applies them
+    std::vector<std::shared_ptr<VersionTag>> tags;
+    for (const auto& entry : map) {
+      tags.push_back(std::make_shared<VersionTag>(
+          versions[entry.first->toString()], 0, 0, 0, 0,
+          *m_cacheImpl->getMemberListForVersionStamp()));
+    }
+    versionedObjPartList->setVersionedTagptr(tags);
+    return GF_NOERR;
+  }
+
+ private:
+  CacheImpl* m_cacheImpl;
+  std::recursive_mutex m_responseLock;
+};
+
+int32_t cacheStat(Cache& cache, const std::string& name) {
+  return CacheRegionHelper::getCacheImpl(&cache)
+      ->getCachePerfStats()
+      .getStat()
+      ->getInt(name);
+}
+
+}  // namespace
 
 /**
  * Cache should close and throw exceptions on methods called after close.
@@ -77,3 +183,184 @@ TEST(LocalRegionTest, subRegions) {
   auto subRegions3 = rootRegion3->subregions(true);
   EXPECT_EQ(0, subRegions3.size());
 }
+
+TEST(LocalRegionTest, storeSerializedValues) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setStoreSerializedValues(true)
+                    .create("serializedRegion");
+  EXPECT_TRUE(region->getAttributes().getStoreSerializedValues());
+
+  region->put("key", "value");
+
+  auto value = std::dynamic_pointer_cast<CacheableString>(region->get("key"));
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ("value", value->value());
+
+  auto entry = region->getEntry(CacheableString::create("key"));
+  ASSERT_NE(nullptr, entry);
+  auto entryValue =
+      std::dynamic_pointer_cast<CacheableString>(entry->getValue());
+  ASSERT_NE(nullptr, entryValue);
+  EXPECT_EQ("value", entryValue->value());
+
+  auto values = region->values();
+  ASSERT_EQ(1, values.size());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<CacheableString>(values[0]));
+
+  EXPECT_FALSE(region->remove("key", "other"));
+  EXPECT_TRUE(region->containsKey("key"));
+  EXPECT_TRUE(region->remove("key", "value"));
+  EXPECT_FALSE(region->containsKey("key"));
+}
+
+TEST(LocalRegionTest, queriesCachedValues) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+
+  auto region =
+      cache.createRegionFactory(RegionShortcut::LOCAL).create("queryRegion");
+  for (int32_t i = 0; i < 10; i++) {
+    region->put(i, i % 5);
+  }
+
+  auto count = [&region](const std::string& condition) {
+    return region->query("select * from /queryRegion where " + condition)
+        ->size();
+  };
+
+  EXPECT_EQ(2, count("this = 3"));
+  EXPECT_EQ(1, region->query("this = 3")->size());
+  EXPECT_TRUE(region->existsValue("this > 3"));
+  EXPECT_EQ(nullptr, region->selectValue("this > 4"));
+
+  region->createIndex("byValue", "this", IndexType::RANGE);
+  EXPECT_THROW(region->createIndex("byValue", "this"), IllegalStateException);
+  EXPECT_EQ(4, count("this >= 3"));
+
+  region->put(0, 3);
+  region->destroy(1);
+  region->invalidate(2);
+  EXPECT_EQ(3, count("this = 3"));
+  EXPECT_EQ(1, count("this = 1"));
+  EXPECT_EQ(1, count("this = 2"));
+
+  EXPECT_TRUE(region->removeIndex("byValue"));
+  EXPECT_FALSE(region->removeIndex("byValue"));
+  EXPECT_EQ(3, count("this = 3"));
+}
+
+TEST(LocalRegionTest, putAllCountsCreatesAndUpdates) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto listener = std::make_shared<RecordingListener>();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCacheListener(listener)
+                    .create("putAllRegion");
+  region->put("a", "old a");
+  region->put("b", "old b");
+  listener->events.clear();
+
+  const auto puts = cacheStat(cache, "puts");
+  const auto creates = cacheStat(cache, "creates");
+  const auto entries = cacheStat(cache, "entries");
+
+  HashMapOfCacheable map;
+  for (const auto& key : {"a", "b", "c", "d", "e"}) {
+    map.emplace(CacheableString::create(key), CacheableString::create(key));
+  }
+  region->putAll(map);
+
+  EXPECT_EQ(puts + 2, cacheStat(cache, "puts"));
+  EXPECT_EQ(creates + 3, cacheStat(cache, "creates"));
+  EXPECT_EQ(entries + 3, cacheStat(cache, "entries"));
+  EXPECT_EQ(5, region->size());
+  for (const auto& key : {"a", "b", "c", "d", "e"}) {
+    auto value = std::dynamic_pointer_cast<CacheableString>(region->get(key));
+    ASSERT_NE(nullptr, value) << key;
+    EXPECT_EQ(key, value->value());
+  }
+
+  ASSERT_EQ(5, listener->events.size());
+  for (const auto& key : {"a", "b"}) {
+    const auto& event = listener->events[key];
+    EXPECT_EQ("update", event.type) << key;
+    auto oldValue = std::dynamic_pointer_cast<CacheableString>(event.oldValue);
+    ASSERT_NE(nullptr, oldValue) << key;
+    EXPECT_EQ(std::string("old ") + key, oldValue->value());
+  }
+  for (const auto& key : {"c", "d", "e"}) {
+    const auto& event = listener->events[key];
+    EXPECT_EQ("create", event.type) << key;
+    EXPECT_EQ(nullptr, event.oldValue) << key;
+  }
+}
+
+TEST(LocalRegionTest, putAllSkipsListenerForOlderVersion) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto listener = std::make_shared<RecordingListener>();
+  auto versioned =
+      std::make_shared<VersionedLocalRegion>(cache, "versioned", listener);
+  std::shared_ptr<Region> region = versioned;
+
+  versioned->versions = {{"stale", 5}, {"fresh", 5}};
+  region->putAll(
+      {{CacheableString::create("stale"), CacheableString::create("v5")},
+       {CacheableString::create("fresh"), CacheableString::create("v5")}});
+  ASSERT_EQ(2, listener->events.size());
+  listener->events.clear();
+
+  // the server's copy of "stale" is older than the cached one
+  versioned->versions = {{"stale", 3}, {"fresh", 6}};
+  region->putAll(
+      {{CacheableString::create("stale"), CacheableString::create("v3")},
+       {CacheableString::create("fresh"), CacheableString::create("v6")}});
+
+  ASSERT_EQ(1, listener->events.size());
+  const auto& event = listener->events["fresh"];
+  EXPECT_EQ("update", event.type);
+  auto oldValue = std::dynamic_pointer_cast<CacheableString>(event.oldValue);
+  ASSERT_NE(nullptr, oldValue);
+  EXPECT_EQ("v5", oldValue->value());
+
+  auto stale =
+      std::dynamic_pointer_cast<CacheableString>(region->get("stale"));
+  ASSERT_NE(nullptr, stale);
+  EXPECT_EQ("v5", stale->value());
+  auto fresh =
+      std::dynamic_pointer_cast<CacheableString>(region->get("fresh"));
+  ASSERT_NE(nullptr, fresh);
+  EXPECT_EQ("v6", fresh->value());
+}
+
+TEST(LocalRegionTest, putAllLargeBatch) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region =
+      cache.createRegionFactory(RegionShortcut::LOCAL).create("bulkRegion");
+
+  // more than ConcurrentEntriesMap puts before going parallel
+  const int32_t count = 80 * 1024;
+  HashMapOfCacheable firstHalf;
+  HashMapOfCacheable all;
+  for (int32_t i = 0; i < count; i++) {
+    if (i < count / 2) {
+      firstHalf.emplace(CacheableInt32::create(i), CacheableInt32::create(i));
+    }
+    all.emplace(CacheableInt32::create(i), CacheableInt32::create(i + 1));
+  }
+  region->putAll(firstHalf);
+
+  const auto puts = cacheStat(cache, "puts");
+  const auto creates = cacheStat(cache, "creates");
+  const auto entries = cacheStat(cache, "entries");
+  region->putAll(all);
+
+  EXPECT_EQ(puts + count / 2, cacheStat(cache, "puts"));
+  EXPECT_EQ(creates + count / 2, cacheStat(cache, "creates"));
+  EXPECT_EQ(entries + count / 2, cacheStat(cache, "entries"));
+  ASSERT_EQ(count, region->size());
+  for (int32_t i = 0; i < count; i++) {
+    auto value = std::dynamic_pointer_cast<CacheableInt32>(region->get(i));
+    ASSERT_NE(nullptr, value) << i;
+    EXPECT_EQ(i + 1, value->value()) << i;
+  }
+}
@@ -0,0 +1,80 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "MapEntryPool.hpp"
+#include "MapEntryT.hpp"
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::MapEntryImpl;
+using apache::geode::client::MapEntryPool;
+using apache::geode::client::MapEntryT;
+using apache::geode::client::VersionedMapEntryImpl;
+
+TEST(MapEntryPoolTest, reusesFreedBlocks) {
+  auto pool = new MapEntryPool();
+
+  auto first = pool->allocate(64);
+  pool->deallocate(first, 64);
+  auto second = pool->allocate(64);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(1, pool->liveCount());
+
+  pool->deallocate(second, 64);
+  pool->close();
+}
+
+TEST(MapEntryPoolTest, trimReleasesSlabsWhenEmpty) {
+  auto pool = new MapEntryPool();
+
+  std::vector<std::shared_ptr<MapEntryImpl>> entries;
+  for (int32_t i = 0; i < 1000; i++) {
+    entries.push_back(MapEntryT<VersionedMapEntryImpl, 0, 0>::create(
+        pool, CacheableInt32::create(i)));
+  }
+  EXPECT_EQ(1000, pool->liveCount());
+  EXPECT_LT(1, pool->slabCount());
+
+  auto slabs = pool->slabCount();
+  entries.clear();
+  EXPECT_EQ(0, pool->liveCount());
+  EXPECT_EQ(slabs, pool->slabCount());
+
+  pool->trim();
+  EXPECT_EQ(1, pool->slabCount());
+
+  pool->close();
+}
+
+TEST(MapEntryPoolTest, entriesOutliveClose) {
+  auto pool = new MapEntryPool();
+
+  auto entry =
+      MapEntryT<MapEntryImpl, 0, 0>::create(pool, CacheableInt32::create(1));
+  pool->close();
+
+  std::shared_ptr<apache::geode::client::CacheableKey> key;
+  entry->getKey(key);
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt32>(key)->value());
+  entry = nullptr;
+}
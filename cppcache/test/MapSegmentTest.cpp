@@ -0,0 +1,225 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/DataSerializable.hpp>
+#include <geode/Delta.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "LocalRegion.hpp"
+#include "MapEntry.hpp"
+#include "SerializedCacheable.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::DataInput;
+using apache::geode::client::DataOutput;
+using apache::geode::client::DataSerializable;
+using apache::geode::client::Delta;
+using apache::geode::client::LocalRegion;
+using apache::geode::client::MapEntryImpl;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+using apache::geode::client::Serializable;
+using apache::geode::client::SerializedCacheable;
+
+namespace {
+
+// a counter whose delta is the amount to add
+class Counter : public DataSerializable, public Delta {
+ public:
+  explicit Counter(int32_t value = 0) : m_value(value) {}
+
+  int32_t value() const { return m_value; }
+
+  void toData(DataOutput& output) const override { output.writeInt(m_value); }
+
+  void fromData(DataInput& input) override { m_value = input.readInt32(); }
+
+  bool hasDelta() const override { return false; }
+
+  void toDelta(DataOutput& output) const override { output.writeInt(0); }
+
+  void fromDelta(DataInput& input) override {
+    m_value += input.readInt32();
+    if (onDelta) {
+      auto hook = onDelta;
+      onDelta = nullptr;
+      hook();
+    }
+  }
+
+  std::shared_ptr<Delta> clone() const override {
+    return std::make_shared<Counter>(m_value);
+  }
+
+  // runs once, after the next delta is applied and before it is published
+  static std::function<void()> onDelta;
+
+  static std::shared_ptr<Serializable> createDeserializable() {
+    return std::make_shared<Counter>();
+  }
+
+ private:
+  int32_t m_value;
+};
+
+std::function<void()> Counter::onDelta;
+
+class MapSegmentPutDeltaTest : public ::testing::Test {
+ protected:
+  MapSegmentPutDeltaTest()
+      : m_cache(CacheFactory{}.set("log-level", "none").create()) {
+    m_cache.getTypeRegistry().registerType(Counter::createDeserializable, 1);
+  }
+
+  ~MapSegmentPutDeltaTest() override {
+    Counter::onDelta = nullptr;
+    m_cache.close();
+  }
+
+  std::shared_ptr<Region> createRegion(bool cloningEnabled,
+                                       bool storeSerializedValues = false) {
+    return m_cache.createRegionFactory(RegionShortcut::LOCAL)
+        .setCloningEnabled(cloningEnabled)
+        .setStoreSerializedValues(storeSerializedValues)
+        .create("region");
+  }
+
+  // applies a delta adding amount to the value of key, as an update from the
+  // server would
+  int applyDelta(const std::shared_ptr<Region>& region, const char* key,
+                 int32_t amount) {
+    auto output = m_cache.createDataOutput();
+    output.writeInt(amount);
+    auto delta = m_cache.createDataInput(output.getBuffer(),
+                                         output.getBufferLength());
+
+    std::shared_ptr<Cacheable> newValue;
+    std::shared_ptr<MapEntryImpl> entry;
+    std::shared_ptr<Cacheable> oldValue;
+    bool isUpdate = false;
+    return std::dynamic_pointer_cast<LocalRegion>(region)
+        ->getEntryMap()
+        ->put(CacheableString::create(key), newValue, entry, oldValue, -1, 0,
+              nullptr, isUpdate, &delta);
+  }
+
+  int32_t deltaApplyRetries() {
+    return CacheRegionHelper::getCacheImpl(&m_cache)
+        ->getCachePerfStats()
+        .getStat()
+        ->getInt("deltaApplyRetries");
+  }
+
+  std::shared_ptr<Cacheable> storedValueOf(
+      const std::shared_ptr<Region>& region, const char* key) {
+    std::shared_ptr<Cacheable> value;
+    std::shared_ptr<MapEntryImpl> entry;
+    std::dynamic_pointer_cast<LocalRegion>(region)->getEntryMap()->get(
+        CacheableString::create(key), value, entry);
+    return value;
+  }
+
+  int32_t valueOf(const std::shared_ptr<Region>& region, const char* key) {
+    auto value = std::dynamic_pointer_cast<Counter>(region->get(key));
+    EXPECT_NE(nullptr, value);
+    return value ? value->value() : -1;
+  }
+
+  Cache m_cache;
+};
+
+}  // namespace
+
+TEST_F(MapSegmentPutDeltaTest, appliesDeltaToClone) {
+  auto region = createRegion(true);
+  auto original = std::make_shared<Counter>(10);
+  region->put("key", original);
+
+  EXPECT_EQ(GF_NOERR, applyDelta(region, "key", 5));
+
+  EXPECT_EQ(15, valueOf(region, "key"));
+  EXPECT_EQ(10, original->value());
+  EXPECT_EQ(0, deltaApplyRetries());
+}
+
+TEST_F(MapSegmentPutDeltaTest, retriesDeltaOnValueReplacedWhileApplying) {
+  auto region = createRegion(true);
+  region->put("key", std::make_shared<Counter>(10));
+  Counter::onDelta = [&region]() {
+    region->put("key", std::make_shared<Counter>(100));
+  };
+
+  EXPECT_EQ(GF_NOERR, applyDelta(region, "key", 5));
+
+  // the delta is read again from the start and applied to the new value
+  EXPECT_EQ(105, valueOf(region, "key"));
+  EXPECT_EQ(1, deltaApplyRetries());
+}
+
+TEST_F(MapSegmentPutDeltaTest, appliesDeltaInPlaceWithoutCloning) {
+  auto region = createRegion(false);
+  auto original = std::make_shared<Counter>(10);
+  region->put("key", original);
+
+  EXPECT_EQ(GF_NOERR, applyDelta(region, "key", 5));
+
+  EXPECT_EQ(15, valueOf(region, "key"));
+  EXPECT_EQ(15, original->value());
+  EXPECT_EQ(0, deltaApplyRetries());
+}
+
+TEST_F(MapSegmentPutDeltaTest, failsInPlaceDeltaOnValueReplacedWhileApplying) {
+  auto region = createRegion(false);
+  region->put("key", std::make_shared<Counter>(10));
+  Counter::onDelta = [&region]() {
+    region->put("key", std::make_shared<Counter>(100));
+  };
+
+  // the delta cannot be applied twice, so the full value must be fetched
+  EXPECT_EQ(GF_INVALID_DELTA, applyDelta(region, "key", 5));
+
+  EXPECT_EQ(100, valueOf(region, "key"));
+  EXPECT_EQ(0, deltaApplyRetries());
+}
+
+TEST_F(MapSegmentPutDeltaTest, appliesDeltaToSerializedValue) {
+  auto region = createRegion(true, true);
+  region->put("key", std::make_shared<Counter>(10));
+
+  EXPECT_EQ(GF_NOERR, applyDelta(region, "key", 5));
+
+  // the result is stored serialized again
+  EXPECT_NE(nullptr, std::dynamic_pointer_cast<SerializedCacheable>(
+                         storedValueOf(region, "key")));
+  EXPECT_EQ(15, valueOf(region, "key"));
+  EXPECT_EQ(0, deltaApplyRetries());
+}
@@ -0,0 +1,224 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "Lz4Codec.hpp"
+#include "MessageCompressor.hpp"
+
+using apache::geode::client::Lz4Codec;
+using apache::geode::client::MessageCompressor;
+using apache::geode::client::MessageException;
+
+namespace {
+
+void writeInt(std::vector<char>& out, size_t value) {
+  out.push_back(static_cast<char>(value >> 24));
+  out.push_back(static_cast<char>(value >> 16));
+  out.push_back(static_cast<char>(value >> 8));
+  out.push_back(static_cast<char>(value));
+}
+
+void addPart(std::vector<char>& parts, const std::string& payload,
+             char type = 0) {
+  writeInt(parts, payload.size());
+  parts.push_back(type);
+  parts.insert(parts.end(), payload.begin(), payload.end());
+}
+
+std::vector<char> createMessage(const std::vector<char>& parts) {
+  std::vector<char> message;
+  writeInt(message, 7);  // type
+  writeInt(message, parts.size());
+  writeInt(message, 3);  // number of parts
+  writeInt(message, 1);  // transaction id
+  message.push_back(0);
+  message.insert(message.end(), parts.begin(), parts.end());
+  return message;
+}
+
+std::string repetitive(size_t length) {
+  std::string text;
+  while (text.size() < length) {
+    text += "{\"id\": " + std::to_string(text.size() % 97) + ", \"name\": ";
+  }
+  text.resize(length);
+  return text;
+}
+
+std::string random(size_t length) {
+  std::mt19937 generator(length);
+  std::string text(length, '\0');
+  for (auto& c : text) {
+    c = static_cast<char>(generator());
+  }
+  return text;
+}
+
+std::string roundTrip(const std::string& text) {
+  std::vector<uint8_t> block(Lz4Codec::compressBound(text.size()));
+  const auto length = Lz4Codec::compress(
+      reinterpret_cast<const uint8_t*>(text.data()), text.size(), block.data());
+  EXPECT_LE(length, block.size());
+
+  std::string expanded(text.size(), '\0');
+  EXPECT_TRUE(Lz4Codec::expand(block.data(), length,
+                               reinterpret_cast<uint8_t*>(&expanded[0]),
+                               expanded.size()));
+  return expanded;
+}
+
+// what a server that accepted compression does with a request
+std::vector<char> expandMessage(const std::vector<char>& message) {
+  const auto parts = message.data() + MessageCompressor::HEADER_LENGTH;
+  const auto length = message.size() - MessageCompressor::HEADER_LENGTH;
+  size_t expandedLength;
+  if (!MessageCompressor::isCompressed(parts, length, expandedLength)) {
+    return message;
+  }
+
+  std::vector<char> expanded(MessageCompressor::HEADER_LENGTH +
+                             expandedLength);
+  std::memcpy(expanded.data(), message.data(),
+              MessageCompressor::HEADER_LENGTH);
+  MessageCompressor::setMessageLength(expanded.data(), expandedLength);
+  MessageCompressor::Totals totals;
+  MessageCompressor::expand(
+      parts, length, expanded.data() + MessageCompressor::HEADER_LENGTH,
+      totals);
+  return expanded;
+}
+
+}  // namespace
+
+TEST(MessageCompressorTest, codecRoundTrips) {
+  for (size_t length : {0, 1, 12, 13, 100, 4096, 100000}) {
+    EXPECT_EQ(repetitive(length), roundTrip(repetitive(length)));
+    EXPECT_EQ(random(length), roundTrip(random(length)));
+  }
+  // matches that overlap what they produce
+  EXPECT_EQ(std::string(70000, 'a'), roundTrip(std::string(70000, 'a')));
+}
+
+TEST(MessageCompressorTest, codecRejectsMalformedBlocks) {
+  const auto text = repetitive(1000);
+  std::vector<uint8_t> block(Lz4Codec::compressBound(text.size()));
+  const auto length = Lz4Codec::compress(
+      reinterpret_cast<const uint8_t*>(text.data()), text.size(), block.data());
+  EXPECT_LT(length, text.size() / 4);
+
+  std::vector<uint8_t> expanded(text.size() + 1);
+  EXPECT_FALSE(Lz4Codec::expand(block.data(), length, expanded.data(),
+                                text.size() - 1));
+  EXPECT_FALSE(Lz4Codec::expand(block.data(), length, expanded.data(),
+                                text.size() + 1));
+  EXPECT_FALSE(Lz4Codec::expand(block.data(), length / 2, expanded.data(),
+                                text.size()));
+
+  // a match reaching back before the start of the output
+  const uint8_t badOffset[] = {0x10, 'a', 0x10, 0x00, 0x00};
+  EXPECT_FALSE(
+      Lz4Codec::expand(badOffset, sizeof(badOffset), expanded.data(), 5));
+}
+
+TEST(MessageCompressorTest, compressesLargeCompressibleParts) {
+  std::vector<char> parts;
+  addPart(parts, "key");
+  addPart(parts, repetitive(10000), 1);
+  addPart(parts, random(10000));
+  const auto message = createMessage(parts);
+
+  std::vector<char> compressed;
+  MessageCompressor::Totals totals;
+  ASSERT_TRUE(MessageCompressor(1024).compress(message.data(), message.size(),
+                                               compressed, totals));
+  EXPECT_EQ(1, totals.parts);
+  EXPECT_EQ(10000, totals.inputBytes);
+  EXPECT_GT(compressed.size(), totals.outputBytes);
+  EXPECT_LT(compressed.size(), message.size() - 5000);
+
+  // only the length changes in the header
+  std::vector<char> header;
+  writeInt(header, compressed.size() - MessageCompressor::HEADER_LENGTH);
+  EXPECT_TRUE(std::equal(header.begin(), header.end(), compressed.begin() + 4));
+  EXPECT_TRUE(std::equal(compressed.begin() + 8, compressed.begin() + 17,
+                         message.begin() + 8));
+
+  // the part type keeps its original bits
+  const auto type = compressed[MessageCompressor::HEADER_LENGTH + 8 + 4];
+  EXPECT_EQ(MessageCompressor::COMPRESSED_PART | 1,
+            static_cast<uint8_t>(type));
+
+  EXPECT_EQ(message, expandMessage(compressed));
+}
+
+TEST(MessageCompressorTest, leavesMessagesWithoutLargePartsAlone) {
+  std::vector<char> parts;
+  addPart(parts, repetitive(1000));
+  addPart(parts, random(10000));
+  const auto message = createMessage(parts);
+
+  std::vector<char> compressed;
+  MessageCompressor::Totals totals;
+  EXPECT_FALSE(MessageCompressor(1024).compress(
+      message.data(), message.size(), compressed, totals));
+  EXPECT_TRUE(compressed.empty());
+  EXPECT_EQ(0, totals.parts);
+
+  size_t expandedLength;
+  EXPECT_FALSE(MessageCompressor::isCompressed(
+      message.data() + MessageCompressor::HEADER_LENGTH,
+      message.size() - MessageCompressor::HEADER_LENGTH, expandedLength));
+  EXPECT_EQ(message.size() - MessageCompressor::HEADER_LENGTH, expandedLength);
+}
+
+TEST(MessageCompressorTest, rejectsMalformedParts) {
+  std::vector<char> parts;
+  addPart(parts, repetitive(10000));
+  auto message = createMessage(parts);
+  std::vector<char> compressed;
+  MessageCompressor::Totals totals;
+  ASSERT_TRUE(MessageCompressor(1024).compress(message.data(), message.size(),
+                                               compressed, totals));
+
+  size_t expandedLength;
+  EXPECT_THROW(MessageCompressor::isCompressed(
+                   compressed.data() + MessageCompressor::HEADER_LENGTH,
+                   compressed.size() - MessageCompressor::HEADER_LENGTH - 1,
+                   expandedLength),
+               MessageException);
+
+  // claim one more byte than the block expands to
+  auto& last = compressed[MessageCompressor::HEADER_LENGTH + 8];
+  ++last;
+  ASSERT_TRUE(MessageCompressor::isCompressed(
+      compressed.data() + MessageCompressor::HEADER_LENGTH,
+      compressed.size() - MessageCompressor::HEADER_LENGTH, expandedLength));
+  std::vector<char> expanded(expandedLength);
+  EXPECT_THROW(MessageCompressor::expand(
+                   compressed.data() + MessageCompressor::HEADER_LENGTH,
+                   compressed.size() - MessageCompressor::HEADER_LENGTH,
+                   expanded.data(), totals),
+               MessageException);
+}
@@ -0,0 +1,165 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxFieldType.hpp"
+#include "PdxInstanceImpl.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxTypes.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheImpl;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxFieldType;
+using apache::geode::client::PdxFieldTypes;
+using apache::geode::client::PdxInstanceImpl;
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypes;
+
+namespace {
+
+class PdxInstanceImplTest : public ::testing::Test {
+ protected:
+  PdxInstanceImplTest()
+      : m_cache(CacheFactory{}.set("log-level", "none").create()),
+        m_cacheImpl(CacheRegionHelper::getCacheImpl(&m_cache)) {}
+
+  ~PdxInstanceImplTest() override { m_cache.close(); }
+
+  // registers a type of int fields, as if it had been fetched from the server
+  std::shared_ptr<PdxType> registerType(
+      int32_t typeId, const std::vector<std::string>& fields,
+      const std::vector<std::string>& identityFields = {}) {
+    auto pdxType = std::make_shared<PdxType>(
+        *m_cacheImpl->getPdxTypeRegistry(), "PdxInstanceImplTest", false);
+    for (const auto& field : fields) {
+      pdxType->addFixedLengthTypeField(field, "int", PdxFieldTypes::INT,
+                                       PdxTypes::INTEGER_SIZE);
+    }
+    for (const auto& field : identityFields) {
+      pdxType->getPdxField(field)->setIdentityField(true);
+    }
+    pdxType->InitializeType();
+    pdxType->setTypeId(typeId);
+    m_cacheImpl->getPdxTypeRegistry()->addPdxType(typeId, pdxType);
+    return pdxType;
+  }
+
+  // an instance as deserialized from a stream holding values in field order
+  std::shared_ptr<PdxInstanceImpl> createInstance(
+      int32_t typeId, const std::vector<int32_t>& values) {
+    auto output = m_cache.createDataOutput();
+    for (auto value : values) {
+      output.writeInt(value);
+    }
+    return std::make_shared<PdxInstanceImpl>(
+        const_cast<uint8_t*>(output.getBuffer()),
+        static_cast<int>(output.getBufferLength()), typeId,
+        m_cacheImpl->getCachePerfStats(), *m_cacheImpl->getPdxTypeRegistry(),
+        *m_cacheImpl, false);
+  }
+
+  static std::vector<std::string> names(
+      const std::vector<std::shared_ptr<PdxFieldType>>& fields) {
+    std::vector<std::string> fieldNames;
+    for (const auto& field : fields) {
+      fieldNames.push_back(field->getFieldName());
+    }
+    return fieldNames;
+  }
+
+  Cache m_cache;
+  CacheImpl* m_cacheImpl;
+};
+
+}  // namespace
+
+TEST_F(PdxInstanceImplTest, identityFieldsAreAllFieldsByNameWithoutIdentity) {
+  auto pdxType = registerType(1, {"c", "a", "b"});
+
+  const std::vector<std::string> expected{"a", "b", "c"};
+  EXPECT_EQ(expected, names(*pdxType->getIdentityPdxFields()));
+}
+
+TEST_F(PdxInstanceImplTest, identityFieldsAreMarkedFieldsByName) {
+  auto pdxType = registerType(1, {"c", "a", "b"}, {"c", "a"});
+
+  const std::vector<std::string> expected{"a", "c"};
+  EXPECT_EQ(expected, names(*pdxType->getIdentityPdxFields()));
+  EXPECT_EQ(pdxType->getIdentityPdxFields(), pdxType->getIdentityPdxFields());
+}
+
+TEST_F(PdxInstanceImplTest, instancesWithSameBytesAreEqual) {
+  registerType(1, {"a", "b"});
+  auto instance = createInstance(1, {1, 2});
+  auto other = createInstance(1, {1, 2});
+
+  EXPECT_TRUE(*instance == *other);
+  EXPECT_TRUE(*other == *instance);
+  EXPECT_EQ(instance->hashcode(), other->hashcode());
+  EXPECT_TRUE(*instance == *other);
+}
+
+TEST_F(PdxInstanceImplTest, instancesWithSameIdentityFieldsAreEqual) {
+  registerType(1, {"a", "b"}, {"a"});
+  auto instance = createInstance(1, {1, 2});
+  auto other = createInstance(1, {1, 3});
+
+  EXPECT_TRUE(*instance == *other);
+
+  // the cached hashcodes cover only the identity fields, so they agree
+  EXPECT_EQ(instance->hashcode(), other->hashcode());
+  EXPECT_TRUE(*instance == *other);
+}
+
+TEST_F(PdxInstanceImplTest, instancesWithDifferentIdentityFieldsAreNotEqual) {
+  registerType(1, {"a", "b"});
+  auto instance = createInstance(1, {1, 2});
+  auto other = createInstance(1, {1, 3});
+
+  EXPECT_FALSE(*instance == *other);
+
+  EXPECT_NE(instance->hashcode(), other->hashcode());
+  EXPECT_FALSE(*instance == *other);
+  EXPECT_FALSE(*other == *instance);
+}
+
+TEST_F(PdxInstanceImplTest, hashcodeFollowsSetFieldOnceReserialized) {
+  registerType(1, {"a", "b"});
+  auto instance = createInstance(1, {1, 2});
+  const auto hashcode = instance->hashcode();
+
+  instance->setField("a", static_cast<int32_t>(5));
+  auto output = m_cache.createDataOutput();
+  output.writeObject(instance);
+
+  auto expected = createInstance(1, {5, 2});
+  EXPECT_NE(hashcode, instance->hashcode());
+  EXPECT_EQ(expected->hashcode(), instance->hashcode());
+  EXPECT_TRUE(*expected == *instance);
+}
@@ -0,0 +1,171 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableDate.hpp>
+#include <geode/PdxSerializableFields.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxLocalWriter.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableDate;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxLocalWriter;
+using apache::geode::client::PdxSerializableFields;
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypeRegistry;
+using apache::geode::client::PdxWriterWithTypeCollector;
+
+namespace {
+
+// fixed and variable length fields interleaved, so that fixed fields are
+// placed both from the start and relative to a variable length field
+class Record : public PdxSerializableFields<Record> {
+ public:
+  Record(int32_t id, std::shared_ptr<CacheableDate> created, std::string name,
+         std::vector<std::string> tags,
+         std::shared_ptr<CacheableDate> updated,
+         std::vector<int32_t> counts, double price)
+      : id_(id),
+        created_(std::move(created)),
+        name_(std::move(name)),
+        tags_(std::move(tags)),
+        updated_(std::move(updated)),
+        counts_(std::move(counts)),
+        price_(price) {}
+
+  ~Record() noexcept override = default;
+
+  template <class TFields>
+  static void pdxFields(TFields& fields) {
+    fields("id", &Record::id_);
+    fields("created", &Record::created_);
+    fields("name", &Record::name_);
+    fields("tags", &Record::tags_);
+    fields("updated", &Record::updated_);
+    fields("counts", &Record::counts_);
+    fields("price", &Record::price_);
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "PdxSerializableFieldsTest.Record";
+    return className;
+  }
+
+ private:
+  int32_t id_;
+  std::shared_ptr<CacheableDate> created_;
+  std::string name_;
+  std::vector<std::string> tags_;
+  std::shared_ptr<CacheableDate> updated_;
+  std::vector<int32_t> counts_;
+  double price_;
+};
+
+class PdxSerializableFieldsTest : public ::testing::Test {
+ protected:
+  PdxSerializableFieldsTest()
+      : m_cache(CacheFactory{}.set("log-level", "none").create()),
+        m_pdxTypeRegistry(
+            CacheRegionHelper::getCacheImpl(&m_cache)->getPdxTypeRegistry()) {}
+
+  ~PdxSerializableFieldsTest() override { m_cache.close(); }
+
+  // collects the type of record as the first serialization would
+  std::shared_ptr<PdxType> collectType(const Record& record) {
+    auto output = m_cache.createDataOutput();
+    PdxWriterWithTypeCollector writer(output, record.getClassName(),
+                                      m_pdxTypeRegistry);
+    record.toData(writer);
+    writer.endObjectWriting();
+
+    auto pdxType = writer.getPdxLocalType();
+    pdxType->InitializeType();
+    pdxType->setTypeId(1);
+    return pdxType;
+  }
+
+  // the whole pdx stream, header and offset table included
+  std::vector<uint8_t> serialize(const Record& record,
+                                 const std::shared_ptr<PdxType>& pdxType,
+                                 bool writeFields) {
+    auto output = m_cache.createDataOutput();
+    PdxLocalWriter writer(output, pdxType, m_pdxTypeRegistry);
+    if (writeFields) {
+      writer.writeFields(record);
+    } else {
+      record.toData(writer);
+    }
+    writer.endObjectWriting();
+    return std::vector<uint8_t>(
+        output.getBuffer(), output.getBuffer() + output.getBufferLength());
+  }
+
+  void expectSameStream(const Record& record) {
+    auto pdxType = collectType(record);
+    auto written = serialize(record, pdxType, false);
+    auto writtenFields = serialize(record, pdxType, true);
+    EXPECT_EQ(written, writtenFields);
+  }
+
+  Cache m_cache;
+  std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
+};
+
+std::shared_ptr<CacheableDate> date(int64_t millis) {
+  return CacheableDate::create(CacheableDate::duration(millis));
+}
+
+}  // namespace
+
+TEST_F(PdxSerializableFieldsTest, writesSameStreamAsToData) {
+  expectSameStream(Record(1, date(1500000000000), "name", {"a", "bc"},
+                          date(1600000000000), {1, 2, 3}, 1.5));
+}
+
+TEST_F(PdxSerializableFieldsTest, writesSameStreamWithNullDate) {
+  expectSameStream(
+      Record(2, date(1500000000000), "name", {"a"}, nullptr, {4}, 2.5));
+}
+
+TEST_F(PdxSerializableFieldsTest, writesSameStreamWithEmptyFields) {
+  expectSameStream(Record(3, nullptr, "", {}, nullptr, {}, 0.0));
+}
+
+TEST_F(PdxSerializableFieldsTest, writesSameStreamWithTwoByteOffsets) {
+  expectSameStream(Record(4, date(1500000000000), std::string(300, 'x'),
+                          {"a", std::string(100, 'y')}, date(1600000000000),
+                          {5, 6}, 3.5));
+}
+
+TEST_F(PdxSerializableFieldsTest, writesSameStreamWithFourByteOffsets) {
+  expectSameStream(Record(5, date(1500000000000), std::string(70000, 'x'),
+                          {"a", "b"}, nullptr, {7}, 4.5));
+}
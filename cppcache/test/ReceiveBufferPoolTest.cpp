@@ -0,0 +1,57 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "ReceiveBufferPool.hpp"
+
+using apache::geode::client::ReceiveBufferPool;
+using apache::geode::client::ReceiveBufferPtr;
+
+TEST(ReceiveBufferPoolTest, reusesReleasedBufferOfSameClass) {
+  auto first = ReceiveBufferPool::allocate(300);
+  std::memset(first, 0, 300);
+  ReceiveBufferPool::release(first);
+
+  // 300 and 500 bytes share the 512 byte class
+  auto second = ReceiveBufferPool::allocate(500);
+  EXPECT_EQ(first, second);
+  ReceiveBufferPool::release(second);
+}
+
+TEST(ReceiveBufferPoolTest, doesNotShareBuffersAcrossClasses) {
+  auto small = ReceiveBufferPool::allocate(100);
+  ReceiveBufferPool::release(small);
+
+  auto large = ReceiveBufferPool::allocate(4096);
+  EXPECT_NE(small, large);
+  std::memset(large, 0, 4096);
+  ReceiveBufferPool::release(large);
+}
+
+TEST(ReceiveBufferPoolTest, handlesBuffersLargerThanLargestClass) {
+  const size_t size = (1 << ReceiveBufferPool::kMaxClassShift) + 1;
+  ReceiveBufferPtr<uint8_t> buffer(ReceiveBufferPool::allocate(size));
+  buffer.get()[size - 1] = 1;
+  EXPECT_EQ(1, buffer.get()[size - 1]);
+}
+
+TEST(ReceiveBufferPoolTest, ignoresNullptr) {
+  ReceiveBufferPool::release(nullptr);
+}
@@ -77,3 +77,12 @@ TEST(RegionAttributesFactoryTest, setLruEntriesLimit) {
                               .create();
   EXPECT_EQ(regionAttributes.getLruEntriesLimit(), 2u);
 }
+
+TEST(RegionAttributesFactoryTest, setStoreSerializedValues) {
+  RegionAttributesFactory regionAttributesFactory;
+  EXPECT_FALSE(regionAttributesFactory.create().getStoreSerializedValues());
+
+  auto regionAttributes =
+      regionAttributesFactory.setStoreSerializedValues(true).create();
+  EXPECT_TRUE(regionAttributes.getStoreSerializedValues());
+}
@@ -0,0 +1,185 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+#include <geode/StructSet.hpp>
+
+#include "ResultStreamImpl.hpp"
+
+using apache::geode::client::CacheClosedException;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableVector;
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::QueryException;
+using apache::geode::client::ResultStream;
+using apache::geode::client::ResultStreamImpl;
+using apache::geode::client::ResultStreamManager;
+using apache::geode::client::Struct;
+using apache::geode::client::StructSet;
+using apache::geode::client::TimeoutException;
+
+namespace {
+
+template <class Predicate>
+bool eventually(Predicate predicate) {
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(ResultStreamTest, handsOutResultsAsTheyArrive) {
+  ResultStreamManager streams;
+  auto stream = streams.start(
+      10, [](const std::shared_ptr<ResultStreamImpl>& producer) {
+        for (int32_t i = 0; i < 3; i++) {
+          producer->add(CacheableInt32::create(i));
+        }
+      });
+
+  size_t count = 0;
+  while (auto batch = stream->next(std::chrono::seconds(5))) {
+    count += batch->size();
+  }
+  EXPECT_EQ(3, count);
+  EXPECT_EQ(nullptr, stream->next());
+}
+
+TEST(ResultStreamTest, blocksProducerWhileBufferIsFull) {
+  std::atomic<int32_t> added(0);
+  ResultStreamManager streams;
+  auto stream = streams.start(
+      2, [&added](const std::shared_ptr<ResultStreamImpl>& producer) {
+        for (int32_t i = 0; i < 5; i++) {
+          producer->add(CacheableInt32::create(i));
+          ++added;
+        }
+      });
+
+  ASSERT_TRUE(eventually([&added] { return added == 2; }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(2, added);
+
+  size_t count = stream->next(std::chrono::seconds(5))->size();
+  EXPECT_EQ(2, count);
+  while (auto batch = stream->next(std::chrono::seconds(5))) {
+    count += batch->size();
+  }
+  EXPECT_EQ(5, count);
+}
+
+TEST(ResultStreamTest, releasingStreamStopsProducer) {
+  auto done = std::make_shared<std::atomic<bool>>(false);
+  ResultStreamManager streams;
+  auto stream = streams.start(
+      1, [done](const std::shared_ptr<ResultStreamImpl>& producer) {
+        for (int32_t i = 0; i < 100; i++) {
+          producer->add(CacheableInt32::create(i));
+        }
+        *done = true;
+      });
+
+  stream = nullptr;
+  EXPECT_TRUE(eventually([done] { return done->load(); }));
+}
+
+TEST(ResultStreamTest, handsOutWholeStructs) {
+  ResultStreamImpl stream(10);
+  auto values = CacheableVector::create();
+  for (int32_t i = 0; i < 3; i++) {
+    values->push_back(CacheableInt32::create(i));
+  }
+  stream.add({"a", "b"}, values);
+
+  auto batch = std::dynamic_pointer_cast<StructSet>(stream.next());
+  ASSERT_NE(nullptr, batch);
+  ASSERT_EQ(1, batch->size());
+  auto row = std::dynamic_pointer_cast<Struct>((*batch)[0]);
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt32>((*row)["b"])->value());
+
+  values->clear();
+  values->push_back(CacheableInt32::create(3));
+  stream.add({"a", "b"}, values);
+  stream.end();
+  batch = std::dynamic_pointer_cast<StructSet>(stream.next());
+  ASSERT_NE(nullptr, batch);
+  row = std::dynamic_pointer_cast<Struct>((*batch)[0]);
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>((*row)["a"])->value());
+  EXPECT_EQ(nullptr, stream.next());
+}
+
+TEST(ResultStreamTest, reportsErrorAfterEarlierResults) {
+  ResultStreamManager streams;
+  auto stream = streams.start(
+      10, [](const std::shared_ptr<ResultStreamImpl>& producer) {
+        producer->add(CacheableInt32::create(1));
+        throw QueryException("failed");
+      });
+
+  EXPECT_EQ(1, stream->next(std::chrono::seconds(5))->size());
+  EXPECT_THROW(stream->next(std::chrono::seconds(5)), QueryException);
+}
+
+TEST(ResultStreamTest, retryFailsOnceResultsWereTaken) {
+  ResultStreamImpl stream(10);
+  stream.add(CacheableInt32::create(1));
+  stream.restart();
+  EXPECT_THROW(stream.next(std::chrono::milliseconds(10)), TimeoutException);
+
+  stream.add(CacheableInt32::create(2));
+  EXPECT_EQ(1, stream.next()->size());
+  stream.add(CacheableInt32::create(3));
+  stream.restart();
+  EXPECT_THROW(stream.next(), IllegalStateException);
+}
+
+TEST(ResultStreamTest, cancelReleasesBlockedProducer) {
+  ResultStreamManager streams;
+  std::atomic<int32_t> added(0);
+  auto stream = streams.start(
+      1, [&added](const std::shared_ptr<ResultStreamImpl>& producer) {
+        for (int32_t i = 0; i < 100; i++) {
+          producer->add(CacheableInt32::create(i));
+          ++added;
+        }
+      });
+  ASSERT_TRUE(eventually([&added] { return added == 1; }));
+
+  streams.cancel();
+  streams.join();
+  EXPECT_EQ(100, added);
+  EXPECT_EQ(1, stream->next(std::chrono::seconds(5))->size());
+  EXPECT_THROW(stream->next(std::chrono::seconds(5)), CacheClosedException);
+
+  EXPECT_THROW(
+      streams.start(1, [](const std::shared_ptr<ResultStreamImpl>&) {}),
+      CacheClosedException);
+}
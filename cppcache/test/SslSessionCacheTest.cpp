@@ -0,0 +1,140 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+#include "SslSessionCache.hpp"
+
+using apache::geode::client::SslSessionCache;
+
+namespace {
+
+/**
+ * Stand-in TLS server: a server context with a throwaway self-signed
+ * certificate, talking to clients over in-memory BIO pairs.
+ */
+class SslSessionCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr);
+    ASSERT_NE(nullptr, keyContext);
+    EVP_PKEY_keygen_init(keyContext);
+    EVP_PKEY_CTX_set_rsa_keygen_bits(keyContext, 2048);
+    EVP_PKEY_keygen(keyContext, &key_);
+    EVP_PKEY_CTX_free(keyContext);
+    ASSERT_NE(nullptr, key_);
+
+    certificate_ = X509_new();
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate_), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate_), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate_), 60 * 60);
+    X509_set_pubkey(certificate_, key_);
+    auto name = X509_get_subject_name(certificate_);
+    X509_NAME_add_entry_by_txt(
+        name, "CN", MBSTRING_ASC,
+        reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(certificate_, name);
+    X509_sign(certificate_, key_, EVP_sha256());
+
+    server_ = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_use_certificate(server_, certificate_);
+    SSL_CTX_use_PrivateKey(server_, key_);
+
+    client_ = SSL_CTX_new(TLS_client_method());
+    SSL_CTX_set_verify(client_, SSL_VERIFY_NONE, nullptr);
+    cache_ = std::unique_ptr<SslSessionCache>(new SslSessionCache());
+    cache_->attach(client_);
+  }
+
+  void TearDown() override {
+    SSL_CTX_free(client_);
+    SSL_CTX_free(server_);
+    X509_free(certificate_);
+    EVP_PKEY_free(key_);
+  }
+
+  /** Connects to the stand-in server, returning whether it resumed. */
+  bool connect(const std::string& endpoint) {
+    auto client = SSL_new(client_);
+    auto server = SSL_new(server_);
+    BIO* clientBio;
+    BIO* serverBio;
+    BIO_new_bio_pair(&clientBio, 0, &serverBio, 0);
+    SSL_set_bio(client, clientBio, clientBio);
+    SSL_set_bio(server, serverBio, serverBio);
+    SSL_set_connect_state(client);
+    SSL_set_accept_state(server);
+
+    cache_->prepare(client, endpoint);
+    for (int i = 0; i < 10 && !(SSL_is_init_finished(client) &&
+                                SSL_is_init_finished(server));
+         i++) {
+      SSL_do_handshake(client);
+      SSL_do_handshake(server);
+    }
+    EXPECT_TRUE(SSL_is_init_finished(client));
+
+    // TLS 1.3 tickets follow the handshake and are picked up by a read
+    char byte = 'x';
+    EXPECT_EQ(1, SSL_write(server, &byte, 1));
+    EXPECT_EQ(1, SSL_read(client, &byte, 1));
+
+    auto reused = SSL_session_reused(client) == 1;
+    // as ACE does on close; sessions of unclean closes are not resumable
+    SSL_shutdown(client);
+    SSL_free(client);
+    SSL_free(server);
+    return reused;
+  }
+
+  EVP_PKEY* key_ = nullptr;
+  X509* certificate_ = nullptr;
+  SSL_CTX* server_ = nullptr;
+  SSL_CTX* client_ = nullptr;
+  std::unique_ptr<SslSessionCache> cache_;
+};
+
+}  // namespace
+
+TEST_F(SslSessionCacheTest, secondConnectionResumesSession) {
+  EXPECT_FALSE(connect("server1:40404"));
+  EXPECT_EQ(1, cache_->size());
+  EXPECT_TRUE(connect("server1:40404"));
+}
+
+TEST_F(SslSessionCacheTest, sessionsAreKeptPerEndpoint) {
+  EXPECT_FALSE(connect("server1:40404"));
+  EXPECT_FALSE(connect("server2:40404"));
+  EXPECT_EQ(2, cache_->size());
+  EXPECT_TRUE(connect("server1:40404"));
+  EXPECT_TRUE(connect("server2:40404"));
+}
+
+TEST_F(SslSessionCacheTest, invalidateForcesFullHandshake) {
+  EXPECT_FALSE(connect("server1:40404"));
+  cache_->invalidate("server1:40404");
+  EXPECT_EQ(0, cache_->size());
+  EXPECT_FALSE(connect("server1:40404"));
+  EXPECT_TRUE(connect("server1:40404"));
+}
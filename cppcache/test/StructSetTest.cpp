@@ -20,8 +20,16 @@
 
 #include <gtest/gtest.h>
 
+#include "DataInputInternal.hpp"
+
+using apache::geode::client::CacheableDouble;
+using apache::geode::client::CacheableInt32;
 using apache::geode::client::CacheableString;
 using apache::geode::client::CacheableVector;
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::DSCode;
+using apache::geode::client::ResultColumn;
+using apache::geode::client::ResultColumnImpl;
 using apache::geode::client::Struct;
 using apache::geode::client::StructSetImpl;
 
@@ -112,3 +120,125 @@ TEST(StructSetTest, ForRange) {
     }
   }
 }
+
+TEST(StructSetTest, ColumnReadsNumbersUnboxed) {
+  const uint8_t bytes[] = {static_cast<uint8_t>(DSCode::CacheableInt32),
+                           0,
+                           0,
+                           0,
+                           5,
+                           static_cast<uint8_t>(DSCode::NullObj),
+                           static_cast<uint8_t>(DSCode::CacheableInt32),
+                           0,
+                           0,
+                           1,
+                           0};
+  DataInputInternal input(bytes, sizeof(bytes));
+
+  ResultColumnImpl column;
+  for (int i = 0; i < 3; i++) {
+    column.read(input);
+  }
+
+  ASSERT_EQ(ResultColumn::Type::INTEGRAL, column.getType());
+  ASSERT_EQ(3, column.size());
+  EXPECT_EQ(5, column.getIntegralValues()[0]);
+  EXPECT_EQ(256, column.getIntegralValues()[2]);
+  EXPECT_TRUE(column.isNull(1));
+  EXPECT_FALSE(column.isNull(2));
+  EXPECT_EQ(nullptr, column.getObject(1));
+  EXPECT_EQ(256,
+            std::dynamic_pointer_cast<CacheableInt32>(column.getObject(2))
+                ->value());
+  EXPECT_EQ(nullptr, column.getFloatingPointValues());
+}
+
+TEST(StructSetTest, ColumnReadsNullsPastTheFirstBitmapWord) {
+  std::vector<uint8_t> bytes;
+  for (uint8_t i = 0; i < 160; i++) {
+    if (i == 100 || i == 150) {
+      bytes.push_back(static_cast<uint8_t>(DSCode::NullObj));
+    } else {
+      bytes.insert(bytes.end(),
+                   {static_cast<uint8_t>(DSCode::CacheableInt32), 0, 0, 0, i});
+    }
+  }
+  DataInputInternal input(bytes.data(), bytes.size());
+
+  ResultColumnImpl column;
+  for (int i = 0; i < 160; i++) {
+    column.read(input);
+  }
+
+  ASSERT_EQ(ResultColumn::Type::INTEGRAL, column.getType());
+  ASSERT_EQ(160, column.size());
+  for (size_t i = 0; i < 160; i++) {
+    EXPECT_EQ(i == 100 || i == 150, column.isNull(i)) << "row " << i;
+  }
+  EXPECT_EQ(99, column.getIntegralValues()[99]);
+  EXPECT_EQ(159, column.getIntegralValues()[159]);
+  EXPECT_EQ(nullptr, column.getObject(150));
+}
+
+TEST(StructSetTest, ColumnOfMixedTypesHoldsObjects) {
+  ResultColumnImpl column;
+  column.add(nullptr);
+  column.add(CacheableInt32::create(1));
+  column.add(CacheableString::create("a"));
+
+  ASSERT_EQ(ResultColumn::Type::OBJECT, column.getType());
+  EXPECT_EQ(nullptr, column.getIntegralValues());
+  EXPECT_TRUE(column.isNull(0));
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt32>(column.getObject(1))
+                   ->value());
+  EXPECT_EQ("a", column.getObject(2)->toString());
+  EXPECT_THROW(column.getObject(3),
+               apache::geode::client::IllegalArgumentException);
+}
+
+TEST(StructSetTest, ColumnarRows) {
+  std::vector<std::shared_ptr<ResultColumnImpl>> columns;
+  columns.push_back(std::make_shared<ResultColumnImpl>());
+  columns.push_back(std::make_shared<ResultColumnImpl>());
+  for (int32_t i = 0; i < 3; i++) {
+    columns[0]->add(CacheableInt32::create(i));
+    columns[1]->add(CacheableDouble::create(i / 2.0));
+  }
+
+  StructSetImpl ss(columns, {"id", "price"});
+
+  ASSERT_EQ(3, ss.size());
+  EXPECT_EQ(columns[1], ss.getColumn(ss.getFieldIndex("price")));
+  EXPECT_EQ(1.0, ss.getColumn(1)->getFloatingPointValues()[2]);
+  EXPECT_THROW(ss.getColumn(2), std::out_of_range);
+
+  auto row = std::dynamic_pointer_cast<Struct>(ss[1]);
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ(1,
+            std::dynamic_pointer_cast<CacheableInt32>((*row)["id"])->value());
+
+  int32_t id = 0;
+  for (auto&& value : ss) {
+    auto rowStruct = std::dynamic_pointer_cast<Struct>(value);
+    EXPECT_EQ(id++,
+              std::dynamic_pointer_cast<CacheableInt32>((*rowStruct)[0])
+                  ->value());
+  }
+  EXPECT_EQ(3, id);
+}
+
+TEST(StructSetTest, ColumnOfRows) {
+  auto values = CacheableVector::create();
+  for (int32_t i = 0; i < 4; i++) {
+    values->push_back(CacheableInt32::create(i));
+    values->push_back(CacheableString::create(std::to_string(i)));
+  }
+
+  StructSetImpl ss(values, {"id", "name"});
+
+  auto ids = ss.getColumn(0);
+  ASSERT_EQ(ResultColumn::Type::INTEGRAL, ids->getType());
+  ASSERT_EQ(4, ids->size());
+  EXPECT_EQ(3, ids->getIntegralValues()[3]);
+  EXPECT_EQ(ResultColumn::Type::OBJECT, ss.getColumn(1)->getType());
+}
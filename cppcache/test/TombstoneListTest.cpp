@@ -0,0 +1,137 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "LocalRegion.hpp"
+#include "MapEntryT.hpp"
+#include "TombstoneList.hpp"
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableString;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::LocalRegion;
+using apache::geode::client::MapEntryImpl;
+using apache::geode::client::MapEntryT;
+using apache::geode::client::RegionShortcut;
+using apache::geode::client::TombstoneList;
+
+namespace {
+
+// the tombstone-timeout set below, and the eighth of it each generation spans
+const auto kTimeout = std::chrono::seconds(80);
+const auto kSpan = std::chrono::seconds(10);
+
+class TombstoneListTest : public ::testing::Test {
+ protected:
+  TombstoneListTest()
+      : m_cache(CacheFactory{}
+                    .set("log-level", "none")
+                    .set("tombstone-timeout", "80s")
+                    .create()) {
+    m_region = std::dynamic_pointer_cast<LocalRegion>(
+        m_cache.createRegionFactory(RegionShortcut::LOCAL).create("region"));
+    auto key = CacheableString::create("key");
+    m_tombstones.reset(
+        new TombstoneList(m_region->getEntryMap()->segmentFor(key),
+                          CacheRegionHelper::getCacheImpl(&m_cache)));
+  }
+
+  ~TombstoneListTest() noexcept override {
+    m_tombstones = nullptr;
+    m_cache.close();
+  }
+
+  std::shared_ptr<CacheableString> addTombstone(const std::string& name) {
+    auto key = CacheableString::create(name);
+    m_tombstones->add(MapEntryT<MapEntryImpl, 0, 0>::create(key));
+    return key;
+  }
+
+  Cache m_cache;
+  std::shared_ptr<LocalRegion> m_region;
+  std::unique_ptr<TombstoneList> m_tombstones;
+};
+
+}  // namespace
+
+TEST_F(TombstoneListTest, reapsGenerationOneSpanAfterTimeout) {
+  const auto before = TombstoneList::clock::now();
+  auto key = addTombstone("key");
+  const auto after = TombstoneList::clock::now();
+
+  m_tombstones->reapExpiredTombstones(after + kTimeout);
+  EXPECT_TRUE(m_tombstones->exists(key));
+
+  m_tombstones->reapExpiredTombstones(before + kTimeout + kSpan -
+                                      std::chrono::milliseconds(1));
+  EXPECT_TRUE(m_tombstones->exists(key));
+
+  m_tombstones->reapExpiredTombstones(after + kTimeout + kSpan);
+  EXPECT_FALSE(m_tombstones->exists(key));
+}
+
+TEST_F(TombstoneListTest, skipsTombstonesRemovedBeforeTheirGeneration) {
+  auto removed = addTombstone("removed");
+  auto kept = addTombstone("kept");
+  m_tombstones->eraseEntryFromTombstoneList(removed);
+  EXPECT_FALSE(m_tombstones->exists(removed));
+  EXPECT_TRUE(m_tombstones->exists(kept));
+
+  m_tombstones->reapExpiredTombstones(TombstoneList::clock::now() + kTimeout +
+                                      kSpan);
+  EXPECT_FALSE(m_tombstones->exists(removed));
+  EXPECT_FALSE(m_tombstones->exists(kept));
+}
+
+TEST_F(TombstoneListTest, sweepRetiresOnceLastGenerationIsReaped) {
+  EXPECT_FALSE(m_tombstones->isSweepScheduled());
+  addTombstone("first");
+  EXPECT_TRUE(m_tombstones->isSweepScheduled());
+
+  const auto now = TombstoneList::clock::now();
+  m_tombstones->sweepExpiredTombstones(now);
+  EXPECT_TRUE(m_tombstones->isSweepScheduled());
+
+  m_tombstones->sweepExpiredTombstones(now + kTimeout + kSpan);
+  EXPECT_FALSE(m_tombstones->isSweepScheduled());
+
+  auto key = addTombstone("second");
+  EXPECT_TRUE(m_tombstones->isSweepScheduled());
+  EXPECT_TRUE(m_tombstones->exists(key));
+}
+
+TEST_F(TombstoneListTest, sweepRetiresAfterClear) {
+  auto key = addTombstone("key");
+  m_tombstones->clear();
+  EXPECT_FALSE(m_tombstones->exists(key));
+  EXPECT_TRUE(m_tombstones->isSweepScheduled());
+
+  m_tombstones->sweepExpiredTombstones(TombstoneList::clock::now());
+  EXPECT_FALSE(m_tombstones->isSweepScheduled());
+}
@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+
+#include "TypeDispatchTable.hpp"
+
+using apache::geode::client::CacheableString;
+using apache::geode::client::Serializable;
+using apache::geode::client::TypeDispatchTable;
+
+namespace {
+
+std::shared_ptr<Serializable> createOne() {
+  return CacheableString::create("1");
+}
+
+std::shared_ptr<Serializable> createTwo() {
+  return CacheableString::create("2");
+}
+
+std::string valueOf(const std::shared_ptr<Serializable>& serializable) {
+  return std::dynamic_pointer_cast<CacheableString>(serializable)->value();
+}
+
+}  // namespace
+
+TEST(TypeDispatchTableTest, bindsIdsInsideAndOutsideTheDenseRange) {
+  TypeDispatchTable<int32_t, -4, 4> table;
+  EXPECT_EQ(nullptr, table.find(0));
+  EXPECT_EQ(nullptr, table.find(100));
+
+  EXPECT_TRUE(table.bind(-4, createOne));
+  EXPECT_TRUE(table.bind(3, createTwo));
+  EXPECT_TRUE(table.bind(4, createTwo));
+  EXPECT_TRUE(table.bind(-5, createOne));
+
+  EXPECT_EQ("1", valueOf((*table.find(-4))()));
+  EXPECT_EQ("2", valueOf((*table.find(3))()));
+  EXPECT_EQ("2", valueOf((*table.find(4))()));
+  EXPECT_EQ("1", valueOf((*table.find(-5))()));
+  EXPECT_EQ(nullptr, table.find(0));
+}
+
+TEST(TypeDispatchTableTest, bindRefusesBoundIds) {
+  TypeDispatchTable<int32_t, 0, 4> table;
+  EXPECT_TRUE(table.bind(1, createOne));
+  EXPECT_FALSE(table.bind(1, createTwo));
+  EXPECT_TRUE(table.bind(10, createOne));
+  EXPECT_FALSE(table.bind(10, createTwo));
+  EXPECT_EQ("1", valueOf((*table.find(1))()));
+  EXPECT_EQ("1", valueOf((*table.find(10))()));
+}
+
+TEST(TypeDispatchTableTest, rebindKeepsReplacedFactoriesCallable) {
+  TypeDispatchTable<int32_t, 0, 4> table;
+  table.rebind(1, createOne);
+  const auto old = table.find(1);
+  table.rebind(1, createTwo);
+
+  EXPECT_EQ("2", valueOf((*table.find(1))()));
+  EXPECT_EQ("1", valueOf((*old)()));
+}
+
+TEST(TypeDispatchTableTest, unbindAndClear) {
+  TypeDispatchTable<int32_t, 0, 4> table;
+  table.bind(1, createOne);
+  table.bind(2, createOne);
+  table.bind(10, createOne);
+
+  table.unbind(1);
+  table.unbind(10);
+  EXPECT_EQ(nullptr, table.find(1));
+  EXPECT_EQ(nullptr, table.find(10));
+  EXPECT_TRUE(table.bind(1, createTwo));
+
+  table.clear();
+  EXPECT_EQ(nullptr, table.find(1));
+  EXPECT_EQ(nullptr, table.find(2));
+}
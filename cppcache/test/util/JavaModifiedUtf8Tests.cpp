@@ -51,3 +51,85 @@ TEST(JavaModifiedUtf8Tests, DecodeStringWithInlineNullChar) {
       JavaModifiedUtf8::decode(reinterpret_cast<const char*>(buf.get()), 35);
   EXPECT_EQ(expected, actual);
 }
+
+TEST(JavaModifiedUtf8Tests, EncodedLengthFromUtf8WithNullAndSupplementary) {
+  std::string utf8("You had me at");
+  utf8.push_back(0);
+  utf8.append(u8"meat tornad\u00F6!\U000F0000");
+  EXPECT_EQ(35, JavaModifiedUtf8::encodedLength(utf8));
+}
+
+TEST(JavaModifiedUtf8Tests, FromUtf8String) {
+  std::string utf8("You had me at");
+  utf8.push_back(0);
+  utf8.append(u8"meat tornad\u00F6!\U000F0000");
+
+  auto expected = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(expected.get()),
+                        expected.size()),
+            JavaModifiedUtf8::fromString(utf8));
+}
+
+TEST(JavaModifiedUtf8Tests, FromInvalidUtf8StringThrows) {
+  EXPECT_THROW(JavaModifiedUtf8::fromString(std::string("tornado\x80")),
+               std::range_error);
+  EXPECT_THROW(JavaModifiedUtf8::fromString(std::string("tornad\xC3")),
+               std::range_error);
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8String) {
+  auto expected = std::string("You had me at");
+  expected.push_back(0);
+  expected.append(u8"meat tornad\u00F6!\U000F0000");
+
+  auto buf = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  EXPECT_EQ(expected, JavaModifiedUtf8::decodeToUtf8(
+                          reinterpret_cast<const char*>(buf.get()), 35));
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8ReplacesBadContinuationBytes) {
+  // C3 followed by ASCII, E4 B8 followed by ASCII
+  auto buf = ByteArray::fromString("61C3626364E4B86566");
+  EXPECT_EQ(std::string(u8"a\uFFFDbcd\uFFFDef"),
+            JavaModifiedUtf8::decodeToUtf8(
+                reinterpret_cast<const char*>(buf.get()), buf.size()));
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8ReplacesTruncatedSequences) {
+  auto buf = ByteArray::fromString("61E4B8");
+  EXPECT_EQ(std::string(u8"a\uFFFD"),
+            JavaModifiedUtf8::decodeToUtf8(
+                reinterpret_cast<const char*>(buf.get()), buf.size()));
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8ReplacesLoneSurrogates) {
+  // high surrogate followed by ASCII, then an unpaired low surrogate
+  auto buf = ByteArray::fromString("EDAE8061EDB080");
+  EXPECT_EQ(std::string(u8"\uFFFDa\uFFFD"),
+            JavaModifiedUtf8::decodeToUtf8(
+                reinterpret_cast<const char*>(buf.get()), buf.size()));
+
+  // high surrogate at the end of the buffer
+  buf = ByteArray::fromString("61EDAE80");
+  EXPECT_EQ(std::string(u8"a\uFFFD"),
+            JavaModifiedUtf8::decodeToUtf8(
+                reinterpret_cast<const char*>(buf.get()), buf.size()));
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8ReplacesInvalidLeadBytes) {
+  // a 4 byte UTF-8 sequence and a stray continuation byte
+  auto buf = ByteArray::fromString("F3B080806180");
+  EXPECT_EQ(std::string(u8"\uFFFD\uFFFD\uFFFD\uFFFDa\uFFFD"),
+            JavaModifiedUtf8::decodeToUtf8(
+                reinterpret_cast<const char*>(buf.get()), buf.size()));
+}
+
+TEST(JavaModifiedUtf8Tests, DecodeToUtf8ShortensOverlongForms) {
+  // 'a' as 2 bytes, 'b' as 3 bytes
+  auto buf = ByteArray::fromString("C1A1E081A2");
+  EXPECT_EQ(std::string("ab"),
+            JavaModifiedUtf8::decodeToUtf8(
+                reinterpret_cast<const char*>(buf.get()), buf.size()));
+}
@@ -0,0 +1,86 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/mpsc_ring_buffer.hpp"
+
+using apache::geode::util::concurrent::mpsc_ring_buffer;
+
+TEST(mpsc_ring_bufferTest, roundsCapacityUpToPowerOfTwo) {
+  mpsc_ring_buffer<int> queue(5);
+  EXPECT_EQ(8, queue.capacity());
+}
+
+TEST(mpsc_ring_bufferTest, pushFailsWhenFull) {
+  mpsc_ring_buffer<std::string> queue(2);
+
+  std::string a = "a", b = "b", c = "c";
+  EXPECT_TRUE(queue.try_push(a));
+  EXPECT_TRUE(queue.try_push(b));
+  EXPECT_FALSE(queue.try_push(c));
+  EXPECT_EQ("c", c);
+
+  std::string value;
+  ASSERT_TRUE(queue.try_pop(value));
+  EXPECT_EQ("a", value);
+  EXPECT_TRUE(queue.try_push(c));
+  ASSERT_TRUE(queue.try_pop(value));
+  EXPECT_EQ("b", value);
+  ASSERT_TRUE(queue.try_pop(value));
+  EXPECT_EQ("c", value);
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(mpsc_ring_bufferTest, keepsOrderOfEachProducer) {
+  const int producers = 4;
+  const int perProducer = 10000;
+  mpsc_ring_buffer<int> queue(64);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, p, perProducer] {
+      for (int i = 0; i < perProducer; i++) {
+        auto value = p * perProducer + i;
+        while (!queue.try_push(value)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<int> next(producers, 0);
+  for (int received = 0; received < producers * perProducer;) {
+    int value;
+    if (queue.try_pop(value)) {
+      auto p = value / perProducer;
+      ASSERT_EQ(next[p]++, value % perProducer);
+      received++;
+    }
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto count : next) {
+    EXPECT_EQ(perProducer, count);
+  }
+}
@@ -27,6 +27,7 @@ namespace client {
 
 ACE_Recursive_Thread_Mutex SSLImpl::s_mutex;
 volatile bool SSLImpl::s_initialized = false;
+SslSessionCache SSLImpl::s_sessionCache;
 
 void *gf_create_SslImpl(ACE_HANDLE sock, const char *pubkeyfile,
                         const char *privkeyfile, const char *pemPassword) {
@@ -66,6 +67,7 @@ SSLImpl::SSLImpl(ACE_HANDLE sock, const char *pubkeyfile,
 
     sslctx->private_key(privkeyfile);
     sslctx->certificate(privkeyfile);
+    s_sessionCache.attach(sslctx->context());
     SSLImpl::s_initialized = true;
   }
   m_io = new ACE_SSL_SOCK_Stream();
@@ -104,13 +106,24 @@ int SSLImpl::listen(ACE_INET_Addr addr, std::chrono::microseconds waitSeconds) {
 
 int SSLImpl::connect(ACE_INET_Addr ipaddr,
                      std::chrono::microseconds waitSeconds) {
+  char endpoint[256] = {0};
+  ipaddr.addr_to_string(endpoint, sizeof(endpoint));
+  m_endpoint = endpoint;
+  s_sessionCache.prepare(m_io->ssl(), m_endpoint);
+
   ACE_SSL_SOCK_Connector conn;
+  int result;
   if (waitSeconds > std::chrono::microseconds::zero()) {
     ACE_Time_Value wtime(waitSeconds);
-    return conn.connect(*m_io, ipaddr, &wtime);
+    result = conn.connect(*m_io, ipaddr, &wtime);
   } else {
-    return conn.connect(*m_io, ipaddr);
+    result = conn.connect(*m_io, ipaddr);
+  }
+  if (result == -1) {
+    // don't keep offering a session the server may have rejected
+    s_sessionCache.invalidate(m_endpoint);
   }
+  return result;
 }
 
 ssize_t SSLImpl::recv(void *buf, size_t len, const ACE_Time_Value *timeout,
@@ -126,6 +139,10 @@ ssize_t SSLImpl::send(const void *buf, size_t len,
 
 int SSLImpl::getLocalAddr(ACE_Addr &addr) { return m_io->get_local_addr(addr); }
 
+bool SSLImpl::isSessionReused() {
+  return SSL_session_reused(m_io->ssl()) == 1;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
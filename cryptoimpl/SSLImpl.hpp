@@ -40,6 +40,7 @@
 #pragma pack(pop)
 
 #include "Ssl.hpp"
+#include "SslSessionCache.hpp"
 #include "cryptoimpl_export.h"
 
 namespace apache {
@@ -49,8 +50,10 @@ namespace client {
 class SSLImpl : public apache::geode::client::Ssl {
  private:
   ACE_SSL_SOCK_Stream* m_io;
+  std::string m_endpoint;
   static ACE_Recursive_Thread_Mutex s_mutex;
   volatile static bool s_initialized;
+  static SslSessionCache s_sessionCache;
 
  public:
   SSLImpl(ACE_HANDLE sock, const char* pubkeyfile, const char* privkeyfile,
@@ -63,6 +66,7 @@ class SSLImpl : public apache::geode::client::Ssl {
   ssize_t recv(void*, size_t, const ACE_Time_Value*, size_t*) override;
   ssize_t send(const void*, size_t, const ACE_Time_Value*, size_t*) override;
   int getLocalAddr(ACE_Addr&) override;
+  bool isSessionReused() override;
   void close() override;
 };
 
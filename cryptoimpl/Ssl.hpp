@@ -37,6 +37,8 @@ class Ssl {
   virtual ssize_t recv(void*, size_t, const ACE_Time_Value*, size_t*) = 0;
   virtual ssize_t send(const void*, size_t, const ACE_Time_Value*, size_t*) = 0;
   virtual int getLocalAddr(ACE_Addr&) = 0;
+  // true if the handshake resumed an earlier TLS session
+  virtual bool isSessionReused() = 0;
   virtual void close() = 0;
 };
 }  // namespace client
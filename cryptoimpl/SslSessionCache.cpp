@@ -0,0 +1,95 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SslSessionCache.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+SslSessionCache::~SslSessionCache() {
+  for (auto& entry : m_sessions) {
+    SSL_SESSION_free(entry.second);
+  }
+}
+
+int SslSessionCache::exDataIndex() {
+  static const int index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+int SslSessionCache::ctxExDataIndex() {
+  static const int index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+void SslSessionCache::attach(SSL_CTX* ctx) {
+  SSL_CTX_set_ex_data(ctx, ctxExDataIndex(), this);
+  // sessions are only stored here, keyed by endpoint
+  SSL_CTX_set_session_cache_mode(
+      ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ctx, newSessionCallback);
+}
+
+void SslSessionCache::prepare(SSL* ssl, const std::string& endpoint) {
+  SSL_set_ex_data(ssl, exDataIndex(), const_cast<std::string*>(&endpoint));
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  auto found = m_sessions.find(endpoint);
+  if (found != m_sessions.end()) {
+    SSL_set_session(ssl, found->second);
+  }
+}
+
+void SslSessionCache::invalidate(const std::string& endpoint) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  auto found = m_sessions.find(endpoint);
+  if (found != m_sessions.end()) {
+    SSL_SESSION_free(found->second);
+    m_sessions.erase(found);
+  }
+}
+
+size_t SslSessionCache::size() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_sessions.size();
+}
+
+int SslSessionCache::newSessionCallback(SSL* ssl, SSL_SESSION* session) {
+  auto endpoint =
+      static_cast<const std::string*>(SSL_get_ex_data(ssl, exDataIndex()));
+  auto cache = static_cast<SslSessionCache*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), ctxExDataIndex()));
+  if (endpoint == nullptr || cache == nullptr) {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> guard(cache->m_mutex);
+  auto& cached = cache->m_sessions[*endpoint];
+  if (cached != nullptr) {
+    SSL_SESSION_free(cached);
+  }
+  // returning 1 keeps the reference OpenSSL passed in
+  cached = session;
+  return 1;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
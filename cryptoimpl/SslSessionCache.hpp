@@ -0,0 +1,79 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_CRYPTOIMPL_SSLSESSIONCACHE_H_
+#define GEODE_CRYPTOIMPL_SSLSESSIONCACHE_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <openssl/ssl.h>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Client side cache of TLS sessions, one per server endpoint, so that new
+ * connections to a server can resume a previous session (session ID or
+ * ticket) instead of doing a full handshake.
+ *
+ * OpenSSL hands every session a connection receives to the cache through
+ * the new session callback, including TLS 1.3 tickets that arrive after the
+ * handshake, and the most recent one for the endpoint replaces any older
+ * session.
+ */
+class SslSessionCache {
+ public:
+  SslSessionCache() = default;
+  ~SslSessionCache();
+
+  SslSessionCache(const SslSessionCache&) = delete;
+  SslSessionCache& operator=(const SslSessionCache&) = delete;
+
+  /** Makes connections created from ctx deliver their sessions here. */
+  void attach(SSL_CTX* ctx);
+
+  /**
+   * Offers the cached session for endpoint, if any, to ssl before its
+   * handshake and records where sessions received by ssl belong. endpoint
+   * must outlive ssl.
+   */
+  void prepare(SSL* ssl, const std::string& endpoint);
+
+  /** Forgets the session for endpoint, e.g. after a failed handshake. */
+  void invalidate(const std::string& endpoint);
+
+  size_t size() const;
+
+ private:
+  static int exDataIndex();
+  static int ctxExDataIndex();
+  static int newSessionCallback(SSL* ssl, SSL_SESSION* session);
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, SSL_SESSION*> m_sessions;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_CRYPTOIMPL_SSLSESSIONCACHE_H_